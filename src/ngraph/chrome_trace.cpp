@@ -14,14 +14,24 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
 #include <iostream>
 #include <map>
+#include <memory>
+#include <numeric>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "chrome_trace.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -33,24 +43,378 @@ static bool read_tracing_env_var()
     return is_enabled;
 }
 
-mutex runtime::event::Manager::s_file_mutex;
+static double read_sampling_rate_env_var()
+{
+    string rate = getenv_string("NGRAPH_TRACING_SAMPLE_RATE");
+    return rate.empty() ? 1.0 : stod(rate);
+}
+
 bool runtime::event::Manager::s_tracing_enabled = read_tracing_env_var();
 
+namespace
+{
+    // Interval at which the background thread drains the event buffers
+    constexpr chrono::milliseconds s_flush_interval{100};
+
+    struct EventRecord
+    {
+        char phase;
+        size_t ts;
+        size_t dur;
+        size_t id;
+        // Interned, see Manager::intern
+        uint32_t name;
+        uint32_t category;
+        // Keeps its capacity when a slot is reused, so recording does not allocate once
+        // every slot has been written
+        string args;
+    };
+
+    // Ring buffer written only by the thread that owns it and read only by the flushing
+    // thread
+    class EventBuffer
+    {
+    public:
+        EventBuffer(size_t capacity, uint32_t tid, const string& tid_string)
+            : m_tid(tid)
+            , m_tid_string(tid_string)
+        {
+            size_t size = 1;
+            while (size < capacity)
+            {
+                size <<= 1;
+            }
+            m_records.resize(size);
+            m_mask = size - 1;
+        }
+
+        // Slot for the next event, or nullptr if the buffer is full
+        EventRecord* begin_write()
+        {
+            size_t head = m_head.load(memory_order_relaxed);
+            if (head - m_tail.load(memory_order_acquire) > m_mask)
+            {
+                m_dropped.fetch_add(1, memory_order_relaxed);
+                return nullptr;
+            }
+            return &m_records[head & m_mask];
+        }
+
+        void end_write() { m_head.fetch_add(1, memory_order_release); }
+        template <typename F>
+        void drain(F&& f)
+        {
+            size_t tail = m_tail.load(memory_order_relaxed);
+            size_t head = m_head.load(memory_order_acquire);
+            for (; tail != head; tail++)
+            {
+                f(m_records[tail & m_mask]);
+            }
+            m_tail.store(tail, memory_order_release);
+        }
+
+        size_t get_dropped() const { return m_dropped.load(memory_order_relaxed); }
+        uint32_t m_tid;
+        string m_tid_string;
+        atomic<bool> m_retired{false};
+
+    private:
+        vector<EventRecord> m_records;
+        size_t m_mask;
+        atomic<size_t> m_head{0};
+        atomic<size_t> m_tail{0};
+        atomic<size_t> m_dropped{0};
+    };
+
+    // Marks the buffer of an exiting thread so the flusher can release it once it is empty
+    struct ThreadBufferHolder
+    {
+        ~ThreadBufferHolder()
+        {
+            if (m_buffer)
+            {
+                m_buffer->m_retired = true;
+            }
+        }
+        shared_ptr<EventBuffer> m_buffer;
+    };
+
+    class EventTracer
+    {
+    public:
+        static EventTracer& get()
+        {
+            static EventTracer s_tracer;
+            return s_tracer;
+        }
+
+        ~EventTracer()
+        {
+            {
+                lock_guard<mutex> lock(m_flusher_mutex);
+                m_stop = true;
+            }
+            m_flusher_cv.notify_one();
+            if (m_flusher.joinable())
+            {
+                m_flusher.join();
+            }
+            close();
+        }
+
+        EventBuffer* get_thread_buffer()
+        {
+            static thread_local ThreadBufferHolder s_holder;
+            if (!s_holder.m_buffer)
+            {
+                stringstream ss;
+                ss << "\"" << this_thread::get_id() << "\"";
+                lock_guard<mutex> lock(m_buffers_mutex);
+                s_holder.m_buffer = make_shared<EventBuffer>(
+                    m_buffer_size, static_cast<uint32_t>(m_next_tid++), ss.str());
+                m_buffers.push_back(s_holder.m_buffer);
+                if (!m_flusher.joinable())
+                {
+                    m_flusher = thread(&EventTracer::flush_loop, this);
+                }
+            }
+            return s_holder.m_buffer.get();
+        }
+
+        void open(const string& path, runtime::event::Manager::Format format)
+        {
+            lock_guard<mutex> lock(m_output_mutex);
+            open_locked(path, format);
+        }
+
+        void close()
+        {
+            lock_guard<mutex> lock(m_output_mutex);
+            drain_locked();
+            if (m_out.is_open())
+            {
+                if (m_format == runtime::event::Manager::Format::JSON)
+                {
+                    m_out << "\n]\n";
+                }
+                m_out.close();
+            }
+        }
+
+        void flush()
+        {
+            lock_guard<mutex> lock(m_output_mutex);
+            drain_locked();
+            m_out.flush();
+        }
+
+        size_t get_dropped_events()
+        {
+            lock_guard<mutex> lock(m_buffers_mutex);
+            return m_dropped_by_retired +
+                   accumulate(m_buffers.begin(),
+                              m_buffers.end(),
+                              size_t(0),
+                              [](size_t sum, const shared_ptr<EventBuffer>& buffer) {
+                                  return sum + buffer->get_dropped();
+                              });
+        }
+
+        uint32_t intern(const string& name)
+        {
+            lock_guard<mutex> lock(m_names_mutex);
+            auto it = m_name_ids.find(name);
+            if (it == m_name_ids.end())
+            {
+                it = m_name_ids.emplace(name, static_cast<uint32_t>(m_names.size())).first;
+                m_names.push_back(&it->first);
+            }
+            return it->second;
+        }
+
+        atomic<double> m_sampling_rate{read_sampling_rate_env_var()};
+
+    private:
+        EventTracer()
+            : m_buffer_size(getenv_int("NGRAPH_TRACING_BUFFER_SIZE", 16384))
+        {
+            m_default_format = to_lower(getenv_string("NGRAPH_TRACING_FORMAT")) == "binary"
+                                   ? runtime::event::Manager::Format::BINARY
+                                   : runtime::event::Manager::Format::JSON;
+            // Id 0 is the empty category of Object events
+            intern("");
+        }
+
+        void open_locked(const string& path, runtime::event::Manager::Format format)
+        {
+            if (m_out.is_open())
+            {
+                return;
+            }
+            m_format = format;
+            m_first_event = true;
+            if (m_format == runtime::event::Manager::Format::JSON)
+            {
+                m_out.open(path, ios_base::trunc);
+                m_out << "[\n";
+            }
+            else
+            {
+                m_out.open(path, ios_base::trunc | ios_base::binary);
+                uint32_t pid = static_cast<uint32_t>(getpid());
+                m_out.write("NGTRACE1", 8);
+                write_binary(pid);
+            }
+        }
+
+        template <typename T>
+        void write_binary(const T& value)
+        {
+            m_out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        void write_binary(const string& value)
+        {
+            write_binary(static_cast<uint32_t>(value.size()));
+            m_out.write(value.data(), value.size());
+        }
+
+        void write_json(const EventRecord& event, const string& tid)
+        {
+            static const string pid = to_string(getpid());
+            if (!m_first_event)
+            {
+                m_out << ",\n";
+            }
+            m_first_event = false;
+            m_out << R"({"name":")" << *m_names[event.name];
+            if (event.phase == 'X')
+            {
+                m_out << R"(","cat":")" << *m_names[event.category] << R"(","ph":"X","pid":)"
+                      << pid
+                      << R"(,"tid":)" << tid << R"(,"ts":)" << event.ts << R"(,"dur":)"
+                      << event.dur;
+            }
+            else
+            {
+                m_out << R"(","ph":")" << event.phase << R"(","id":")" << event.id
+                      << R"(","ts":)" << event.ts << R"(,"pid":)" << pid << R"(,"tid":)"
+                      << tid;
+            }
+            if (!event.args.empty())
+            {
+                m_out << R"(,"args":)" << event.args;
+            }
+            m_out << "}";
+        }
+
+        void drain_locked()
+        {
+            // A buffer is only released if its thread had exited before it was drained, so
+            // no event can be written to it afterwards
+            vector<shared_ptr<EventBuffer>> buffers;
+            vector<shared_ptr<EventBuffer>> retired;
+            {
+                lock_guard<mutex> lock(m_buffers_mutex);
+                buffers = m_buffers;
+            }
+            for (auto& buffer : buffers)
+            {
+                if (buffer->m_retired)
+                {
+                    retired.push_back(buffer);
+                }
+                // Other threads may intern names meanwhile
+                lock_guard<mutex> names_lock(m_names_mutex);
+                buffer->drain([&](const EventRecord& event) {
+                    if (!m_out.is_open())
+                    {
+                        open_locked("runtime_event_trace.json", m_default_format);
+                    }
+                    if (m_format == runtime::event::Manager::Format::JSON)
+                    {
+                        write_json(event, buffer->m_tid_string);
+                    }
+                    else
+                    {
+                        m_out.put(event.phase);
+                        write_binary(buffer->m_tid);
+                        write_binary(static_cast<uint64_t>(event.ts));
+                        write_binary(static_cast<uint64_t>(event.dur));
+                        write_binary(static_cast<uint64_t>(event.id));
+                        write_binary(*m_names[event.name]);
+                        write_binary(*m_names[event.category]);
+                        write_binary(event.args);
+                    }
+                });
+            }
+
+            if (!retired.empty())
+            {
+                lock_guard<mutex> lock(m_buffers_mutex);
+                for (auto& buffer : retired)
+                {
+                    m_dropped_by_retired += buffer->get_dropped();
+                    m_buffers.erase(find(m_buffers.begin(), m_buffers.end(), buffer));
+                }
+            }
+        }
+
+        void flush_loop()
+        {
+            unique_lock<mutex> lock(m_flusher_mutex);
+            while (!m_stop)
+            {
+                m_flusher_cv.wait_for(lock, s_flush_interval);
+                lock.unlock();
+                {
+                    lock_guard<mutex> output_lock(m_output_mutex);
+                    drain_locked();
+                }
+                lock.lock();
+            }
+        }
+
+        size_t m_buffer_size;
+        mutex m_buffers_mutex;
+        vector<shared_ptr<EventBuffer>> m_buffers;
+        size_t m_next_tid = 0;
+        size_t m_dropped_by_retired = 0;
+
+        mutex m_output_mutex;
+        ofstream m_out;
+        runtime::event::Manager::Format m_format = runtime::event::Manager::Format::JSON;
+        runtime::event::Manager::Format m_default_format;
+        bool m_first_event = true;
+
+        mutex m_names_mutex;
+        unordered_map<string, uint32_t> m_name_ids;
+        // Keys of m_name_ids by id; the keys of an unordered_map do not move
+        vector<const string*> m_names;
+
+        mutex m_flusher_mutex;
+        condition_variable m_flusher_cv;
+        thread m_flusher;
+        bool m_stop = false;
+    };
+}
+
 runtime::event::Duration::Duration(const string& name, const string& category, const string& args)
 {
-    if (Manager::is_tracing_enabled())
+    if (Manager::is_tracing_enabled() && Manager::sample())
     {
+        m_enabled = true;
         m_start = Manager::get_current_microseconds();
         m_stop = 0;
-        m_name = name;
-        m_category = category;
+        m_name = Manager::intern(name);
+        m_category = Manager::intern(category);
         m_args = args;
     }
 }
 
 void runtime::event::Duration::stop()
 {
-    if (Manager::is_tracing_enabled())
+    if (m_enabled)
     {
         m_stop = Manager::get_current_microseconds();
     }
@@ -58,64 +422,23 @@ void runtime::event::Duration::stop()
 
 void runtime::event::Duration::write()
 {
-    if (Manager::is_tracing_enabled())
+    if (m_enabled)
     {
         size_t stop_time = (m_stop != 0 ? m_stop : Manager::get_current_microseconds());
-
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = runtime::event::Manager::get_output_stream();
-        if (out.is_open() == false)
-        {
-            runtime::event::Manager::open();
-        }
-        else
-        {
-            Manager::get_output_stream() << ",\n";
-        }
-
-        Manager::get_output_stream() <<
-            R"({"name":")" << m_name << R"(","cat":")" << m_category << R"(","ph":"X","pid":)"
-                                     << Manager::get_process_id() << R"(,"tid":)"
-                                     << Manager::get_thread_id() <<
-            R"(,"ts":)" << m_start << R"(,"dur":)" << (stop_time - m_start);
-        if (!m_args.empty())
-        {
-            out <<
-                R"(,"args":)" << m_args;
-        }
-        out << "}";
+        Manager::record('X', m_name, m_category, m_start, stop_time - m_start, 0, m_args);
+        m_enabled = false;
     }
 }
 
 runtime::event::Object::Object(const string& name, const string& args)
-    : m_name{name}
+    : m_name{Manager::intern(name)}
     , m_id{static_cast<size_t>(chrono::high_resolution_clock::now().time_since_epoch().count())}
 {
     if (Manager::is_tracing_enabled())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = runtime::event::Manager::get_output_stream();
-        if (out.is_open() == false)
-        {
-            runtime::event::Manager::open();
-        }
-        else
-        {
-            Manager::get_output_stream() << ",\n";
-        }
-        out << R"({"name":")" << m_name << R"(","ph":"N","id":")" << m_id <<
-            R"(","ts":)" << Manager::get_current_microseconds() <<
-            R"(,"pid":)" << Manager::get_process_id() << R"(,"tid":)" << Manager::get_thread_id();
-        if (!args.empty())
-        {
-            out <<
-                R"(,"args":)" << args;
-        }
-        out << "}";
-
-        write_snapshot(out, args);
+        size_t ts = Manager::get_current_microseconds();
+        Manager::record('N', m_name, 0, ts, 0, m_id, args);
+        Manager::record('O', m_name, 0, ts, 0, m_id, args);
     }
 }
 
@@ -123,86 +446,104 @@ void runtime::event::Object::snapshot(const string& args)
 {
     if (Manager::is_tracing_enabled())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = runtime::event::Manager::get_output_stream();
-        if (out.is_open() == false)
-        {
-            runtime::event::Manager::open();
-        }
-        else
-        {
-            Manager::get_output_stream() << ",\n";
-        }
-        write_snapshot(out, args);
+        Manager::record('O', m_name, 0, Manager::get_current_microseconds(), 0, m_id, args);
     }
 }
 
-void runtime::event::Object::write_snapshot(ostream& out, const string& args)
+void runtime::event::Object::destroy()
 {
-    out << R"({"name":")" << m_name << R"(","ph":"O","id":")" << m_id <<
-        R"(","ts":)" << Manager::get_current_microseconds() <<
-        R"(,"pid":)" << Manager::get_process_id() << R"(,"tid":)" << Manager::get_thread_id();
-    if (!args.empty())
+    if (Manager::is_tracing_enabled())
     {
-        out <<
-            R"(,"args":)" << args;
+        Manager::record('D', m_name, 0, Manager::get_current_microseconds(), 0, m_id, "");
     }
-    out << "}";
 }
 
-void runtime::event::Object::destroy()
+uint32_t runtime::event::Manager::intern(const string& name)
 {
-    if (Manager::is_tracing_enabled())
+    // Most names are seen again, so each thread keeps the ids it has looked up
+    static thread_local unordered_map<string, uint32_t> s_ids;
+    auto it = s_ids.find(name);
+    if (it == s_ids.end())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = runtime::event::Manager::get_output_stream();
-        if (out.is_open() == false)
-        {
-            runtime::event::Manager::open();
-        }
-        else
-        {
-            Manager::get_output_stream() << ",\n";
-        }
-        out << R"({"name":")" << m_name << R"(","ph":"D","id":")" << m_id <<
-            R"(","ts":)" << Manager::get_current_microseconds() <<
-            R"(,"pid":)" << Manager::get_process_id() << R"(,"tid":)" << Manager::get_thread_id()
-            << "}";
+        it = s_ids.emplace(name, EventTracer::get().intern(name)).first;
     }
+    return it->second;
 }
 
-void runtime::event::Manager::open(const string& path)
+void runtime::event::Manager::record(char phase,
+                                     uint32_t name,
+                                     uint32_t category,
+                                     size_t ts,
+                                     size_t dur,
+                                     size_t id,
+                                     const string& args)
 {
-    ofstream& out = get_output_stream();
-    if (out.is_open() == false)
+    EventBuffer* buffer = EventTracer::get().get_thread_buffer();
+    if (EventRecord* event = buffer->begin_write())
     {
-        out.open(path, ios_base::trunc);
-        out << "[\n";
+        event->phase = phase;
+        event->ts = ts;
+        event->dur = dur;
+        event->id = id;
+        event->name = name;
+        event->category = category;
+        event->args.assign(args);
+        buffer->end_write();
     }
 }
 
-void runtime::event::Manager::close()
+bool runtime::event::Manager::sample()
 {
-    ofstream& out = get_output_stream();
-    if (out.is_open())
+    double rate = EventTracer::get().m_sampling_rate.load(memory_order_relaxed);
+    if (rate >= 1.0)
     {
-        out << "\n]\n";
-        out.close();
+        return true;
     }
+    static thread_local double s_credit = 0.0;
+    s_credit += rate;
+    if (s_credit >= 1.0)
+    {
+        s_credit -= 1.0;
+        return true;
+    }
+    return false;
+}
+
+void runtime::event::Manager::set_sampling_rate(double rate)
+{
+    EventTracer::get().m_sampling_rate = rate;
+}
+
+double runtime::event::Manager::get_sampling_rate()
+{
+    return EventTracer::get().m_sampling_rate;
+}
+
+size_t runtime::event::Manager::get_dropped_events()
+{
+    return EventTracer::get().get_dropped_events();
 }
 
-ofstream& runtime::event::Manager::get_output_stream()
+void runtime::event::Manager::open(const string& path)
 {
-    static ofstream s_event_log;
-    return s_event_log;
+    open(path,
+         to_lower(getenv_string("NGRAPH_TRACING_FORMAT")) == "binary" ? Format::BINARY
+                                                                       : Format::JSON);
 }
 
-const string& runtime::event::Manager::get_process_id()
+void runtime::event::Manager::open(const string& path, Format format)
 {
-    static const string s_pid = to_string(getpid());
-    return s_pid;
+    EventTracer::get().open(path, format);
+}
+
+void runtime::event::Manager::close()
+{
+    EventTracer::get().close();
+}
+
+void runtime::event::Manager::flush()
+{
+    EventTracer::get().flush();
 }
 
 void runtime::event::Manager::enable_event_tracing()
@@ -219,23 +560,3 @@ bool runtime::event::Manager::is_event_tracing_enabled()
 {
     return s_tracing_enabled;
 }
-
-string runtime::event::Manager::get_thread_id()
-{
-    thread::id tid = this_thread::get_id();
-    static map<thread::id, string> tid_map;
-    auto it = tid_map.find(tid);
-    string rc;
-    if (it == tid_map.end())
-    {
-        stringstream ss;
-        ss << "\"" << tid << "\"";
-        rc = ss.str();
-        tid_map.insert({tid, rc});
-    }
-    else
-    {
-        rc = it->second;
-    }
-    return rc;
-}
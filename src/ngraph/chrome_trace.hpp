@@ -17,6 +17,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <mutex>
@@ -75,30 +76,67 @@ namespace ngraph
 // More information about this is at:
 // http://dev.chromium.org/developers/how-tos/trace-event-profiling-tool
 
+// Events are not written by the thread that produces them. Every thread appends binary
+// records to its own lock-free ring buffer and a background thread drains the buffers into
+// the trace file, either as chrome tracing JSON or in the compact binary format below. When
+// a buffer is full its newest events are dropped rather than blocking the producer. Event
+// names and categories are interned when an event starts and only looked up again when it is
+// written, so a thread records events with names it used before without allocating.
+//
+// Binary format: the magic "NGTRACE1" and the process id (uint32), followed by records of
+//   phase (char) tid (uint32) ts (uint64) dur (uint64) id (uint64)
+//   name, category, args (each a uint32 length followed by the bytes)
+// with all integers in host byte order.
+
 class ngraph::runtime::event::Manager
 {
     friend class Duration;
     friend class Object;
 
 public:
+    enum class Format
+    {
+        JSON,
+        BINARY
+    };
+
+    /// \brief Opens the trace file, in the format given by NGRAPH_TRACING_FORMAT
+    ///        ("json" or "binary", default json). Events traced before the first call to
+    ///        open go to runtime_event_trace.json.
     static void open(const std::string& path = "runtime_event_trace.json");
+    static void open(const std::string& path, Format format);
+    /// \brief Writes the buffered events and closes the trace file
     static void close();
+    /// \brief Writes all events buffered so far to the trace file
+    static void flush();
     static bool is_tracing_enabled() { return s_tracing_enabled; }
     static void enable_event_tracing();
     static void disable_event_tracing();
     static bool is_event_tracing_enabled();
 
+    /// \brief Fraction of Duration events that are recorded, 1 by default or the value of
+    ///        NGRAPH_TRACING_SAMPLE_RATE. Every thread records evenly spaced events, e.g.
+    ///        every hundredth one at 0.01, so tracing can be left on at low cost.
+    static void set_sampling_rate(double rate);
+    static double get_sampling_rate();
+    /// \brief Number of events dropped because a thread's buffer was full
+    static size_t get_dropped_events();
+
 private:
-    static std::ofstream& get_output_stream();
-    static const std::string& get_process_id();
+    /// \brief Id of name, which stays valid for the lifetime of the process
+    static uint32_t intern(const std::string& name);
     static size_t get_current_microseconds()
     {
         return std::chrono::high_resolution_clock::now().time_since_epoch().count() / 1000;
     }
-    static std::string get_thread_id();
-    static std::mutex& get_mutex() { return s_file_mutex; }
-    static std::ostream s_ostream;
-    static std::mutex s_file_mutex;
+    static bool sample();
+    static void record(char phase,
+                       uint32_t name,
+                       uint32_t category,
+                       size_t ts,
+                       size_t dur,
+                       size_t id,
+                       const std::string& args);
     static bool s_tracing_enabled;
 };
 
@@ -122,11 +160,12 @@ public:
     Duration& operator=(Duration const&) = delete;
 
 private:
-    std::string to_json() const;
+    // false if tracing is off, the event was not sampled or it was already written
+    bool m_enabled{false};
     size_t m_start{0};
     size_t m_stop{0};
-    std::string m_name;
-    std::string m_category;
+    uint32_t m_name{0};
+    uint32_t m_category{0};
     std::string m_args;
 };
 
@@ -138,7 +177,6 @@ public:
     void destroy();
 
 private:
-    void write_snapshot(std::ostream& out, const std::string& args);
-    const std::string m_name;
+    const uint32_t m_name;
     size_t m_id{0};
 };
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/env_util.hpp"
@@ -43,6 +45,22 @@ descriptor::Input::Input(Node* node, size_t index)
 {
 }
 
+descriptor::Input::Input(Input&& other) noexcept
+    : m_src_node(std::move(other.m_src_node))
+    , m_node(other.m_node)
+    , m_index(other.m_index)
+    , m_output(other.m_output)
+    , m_is_relevant_to_shape(other.m_is_relevant_to_shape)
+    , m_is_relevant_to_value(other.m_is_relevant_to_value)
+{
+    if (m_output != nullptr)
+    {
+        // Take the place of other in the output's users, keeping their order
+        std::replace(m_output->m_inputs.begin(), m_output->m_inputs.end(), &other, this);
+        other.m_output = nullptr;
+    }
+}
+
 descriptor::Input::~Input()
 {
     remove_output();
@@ -57,6 +75,7 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    m_node->mark_validation_dirty();
 
     if (getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK"))
     {
@@ -32,6 +32,7 @@ namespace ngraph
         class NGRAPH_API Input
         {
             friend class ngraph::Node;
+            friend class Output;
 
         public:
             /// \param node The node that owns this input
@@ -100,7 +101,9 @@ namespace ngraph
             const element::Type& get_element_type() const;
 
             Input(const Input&) = default;
-            Input(Input&&) = default;
+            /// \brief Moves the input and updates the connected output to refer to the new
+            ///        location, so that nodes can keep their inputs in a vector.
+            Input(Input&& other) noexcept;
             Input& operator=(const Input&) = default;
 
         protected:
@@ -30,6 +30,19 @@ descriptor::Output::Output(Node* node, size_t index, const shared_ptr<Tensor>& t
 {
 }
 
+descriptor::Output::Output(Output&& other) noexcept
+    : m_node(other.m_node)
+    , m_index(other.m_index)
+    , m_tensor(move(other.m_tensor))
+    , m_inputs(move(other.m_inputs))
+{
+    other.m_inputs.clear();
+    for (Input* input : m_inputs)
+    {
+        input->m_output = this;
+    }
+}
+
 // Add an input to the vector of inputs that use this output.
 void descriptor::Output::add_input(Input* input)
 {
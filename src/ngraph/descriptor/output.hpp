@@ -24,7 +24,7 @@
 
 namespace ngraph
 {
-    // The forward declaration of Node is needed here because Node has a deque of
+    // The forward declaration of Node is needed here because Node has a vector of
     // Outputs, and Output is an incomplete type at this point. STL containers of
     // incomplete type have undefined behavior according to the C++11 standard, and
     // in practice including node.hpp here was causing compilation errors on some
@@ -36,6 +36,8 @@ namespace ngraph
         // Describes an output tensor of an op
         class NGRAPH_API Output
         {
+            friend class Input;
+
         public:
             /// \param node Node that owns this output.
             /// \param index Position of the output tensor in all output tensors
@@ -61,7 +63,9 @@ namespace ngraph
             const element::Type& get_element_type() const;
 
             Output(const Output&) = default;
-            Output(Output&&) = default;
+            /// \brief Moves the output and updates the connected inputs to refer to the new
+            ///        location, so that nodes can keep their outputs in a vector.
+            Output(Output&& other) noexcept;
             Output& operator=(const Output&) = default;
 
         protected:
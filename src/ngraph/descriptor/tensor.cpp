@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "ngraph/descriptor/tensor.hpp"
+#include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
 #include "ngraph/node.hpp"
 
@@ -49,6 +50,15 @@ void descriptor::Tensor::set_tensor_type(const element::Type& element_type,
     NGRAPH_CHECK(pshape.all_non_negative(),
                  "set_tensor_type called on a PartialShape containing negative dimensions: ",
                  pshape);
+    // Users of this value have to be revalidated when its type changes
+    if (m_node != nullptr && m_node_output_number < m_node->get_output_size() &&
+        (m_element_type != element_type || !m_partial_shape.same_scheme(pshape)))
+    {
+        for (descriptor::Input* input : m_node->get_output_inputs(m_node_output_number))
+        {
+            input->get_raw_pointer_node()->mark_validation_dirty();
+        }
+    }
     if (pshape.is_static())
     {
         m_shape = pshape.to_shape();
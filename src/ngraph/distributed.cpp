@@ -16,6 +16,7 @@
 
 #include "ngraph/distributed.hpp"
 #include "ngraph/distributed/null.hpp"
+#include "ngraph/distributed/shared_memory.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/type.hpp"
 
@@ -54,8 +55,17 @@ DistributedInterface* ngraph::get_distributed_interface()
 {
     if (nullptr == s_distributed_interface)
     {
-        set_distributed_interface(std::unique_ptr<DistributedInterface>(
-            new ngraph::distributed::NullDistributedInterface()));
+        auto shared_memory_interface =
+            ngraph::distributed::SharedMemoryDistributedInterface::create_from_env();
+        if (shared_memory_interface)
+        {
+            set_distributed_interface(std::move(shared_memory_interface));
+        }
+        else
+        {
+            set_distributed_interface(std::unique_ptr<DistributedInterface>(
+                new ngraph::distributed::NullDistributedInterface()));
+        }
     }
     return s_distributed_interface.get();
 }
@@ -0,0 +1,573 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/check.hpp"
+#include "ngraph/distributed/shared_memory.hpp"
+#include "ngraph/env_util.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/thread_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr size_t distributed::SharedMemoryDistributedInterface::s_default_slot_bytes;
+constexpr size_t distributed::SharedMemoryDistributedInterface::s_tree_threshold_bytes;
+
+static const uint64_t s_segment_magic = 0x6e67726170687368; // "ngraphsh"
+static const size_t s_cache_line = 64;
+// Reductions shorter than this run on the calling thread only
+static const size_t s_min_elements_per_thread = 65536;
+// How long a rank waits for the others to attach to the segment
+static const chrono::seconds s_attach_timeout{120};
+
+// The segment is zero filled on creation, which is a valid initial state for all of these.
+struct distributed::SharedMemoryDistributedInterface::Header
+{
+    atomic<uint64_t> magic;
+    atomic<uint32_t> num_attached;
+    // Set by rank 0 once every rank is attached and the name has been unlinked
+    atomic<uint32_t> attach_complete;
+    atomic<uint32_t> barrier_count;
+    atomic<uint32_t> barrier_generation;
+};
+
+// Point-to-point channel from one rank to another. The sender publishes a chunk in its slot
+// by bumping sent, the receiver releases the slot by setting acked to the same value.
+struct alignas(64) distributed::SharedMemoryDistributedInterface::Mailbox
+{
+    atomic<uint64_t> sent;
+    atomic<uint64_t> acked;
+};
+
+static size_t round_up(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+template <typename PREDICATE>
+static void spin_until(PREDICATE predicate)
+{
+    for (size_t spins = 0; !predicate(); spins++)
+    {
+        if (spins > 1000)
+        {
+            this_thread::yield();
+        }
+    }
+}
+
+template <typename T>
+static void reduce_range(
+    T* out, const T* in, reduction::Type reduce_type, size_t begin, size_t end)
+{
+    switch (reduce_type)
+    {
+    case reduction::Type::SUM:
+        for (size_t i = begin; i < end; i++)
+        {
+            out[i] += in[i];
+        }
+        break;
+    case reduction::Type::PROD:
+        for (size_t i = begin; i < end; i++)
+        {
+            out[i] *= in[i];
+        }
+        break;
+    case reduction::Type::MIN:
+        for (size_t i = begin; i < end; i++)
+        {
+            out[i] = std::min(out[i], in[i]);
+        }
+        break;
+    case reduction::Type::MAX:
+        for (size_t i = begin; i < end; i++)
+        {
+            out[i] = std::max(out[i], in[i]);
+        }
+        break;
+    }
+}
+
+template <typename T>
+static void reduce_typed(void* out,
+                         const void* in,
+                         reduction::Type reduce_type,
+                         size_t count,
+                         size_t num_threads)
+{
+    T* typed_out = static_cast<T*>(out);
+    const T* typed_in = static_cast<const T*>(in);
+    if (num_threads <= 1 || count < 2 * s_min_elements_per_thread)
+    {
+        reduce_range(typed_out, typed_in, reduce_type, 0, count);
+        return;
+    }
+    ThreadPool::get_shared().parallel_for(
+        count, s_min_elements_per_thread, num_threads, [&](size_t begin, size_t end) {
+            reduce_range(typed_out, typed_in, reduce_type, begin, end);
+        });
+}
+
+#if defined(__linux__)
+enum class SegmentLink
+{
+    MISSING,
+    SAME,
+    REPLACED
+};
+
+// Whether name still refers to the segment described by mapped
+static SegmentLink get_segment_link(const string& name, const struct stat& mapped)
+{
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0)
+    {
+        return SegmentLink::MISSING;
+    }
+    struct stat linked;
+    bool same = fstat(fd, &linked) == 0 && linked.st_dev == mapped.st_dev &&
+                linked.st_ino == mapped.st_ino;
+    close(fd);
+    return same ? SegmentLink::SAME : SegmentLink::REPLACED;
+}
+#endif
+
+distributed::SharedMemoryDistributedInterface::SharedMemoryDistributedInterface(
+    const string& name, int size, int rank, size_t slot_bytes, size_t num_reduce_threads)
+    : m_segment_name("/ngraph_shm_" + name)
+    , m_size(size)
+    , m_rank(rank)
+    , m_slot_bytes(round_up(slot_bytes, s_cache_line))
+    , m_num_reduce_threads(std::max<size_t>(1, num_reduce_threads))
+{
+    NGRAPH_CHECK(size > 0 && rank >= 0 && rank < size,
+                 "Invalid rank ",
+                 rank,
+                 " for ",
+                 size,
+                 " shared memory ranks");
+    NGRAPH_CHECK(name.find('/') == string::npos, "Shared memory name may not contain '/'");
+    NGRAPH_CHECK(m_slot_bytes > 0, "Shared memory slots must not be empty");
+#if defined(__linux__)
+    m_segment_bytes = round_up(sizeof(Header), s_cache_line) + size * size * sizeof(Mailbox) +
+                      size * m_slot_bytes;
+
+    auto deadline = chrono::steady_clock::now() + s_attach_timeout;
+    auto check_deadline = [&](const char* what) {
+        if (chrono::steady_clock::now() > deadline)
+        {
+            throw ngraph_error(string("Timed out waiting for ") + what + " " + m_segment_name);
+        }
+    };
+    auto map_segment = [&](int fd) {
+        void* segment =
+            mmap(nullptr, m_segment_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (segment == MAP_FAILED)
+        {
+            throw ngraph_error("Failed to map shared memory segment " + m_segment_name);
+        }
+        m_segment = static_cast<char*>(segment);
+        return reinterpret_cast<Header*>(m_segment);
+    };
+
+    // The destructor does not run for a constructor that throws, so the mapping and, on rank
+    // 0, the name of the segment are released here
+    bool created = false;
+    try
+    {
+        if (rank == 0)
+        {
+            // Remove a segment left behind by a job that did not shut down cleanly
+            shm_unlink(m_segment_name.c_str());
+            int fd = shm_open(m_segment_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+            if (fd < 0)
+            {
+                throw ngraph_error("Failed to create shared memory segment " + m_segment_name);
+            }
+            created = true;
+            if (ftruncate(fd, m_segment_bytes) != 0)
+            {
+                close(fd);
+                throw ngraph_error("Failed to create shared memory segment " + m_segment_name);
+            }
+            Header* header = map_segment(fd);
+            header->magic.store(s_segment_magic, memory_order_release);
+            header->num_attached.fetch_add(1, memory_order_acq_rel);
+            while (header->num_attached.load(memory_order_acquire) < static_cast<uint32_t>(size))
+            {
+                check_deadline("all ranks to attach to");
+                this_thread::sleep_for(chrono::microseconds(100));
+            }
+            // Every rank holds a mapping now, so the name is no longer needed. Unlinking before
+            // attach_complete is set means a segment that is still linked is never complete.
+            shm_unlink(m_segment_name.c_str());
+            header->attach_complete.store(1, memory_order_release);
+        }
+        else
+        {
+            // A segment left behind by an earlier job stays linked until rank 0 replaces it, so
+            // a rank only counts itself on a segment while the name still refers to it, and
+            // starts over if the name moves to a new segment before rank 0 completes the attach.
+            while (!m_segment)
+            {
+                int fd = shm_open(m_segment_name.c_str(), O_RDWR, 0);
+                struct stat segment_stat;
+                if (fd < 0 || fstat(fd, &segment_stat) != 0 ||
+                    static_cast<size_t>(segment_stat.st_size) != m_segment_bytes)
+                {
+                    if (fd >= 0)
+                    {
+                        close(fd);
+                    }
+                    check_deadline("shared memory segment");
+                    this_thread::sleep_for(chrono::milliseconds(1));
+                    continue;
+                }
+
+                Header* header = map_segment(fd);
+                bool attached = false;
+                while (!header->attach_complete.load(memory_order_acquire))
+                {
+                    SegmentLink link = get_segment_link(m_segment_name, segment_stat);
+                    if (link == SegmentLink::REPLACED)
+                    {
+                        munmap(m_segment, m_segment_bytes);
+                        m_segment = nullptr;
+                        break;
+                    }
+                    if (!attached && link == SegmentLink::SAME &&
+                        header->magic.load(memory_order_acquire) == s_segment_magic)
+                    {
+                        header->num_attached.fetch_add(1, memory_order_acq_rel);
+                        attached = true;
+                    }
+                    check_deadline("all ranks to attach to");
+                    this_thread::sleep_for(chrono::microseconds(100));
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        if (m_segment)
+        {
+            munmap(m_segment, m_segment_bytes);
+            m_segment = nullptr;
+        }
+        if (created)
+        {
+            shm_unlink(m_segment_name.c_str());
+        }
+        throw;
+    }
+#else
+    throw ngraph_error("Shared memory distributed interface is not supported on this platform");
+#endif
+}
+
+distributed::SharedMemoryDistributedInterface::~SharedMemoryDistributedInterface()
+{
+#if defined(__linux__)
+    if (m_segment)
+    {
+        munmap(m_segment, m_segment_bytes);
+    }
+    if (m_rank == 0)
+    {
+        shm_unlink(m_segment_name.c_str());
+    }
+#endif
+}
+
+unique_ptr<DistributedInterface> distributed::SharedMemoryDistributedInterface::create_from_env()
+{
+    int size = getenv_int("NGRAPH_DISTRIBUTED_SHM_SIZE", 0);
+    if (size <= 0)
+    {
+        return nullptr;
+    }
+    int rank = getenv_int("NGRAPH_DISTRIBUTED_SHM_RANK", 0);
+    string name = getenv_string("NGRAPH_DISTRIBUTED_SHM_NAME");
+    int num_reduce_threads = getenv_int("NGRAPH_DISTRIBUTED_SHM_REDUCE_THREADS", 0);
+    if (num_reduce_threads <= 0)
+    {
+        num_reduce_threads = static_cast<int>(ThreadPool::get_shared().get_max_threads()) / size;
+    }
+    return unique_ptr<DistributedInterface>(
+        new SharedMemoryDistributedInterface(name.empty() ? "default" : name,
+                                             size,
+                                             rank,
+                                             s_default_slot_bytes,
+                                             static_cast<size_t>(max(num_reduce_threads, 1))));
+}
+
+char* distributed::SharedMemoryDistributedInterface::get_slot(int rank) const
+{
+    return m_segment + round_up(sizeof(Header), s_cache_line) +
+           m_size * m_size * sizeof(Mailbox) + rank * m_slot_bytes;
+}
+
+distributed::SharedMemoryDistributedInterface::Mailbox&
+    distributed::SharedMemoryDistributedInterface::get_mailbox(int src, int dest) const
+{
+    auto mailboxes =
+        reinterpret_cast<Mailbox*>(m_segment + round_up(sizeof(Header), s_cache_line));
+    return mailboxes[src * m_size + dest];
+}
+
+void distributed::SharedMemoryDistributedInterface::barrier()
+{
+    Header* header = reinterpret_cast<Header*>(m_segment);
+    uint32_t generation = header->barrier_generation.load(memory_order_acquire);
+    if (header->barrier_count.fetch_add(1, memory_order_acq_rel) ==
+        static_cast<uint32_t>(m_size - 1))
+    {
+        header->barrier_count.store(0, memory_order_relaxed);
+        header->barrier_generation.fetch_add(1, memory_order_acq_rel);
+    }
+    else
+    {
+        spin_until([&]() {
+            return header->barrier_generation.load(memory_order_acquire) != generation;
+        });
+    }
+}
+
+void distributed::SharedMemoryDistributedInterface::log_print(const string& timestamp,
+                                                              const vector<char>& buf)
+{
+    std::printf("%s [SHM %d]: %s\n", timestamp.c_str(), m_rank, buf.data());
+}
+
+void distributed::SharedMemoryDistributedInterface::reduce(char* out,
+                                                           const char* in,
+                                                           element::Type_t element_type,
+                                                           reduction::Type reduce_type,
+                                                           size_t count) const
+{
+    switch (element_type)
+    {
+    case element::Type_t::f32:
+        reduce_typed<float>(out, in, reduce_type, count, m_num_reduce_threads);
+        break;
+    case element::Type_t::f64:
+        reduce_typed<double>(out, in, reduce_type, count, m_num_reduce_threads);
+        break;
+    case element::Type_t::i8:
+        reduce_typed<int8_t>(out, in, reduce_type, count, m_num_reduce_threads);
+        break;
+    case element::Type_t::i16:
+        reduce_typed<int16_t>(out, in, reduce_type, count, m_num_reduce_threads);
+        break;
+    case element::Type_t::i32:
+        reduce_typed<int32_t>(out, in, reduce_type, count, m_num_reduce_threads);
+        break;
+    case element::Type_t::i64:
+        reduce_typed<int64_t>(out, in, reduce_type, count, m_num_reduce_threads);
+        break;
+    case element::Type_t::u8:
+        reduce_typed<uint8_t>(out, in, reduce_type, count, m_num_reduce_threads);
+        break;
+    case element::Type_t::u16:
+        reduce_typed<uint16_t>(out, in, reduce_type, count, m_num_reduce_threads);
+        break;
+    case element::Type_t::u32:
+        reduce_typed<uint32_t>(out, in, reduce_type, count, m_num_reduce_threads);
+        break;
+    case element::Type_t::u64:
+        reduce_typed<uint64_t>(out, in, reduce_type, count, m_num_reduce_threads);
+        break;
+    case element::Type_t::undefined:
+    case element::Type_t::dynamic:
+    case element::Type_t::boolean:
+    case element::Type_t::bf16:
+    case element::Type_t::f16:
+    case element::Type_t::u1:
+        throw ngraph_error("Shared memory all_reduce does not support element type " +
+                           element::Type(element_type).get_type_name());
+    }
+}
+
+void distributed::SharedMemoryDistributedInterface::reduce_scatter_all_reduce_chunk(
+    char* out,
+    element::Type_t element_type,
+    reduction::Type reduce_type,
+    size_t count,
+    size_t element_size)
+{
+    // Reduce-scatter: every rank reduces its own partition of the chunk straight from the
+    // slots of all other ranks and leaves the result in the same partition of its own slot.
+    // Starting at the next rank spreads the reads of different ranks over different slots.
+    auto partition_begin = [&](int rank) { return count * rank / m_size * element_size; };
+    size_t begin = partition_begin(m_rank);
+    size_t end = partition_begin(m_rank + 1);
+    char* own = get_slot(m_rank);
+    for (int step = 1; step < m_size; step++)
+    {
+        int peer = (m_rank + step) % m_size;
+        reduce(own + begin,
+               get_slot(peer) + begin,
+               element_type,
+               reduce_type,
+               (end - begin) / element_size);
+    }
+    barrier();
+
+    // All-gather: collect every reduced partition from the slot of the rank that owns it
+    for (int rank = 0; rank < m_size; rank++)
+    {
+        size_t rank_begin = partition_begin(rank);
+        memcpy(out + rank_begin,
+               get_slot(rank) + rank_begin,
+               partition_begin(rank + 1) - rank_begin);
+    }
+}
+
+void distributed::SharedMemoryDistributedInterface::tree_all_reduce_chunk(
+    char* out,
+    element::Type_t element_type,
+    reduction::Type reduce_type,
+    size_t count,
+    size_t element_size)
+{
+    // Binomial tree reduction into the slot of rank 0
+    for (int distance = 1; distance < m_size; distance *= 2)
+    {
+        if (m_rank % (2 * distance) == 0 && m_rank + distance < m_size)
+        {
+            reduce(get_slot(m_rank), get_slot(m_rank + distance), element_type, reduce_type, count);
+        }
+        barrier();
+    }
+    memcpy(out, get_slot(0), count * element_size);
+}
+
+void distributed::SharedMemoryDistributedInterface::all_reduce(void* in,
+                                                               void* out,
+                                                               element::Type_t element_type,
+                                                               reduction::Type reduce_type,
+                                                               size_t count)
+{
+    size_t element_size = element::Type(element_type).size();
+    size_t chunk_elements = m_slot_bytes / element_size;
+    bool use_tree = m_algorithm == AllReduceAlgorithm::TREE ||
+                    (m_algorithm == AllReduceAlgorithm::AUTO &&
+                     count * element_size <= s_tree_threshold_bytes);
+    for (size_t offset = 0; offset < count; offset += chunk_elements)
+    {
+        size_t chunk_count = std::min(chunk_elements, count - offset);
+        size_t byte_offset = offset * element_size;
+        memcpy(get_slot(m_rank), static_cast<char*>(in) + byte_offset, chunk_count * element_size);
+        barrier();
+        if (use_tree)
+        {
+            tree_all_reduce_chunk(static_cast<char*>(out) + byte_offset,
+                                  element_type,
+                                  reduce_type,
+                                  chunk_count,
+                                  element_size);
+        }
+        else
+        {
+            reduce_scatter_all_reduce_chunk(static_cast<char*>(out) + byte_offset,
+                                            element_type,
+                                            reduce_type,
+                                            chunk_count,
+                                            element_size);
+        }
+        // The slots are overwritten by the next chunk only after every rank has read them
+        barrier();
+    }
+}
+
+void distributed::SharedMemoryDistributedInterface::broadcast(void* in,
+                                                              element::Type_t element_type,
+                                                              size_t count,
+                                                              int root_id)
+{
+    NGRAPH_CHECK(root_id >= 0 && root_id < m_size, "Invalid broadcast root ", root_id);
+    size_t bytes = count * element::Type(element_type).size();
+    for (size_t offset = 0; offset < bytes; offset += m_slot_bytes)
+    {
+        size_t chunk_bytes = std::min(m_slot_bytes, bytes - offset);
+        if (m_rank == root_id)
+        {
+            memcpy(get_slot(root_id), static_cast<char*>(in) + offset, chunk_bytes);
+        }
+        barrier();
+        if (m_rank != root_id)
+        {
+            memcpy(static_cast<char*>(in) + offset, get_slot(root_id), chunk_bytes);
+        }
+        barrier();
+    }
+}
+
+void distributed::SharedMemoryDistributedInterface::send(const void* in,
+                                                         element::Type_t element_type,
+                                                         size_t count,
+                                                         int dest_id)
+{
+    NGRAPH_CHECK(dest_id >= 0 && dest_id < m_size && dest_id != m_rank,
+                 "Invalid send destination ",
+                 dest_id);
+    Mailbox& mailbox = get_mailbox(m_rank, dest_id);
+    size_t bytes = count * element::Type(element_type).size();
+    for (size_t offset = 0; offset < bytes; offset += m_slot_bytes)
+    {
+        size_t chunk_bytes = std::min(m_slot_bytes, bytes - offset);
+        memcpy(get_slot(m_rank), static_cast<const char*>(in) + offset, chunk_bytes);
+        uint64_t sequence = mailbox.sent.load(memory_order_relaxed) + 1;
+        mailbox.sent.store(sequence, memory_order_release);
+        spin_until([&]() { return mailbox.acked.load(memory_order_acquire) == sequence; });
+    }
+}
+
+void distributed::SharedMemoryDistributedInterface::recv(void* in,
+                                                         element::Type_t element_type,
+                                                         size_t count,
+                                                         int src_id)
+{
+    NGRAPH_CHECK(src_id >= 0 && src_id < m_size && src_id != m_rank,
+                 "Invalid receive source ",
+                 src_id);
+    Mailbox& mailbox = get_mailbox(src_id, m_rank);
+    size_t bytes = count * element::Type(element_type).size();
+    for (size_t offset = 0; offset < bytes; offset += m_slot_bytes)
+    {
+        size_t chunk_bytes = std::min(m_slot_bytes, bytes - offset);
+        uint64_t acked = mailbox.acked.load(memory_order_relaxed);
+        spin_until([&]() { return mailbox.sent.load(memory_order_acquire) != acked; });
+        memcpy(static_cast<char*>(in) + offset, get_slot(src_id), chunk_bytes);
+        mailbox.acked.store(acked + 1, memory_order_release);
+    }
+}
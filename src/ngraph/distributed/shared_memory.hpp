@@ -0,0 +1,143 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "ngraph/distributed.hpp"
+
+namespace ngraph
+{
+    namespace distributed
+    {
+        /// \brief DistributedInterface for ranks running on one host, as separate processes or
+        ///        as threads of one process.
+        ///
+        /// All ranks attach to the same POSIX shared memory segment (under /dev/shm), which
+        /// holds a staging slot per rank. Collectives move data through the slots in chunks
+        /// of at most slot_bytes and synchronize with barriers in the segment, so no MPI or
+        /// MLSL installation is needed.
+        ///
+        /// The constructor blocks until all ranks have attached. The segment name must be
+        /// unique to the job; it is unlinked as soon as every rank is attached.
+        class SharedMemoryDistributedInterface : public DistributedInterface
+        {
+        public:
+            enum class AllReduceAlgorithm
+            {
+                /// Tree for small messages, reduce-scatter otherwise
+                AUTO,
+                /// Direct reduce-scatter followed by all-gather: every rank reads its 1/size
+                /// of the data from all other slots at once, which makes best use of memory
+                /// bandwidth for large messages
+                REDUCE_SCATTER,
+                /// Pairwise reduction in log2(size) steps; fewest data passes for small
+                /// messages
+                TREE
+            };
+
+            static constexpr size_t s_default_slot_bytes = 16 * 1024 * 1024;
+            static constexpr size_t s_tree_threshold_bytes = 64 * 1024;
+
+            /// \param name Name of the shared memory segment, identical on all ranks
+            /// \param size Number of ranks
+            /// \param rank Rank of the caller in [0, size)
+            /// \param slot_bytes Staging buffer size per rank; larger messages are chunked
+            /// \param num_reduce_threads Threads each rank uses to reduce its share of a chunk
+            SharedMemoryDistributedInterface(const std::string& name,
+                                             int size,
+                                             int rank,
+                                             size_t slot_bytes = s_default_slot_bytes,
+                                             size_t num_reduce_threads = 1);
+            ~SharedMemoryDistributedInterface() override;
+
+            /// \brief Creates an interface from NGRAPH_DISTRIBUTED_SHM_NAME,
+            ///        NGRAPH_DISTRIBUTED_SHM_SIZE and NGRAPH_DISTRIBUTED_SHM_RANK, or returns
+            ///        null if NGRAPH_DISTRIBUTED_SHM_SIZE is not set.
+            ///
+            /// Each rank reduces with NGRAPH_DISTRIBUTED_SHM_REDUCE_THREADS threads, by default
+            /// an equal share of the shared ThreadPool, since all ranks run on the same host.
+            static std::unique_ptr<DistributedInterface> create_from_env();
+
+            const std::string& get_name() const override { return m_name; }
+            int get_size() override { return m_size; }
+            int get_rank() override { return m_rank; }
+            void log_print(const std::string& timestamp, const std::vector<char>& buf) override;
+
+            void all_reduce(void* in,
+                            void* out,
+                            element::Type_t element_type,
+                            reduction::Type reduce_type,
+                            size_t count) override;
+            void broadcast(void* in,
+                           element::Type_t element_type,
+                           size_t count,
+                           int root_id) override;
+            void recv(void* in, element::Type_t element_type, size_t count, int src_id) override;
+            void send(const void* in,
+                      element::Type_t element_type,
+                      size_t count,
+                      int dest_id) override;
+
+            void set_all_reduce_algorithm(AllReduceAlgorithm algorithm)
+            {
+                m_algorithm = algorithm;
+            }
+            size_t get_num_reduce_threads() const { return m_num_reduce_threads; }
+
+            /// \brief Blocks until every rank has reached the barrier
+            void barrier();
+
+        private:
+            struct Header;
+            struct Mailbox;
+
+            SharedMemoryDistributedInterface(const SharedMemoryDistributedInterface&) = delete;
+            SharedMemoryDistributedInterface&
+                operator=(const SharedMemoryDistributedInterface&) = delete;
+
+            char* get_slot(int rank) const;
+            Mailbox& get_mailbox(int src, int dest) const;
+            void reduce(char* out,
+                        const char* in,
+                        element::Type_t element_type,
+                        reduction::Type reduce_type,
+                        size_t count) const;
+            void reduce_scatter_all_reduce_chunk(char* out,
+                                                 element::Type_t element_type,
+                                                 reduction::Type reduce_type,
+                                                 size_t count,
+                                                 size_t element_size);
+            void tree_all_reduce_chunk(char* out,
+                                       element::Type_t element_type,
+                                       reduction::Type reduce_type,
+                                       size_t count,
+                                       size_t element_size);
+
+            std::string m_name{"SHM"};
+            std::string m_segment_name;
+            int m_size;
+            int m_rank;
+            size_t m_slot_bytes;
+            size_t m_num_reduce_threads;
+            AllReduceAlgorithm m_algorithm = AllReduceAlgorithm::AUTO;
+            size_t m_segment_bytes = 0;
+            char* m_segment = nullptr;
+        };
+    }
+}
@@ -19,6 +19,7 @@
 #include <sstream>
 
 #include "graph.hpp"
+#include "ngraph/thread_pool.hpp"
 #include "node.hpp"
 #include "provenance.hpp"
 #include "utils/common.hpp"
@@ -91,22 +92,58 @@ namespace ngraph
                 return std::string{"<ONNX " + onnx_node.op_type() + " (" + node_name + "-> " +
                                    output_names + ")>"};
             }
+
+            /// \brief Converts initializers to Constants on the shared thread pool.
+            ///
+            /// Large models spend most of their import time copying initializer data, and each
+            /// initializer is independent of the others. The pool hands out one initializer at
+            /// a time, so a few large tensors do not serialize the rest, and rethrows the
+            /// exception of the first failing initializer in graph order, as a serial
+            /// conversion would.
+            static std::vector<std::shared_ptr<ngraph::op::Constant>>
+                convert_initializers(const std::vector<const onnx::TensorProto*>& initializers)
+            {
+                std::vector<std::shared_ptr<ngraph::op::Constant>> constants(
+                    initializers.size());
+                auto& pool = ThreadPool::get_shared();
+                pool.parallel_for(initializers.size(), pool.get_max_threads(), [&](size_t i) {
+                    constants[i] = Tensor{*initializers[i]}.get_ng_constant();
+                });
+                return constants;
+            }
         } // namespace detail
 
-        Graph::Graph(const onnx::GraphProto& graph_proto, Model& model)
+        Graph::Graph(
+            const onnx::GraphProto& graph_proto,
+            Model& model,
+            const std::map<std::string, std::shared_ptr<default_opset::Constant>>& initializers)
             : m_graph_proto{&graph_proto}
             , m_model{&model}
         {
             // Process all initializers in the graph
+            std::vector<const onnx::TensorProto*> unconverted_initializers;
+            for (const auto& initializer_tensor : m_graph_proto->initializer())
+            {
+                if (initializer_tensor.has_name() &&
+                    initializers.count(initializer_tensor.name()) == 0)
+                {
+                    unconverted_initializers.push_back(&initializer_tensor);
+                }
+            }
+            // For each initializer, create a Constant node and store in cache
+            auto ng_constants = initializers;
+            auto converted = detail::convert_initializers(unconverted_initializers);
+            for (std::size_t i{0}; i < unconverted_initializers.size(); ++i)
+            {
+                ng_constants.emplace(unconverted_initializers[i]->name(), std::move(converted[i]));
+            }
             for (const auto& initializer_tensor : m_graph_proto->initializer())
             {
                 if (initializer_tensor.has_name())
                 {
                     Tensor tensor = Tensor{initializer_tensor};
                     m_initializers.emplace(initializer_tensor.name(), tensor);
-
-                    // For each initializer, create a Constant node and store in cache
-                    auto ng_constant = tensor.get_ng_constant();
+                    auto ng_constant = ng_constants.at(initializer_tensor.name());
                     add_provenance_tag_to_initializer(tensor, ng_constant);
                     m_ng_node_cache.emplace(initializer_tensor.name(), std::move(ng_constant));
                 }
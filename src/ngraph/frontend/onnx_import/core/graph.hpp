@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <string>
 #include <vector>
@@ -33,7 +35,13 @@ namespace ngraph
         class Graph
         {
         public:
-            Graph(const onnx::GraphProto& proto, Model& model);
+            /// \param initializers Constants already created for some of the initializers of
+            ///        proto, by name. The data of those initializers is not read, so it may have
+            ///        been cleared from proto.
+            Graph(const onnx::GraphProto& proto,
+                  Model& model,
+                  const std::map<std::string, std::shared_ptr<default_opset::Constant>>&
+                      initializers = {});
             const std::vector<Node>& get_nodes() const { return m_nodes; }
             const std::vector<ValueInfo>& get_inputs() const { return m_inputs; }
             const std::vector<ValueInfo>& get_outputs() const { return m_outputs; }
@@ -454,6 +454,18 @@ namespace ngraph
             operator TensorProto_DataType() const { return m_tensor_proto->data_type(); }
             std::shared_ptr<ngraph::op::Constant> get_ng_constant() const
             {
+                // Raw data is already laid out like the Constant's buffer, so it is copied
+                // once instead of going through a std::vector
+                if (m_tensor_proto->has_raw_data() && !m_tensor_proto->has_segment())
+                {
+                    const element::Type& type = get_ng_type();
+                    const std::string& raw_data = m_tensor_proto->raw_data();
+                    if (raw_data.size() == shape_size(m_shape) * type.size())
+                    {
+                        return std::make_shared<ngraph::op::Constant>(
+                            type, m_shape, static_cast<const void*>(raw_data.data()));
+                    }
+                }
                 switch (m_tensor_proto->data_type())
                 {
                 case onnx::TensorProto_DataType::TensorProto_DataType_BOOL:
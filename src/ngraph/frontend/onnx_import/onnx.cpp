@@ -14,9 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <climits>
 #include <fstream>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include <google/protobuf/text_format.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <memory>
 
 #include "core/graph.hpp"
@@ -50,6 +54,129 @@ namespace ngraph
                 };
 
             } // namespace error
+
+            using ConstantMap = std::map<std::string, std::shared_ptr<default_opset::Constant>>;
+
+            std::shared_ptr<Function> make_function(const onnx::ModelProto& model_proto,
+                                                    const ConstantMap& initializers = {})
+            {
+                Model model{model_proto};
+                Graph graph{model_proto.graph(), model, initializers};
+                auto function = std::make_shared<Function>(
+                    graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
+                for (std::size_t i{0}; i < function->get_output_size(); ++i)
+                {
+                    function->get_output_op(i)->set_friendly_name(
+                        graph.get_outputs().at(i).get_name());
+                }
+                return function;
+            }
+
+            using google::protobuf::internal::WireFormatLite;
+
+            bool is_message_field(std::uint32_t tag, int field_number)
+            {
+                return WireFormatLite::GetTagFieldNumber(tag) == field_number &&
+                       WireFormatLite::GetTagWireType(tag) ==
+                           WireFormatLite::WIRETYPE_LENGTH_DELIMITED;
+            }
+
+            /// \brief Reads the fields of one message up to the current limit of input.
+            ///
+            /// Embedded messages in field_number are passed to parse_field with the limit set
+            /// to their extent. All other fields are copied to other_fields, to be merged into
+            /// the message once they have been read.
+            template <typename ParseField>
+            bool read_fields(google::protobuf::io::CodedInputStream& input,
+                             int field_number,
+                             ParseField parse_field,
+                             std::string& other_fields)
+            {
+                google::protobuf::io::StringOutputStream output_stream{&other_fields};
+                google::protobuf::io::CodedOutputStream output{&output_stream};
+                while (std::uint32_t tag = input.ReadTag())
+                {
+                    if (is_message_field(tag, field_number))
+                    {
+                        std::uint32_t length;
+                        if (!input.ReadVarint32(&length))
+                        {
+                            return false;
+                        }
+                        auto limit = input.PushLimit(static_cast<int>(length));
+                        if (!parse_field(input) || !input.ConsumedEntireMessage())
+                        {
+                            return false;
+                        }
+                        input.PopLimit(limit);
+                    }
+                    else if (!WireFormatLite::SkipField(&input, tag, &output))
+                    {
+                        return false;
+                    }
+                }
+                return input.ConsumedEntireMessage();
+            }
+
+            /// \brief Reads a GraphProto, converting every initializer to a Constant as soon
+            ///        as it has been read. Only the name, type and shape of the initializers
+            ///        are kept in graph_proto.
+            bool read_graph(google::protobuf::io::CodedInputStream& input,
+                            onnx::GraphProto& graph_proto,
+                            ConstantMap& initializers)
+            {
+                auto read_initializer = [&](google::protobuf::io::CodedInputStream& field) {
+                    onnx::TensorProto tensor_proto;
+                    if (!tensor_proto.ParseFromCodedStream(&field))
+                    {
+                        return false;
+                    }
+                    if (tensor_proto.has_name())
+                    {
+                        initializers.emplace(tensor_proto.name(),
+                                             Tensor{tensor_proto}.get_ng_constant());
+                    }
+                    onnx::TensorProto* header = graph_proto.add_initializer();
+                    header->set_name(tensor_proto.name());
+                    header->set_data_type(tensor_proto.data_type());
+                    *header->mutable_dims() = tensor_proto.dims();
+                    return true;
+                };
+                std::string other_fields;
+                if (!read_fields(input,
+                                 onnx::GraphProto::kInitializerFieldNumber,
+                                 read_initializer,
+                                 other_fields))
+                {
+                    return false;
+                }
+                return graph_proto.MergeFromString(other_fields);
+            }
+
+            bool read_model(std::istream& sin,
+                            onnx::ModelProto& model_proto,
+                            ConstantMap& initializers)
+            {
+                google::protobuf::io::IstreamInputStream input_stream{&sin};
+                google::protobuf::io::CodedInputStream input{&input_stream};
+#if GOOGLE_PROTOBUF_VERSION < 3006000
+                input.SetTotalBytesLimit(INT_MAX, INT_MAX);
+#else
+                input.SetTotalBytesLimit(INT_MAX);
+#endif
+                auto read_model_graph = [&](google::protobuf::io::CodedInputStream& field) {
+                    return read_graph(field, *model_proto.mutable_graph(), initializers);
+                };
+                std::string other_fields;
+                if (!read_fields(input,
+                                 onnx::ModelProto::kGraphFieldNumber,
+                                 read_model_graph,
+                                 other_fields))
+                {
+                    return false;
+                }
+                return model_proto.MergeFromString(other_fields);
+            }
         }     // namespace detail
 
         std::shared_ptr<Function> import_onnx_model(std::istream& sin)
@@ -69,15 +196,7 @@ namespace ngraph
                 }
             }
 
-            Model model{model_proto};
-            Graph graph{model_proto.graph(), model};
-            auto function = std::make_shared<Function>(
-                graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
-            for (std::size_t i{0}; i < function->get_output_size(); ++i)
-            {
-                function->get_output_op(i)->set_friendly_name(graph.get_outputs().at(i).get_name());
-            }
-            return function;
+            return detail::make_function(model_proto);
         }
 
         std::shared_ptr<Function> import_onnx_model(const std::string& path)
@@ -90,6 +209,27 @@ namespace ngraph
             return import_onnx_model(ifs);
         }
 
+        std::shared_ptr<Function> import_onnx_model_streaming(std::istream& sin)
+        {
+            onnx::ModelProto model_proto;
+            detail::ConstantMap initializers;
+            if (!detail::read_model(sin, model_proto, initializers))
+            {
+                throw detail::error::stream_parse{sin};
+            }
+            return detail::make_function(model_proto, initializers);
+        }
+
+        std::shared_ptr<Function> import_onnx_model_streaming(const std::string& path)
+        {
+            std::ifstream ifs{path, std::ios::in | std::ios::binary};
+            if (!ifs.is_open())
+            {
+                throw detail::error::file_open{path};
+            }
+            return import_onnx_model_streaming(ifs);
+        }
+
         void register_operator(const std::string& name,
                                std::int64_t version,
                                const std::string& domain,
@@ -82,6 +82,25 @@ namespace ngraph
         NGRAPH_API
         std::shared_ptr<Function> import_onnx_model(const std::string& filename);
 
+        /// \brief Convert an ONNX model to nGraph function, reading it incrementally
+        /// Unlike import_onnx_model, the serialized model is never held in memory as a whole.
+        /// Each initializer is converted to a Constant as soon as it has been read, and its
+        /// data is released before the next one is read, so peak memory stays close to the
+        /// size of the resulting constants. Initializers are therefore converted one after
+        /// the other, not in parallel like import_onnx_model does, so this import is usually
+        /// slower. Only binary protobuf input is supported.
+        /// \param sin       input stream (e.g. file stream, memory stream, etc)
+        /// \return The function returns a nGraph function representing single output from graph.
+        NGRAPH_API
+        std::shared_ptr<Function> import_onnx_model_streaming(std::istream& sin);
+
+        /// \brief Convert an ONNX model file to nGraph function, reading it incrementally
+        /// \sa import_onnx_model_streaming(std::istream&)
+        /// \param filename  file name (relative or absolute path name)
+        /// \return The function returns a nGraph function representing single output from graph.
+        NGRAPH_API
+        std::shared_ptr<Function> import_onnx_model_streaming(const std::string& filename);
+
     } // namespace onnx_import
 
 } // namespace ngraph
@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "ngraph/function.hpp"
+#include "ngraph/env_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/util.hpp"
@@ -84,6 +85,20 @@ void Function::validate_nodes_and_infer_types()
     }
 }
 
+void Function::validate_dirty_nodes_and_infer_types()
+{
+    static const bool s_full_revalidation = getenv_bool("NGRAPH_FULL_REVALIDATION");
+    if (s_full_revalidation)
+    {
+        validate_nodes_and_infer_types();
+        return;
+    }
+    for (auto& node : get_ordered_ops())
+    {
+        node->revalidate_and_infer_types_if_dirty();
+    }
+}
+
 void Function::init()
 {
     validate_nodes_and_infer_types();
@@ -105,6 +105,12 @@ namespace ngraph
 
         void validate_nodes_and_infer_types();
 
+        /// \brief Revalidates only the nodes that are dirty (see Node::is_validation_dirty).
+        ///        A node whose output types change marks its users dirty, so changes propagate
+        ///        through the topological walk. Setting NGRAPH_FULL_REVALIDATION makes this
+        ///        revalidate every node, like validate_nodes_and_infer_types.
+        void validate_dirty_nodes_and_infer_types();
+
         /// \brief Returns the sum of the size of all nodes in the graph plus the size of
         /// all constant data. This has little value beyond comparing the relative size of
         /// graphs and should not be considered the actual memory consumption of a graph.
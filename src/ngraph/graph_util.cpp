@@ -292,52 +292,61 @@ bool ngraph::is_post_dominated(Node* X, Node* Y)
     return true;
 }
 
+// Clones node onto the already cloned values of its inputs and control dependencies. The
+// clone shares the op annotations and the rt_info of the original; the rt_info map is copied
+// by the first write to it on either node.
+static shared_ptr<Node> clone_node_with_mapped_inputs(const shared_ptr<Node>& node,
+                                                      const NodeMap& node_map)
+{
+    // get (already) cloned arguments and clone the node
+    OutputVector cloned_args;
+    cloned_args.reserve(node->get_input_size());
+    for (auto input : node->inputs())
+    {
+        Output<Node> output = input.get_source_output();
+        cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
+    }
+    std::vector<std::shared_ptr<Node>> cloned_dependencies;
+    for (auto& dependency : node->get_control_dependencies())
+    {
+        const shared_ptr<Node>& dependent = node_map.at(dependency.get());
+        if (find(cloned_dependencies.begin(), cloned_dependencies.end(), dependent) ==
+            cloned_dependencies.end())
+        {
+            cloned_dependencies.push_back(dependent);
+        }
+    }
+    auto cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
+    if (node->get_friendly_name() != node->get_name())
+    {
+        // There is a friendly name for this node so copy it
+        cloned_node->set_friendly_name(node->get_friendly_name());
+    }
+
+    cloned_node->add_provenance_tags(node->get_provenance_tags());
+    cloned_node->set_op_annotations(node->get_op_annotations());
+    cloned_node->share_rt_info(*node);
+    return cloned_node;
+}
+
 std::vector<std::shared_ptr<ngraph::Node>>
     ngraph::clone_nodes(const std::vector<std::shared_ptr<ngraph::Node>>& nodes, NodeMap& node_map)
 {
     // for each node in topological order
     auto sorted_nodes = topological_sort(nodes);
+    node_map.reserve(node_map.size() + sorted_nodes.size());
     for (auto node : sorted_nodes)
     {
         if (node_map.count(node.get()) == 0)
         {
-            // get (already) cloned arguments and clone the node
-            OutputVector cloned_args;
-            for (auto input : node->inputs())
-            {
-                Output<Node> output = input.get_source_output();
-                cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
-            }
-            std::vector<std::shared_ptr<Node>> cloned_dependencies;
-            for (auto& dependency : node->get_control_dependencies())
-            {
-                shared_ptr<Node>& dependent = node_map.at(dependency.get());
-                if (find(cloned_dependencies.begin(), cloned_dependencies.end(), dependent) ==
-                    cloned_dependencies.end())
-                {
-                    cloned_dependencies.push_back(dependent);
-                }
-            }
-            auto cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
-            if (node->get_friendly_name() != node->get_name())
-            {
-                // There is a friendly name for this node so copy it
-                cloned_node->set_friendly_name(node->get_friendly_name());
-            }
-
-            for (auto tag : node->get_provenance_tags())
-            {
-                cloned_node->add_provenance_tag(tag);
-            }
-            cloned_node->set_op_annotations(node->get_op_annotations());
-
-            node_map[node.get()] = cloned_node;
+            node_map[node.get()] = clone_node_with_mapped_inputs(node, node_map);
         }
     }
 
     // create and return vector of cloned nodes
     // order matches input vector (not necessarily topological)
     std::vector<std::shared_ptr<ngraph::Node>> cloned_nodes;
+    cloned_nodes.reserve(nodes.size());
     for (auto node : nodes)
     {
         cloned_nodes.push_back(node_map.at(node.get()));
@@ -418,8 +427,17 @@ std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function&
 std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function& func,
                                                          NodeMap& node_map)
 {
-    // clone function operations
-    clone_nodes(func.get_ops(), node_map);
+    // clone function operations; get_ordered_ops() is already in topological order, so the
+    // ops are not sorted a second time as clone_nodes would do
+    auto ordered_ops = func.get_ordered_ops();
+    node_map.reserve(node_map.size() + ordered_ops.size());
+    for (auto& node : ordered_ops)
+    {
+        if (node_map.count(node.get()) == 0)
+        {
+            node_map[node.get()] = clone_node_with_mapped_inputs(node, node_map);
+        }
+    }
 
     // get cloned function results and parameters
     ResultVector cloned_results;
@@ -439,6 +457,8 @@ std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function&
     }
 
     // create and return cloned function
+    // Not every op is fully typed by its constructor (TensorIterator's body and v1::TopK's index
+    // type are set after construction), so the Function constructor revalidates the clone.
     return std::make_shared<ngraph::Function>(cloned_results, cloned_params);
 }
 
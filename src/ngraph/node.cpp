@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <typeindex>
 #include <typeinfo>
@@ -35,6 +36,20 @@ using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
 
+// Every node of a type has the same type name, so each name is only stored once
+static const string* intern_node_type(const string& node_type)
+{
+    static mutex s_mutex;
+    // Never freed so that nodes in static storage may outlive it
+    static unordered_set<string>* s_node_types = new unordered_set<string>();
+    lock_guard<mutex> lock(s_mutex);
+    return &*s_node_types->insert(node_type).first;
+}
+
+static const unordered_set<string> s_no_provenance_tags;
+static const set<shared_ptr<Node>> s_no_provenance_group;
+static const Node::RTMap s_no_rt_info;
+
 Node::Node(size_t output_size)
     : Node()
 {
@@ -42,7 +57,7 @@ Node::Node(size_t output_size)
 }
 
 Node::Node(const std::string& node_type, const NodeVector& arguments, size_t output_size)
-    : m_node_type(node_type)
+    : m_node_type(node_type.empty() ? nullptr : intern_node_type(node_type))
 {
     set_arguments(arguments);
     set_output_size(output_size);
@@ -182,6 +197,7 @@ void Node::set_arguments(const NodeVector& arguments)
 void Node::set_arguments(const OutputVector& arguments)
 {
     // Add this node as a user of each argument.
+    m_inputs.reserve(m_inputs.size() + arguments.size());
     size_t i = 0;
     for (auto& output : arguments)
     {
@@ -227,21 +243,38 @@ void Node::set_argument(size_t position, const Output<Node>& argument)
 void Node::constructor_validate_and_infer_types()
 {
 #ifdef IN_TRANSITION
-    validate_and_infer_types();
+    revalidate_and_infer_types();
 #endif
 }
 
 void Node::delayed_validate_and_infer_types()
 {
 #ifndef IN_TRANSITION
-    validate_and_infer_types();
+    revalidate_and_infer_types();
 #endif
 }
 #undef IN_TRANSITION
 
+void Node::revalidate_and_infer_types()
+{
+    validate_and_infer_types();
+    m_validation_dirty = false;
+}
+
+bool Node::revalidate_and_infer_types_if_dirty()
+{
+    if (!m_validation_dirty)
+    {
+        return false;
+    }
+    revalidate_and_infer_types();
+    return true;
+}
+
 void Node::set_output_size(size_t n)
 {
     NGRAPH_CHECK(n >= m_outputs.size(), "shrinking ", m_outputs.size(), " to ", n);
+    m_outputs.reserve(n);
     for (size_t i = m_outputs.size(); i < n; ++i)
     {
         // create the descriptors
@@ -276,12 +309,12 @@ void Node::set_output_type(size_t i, const element::Type& element_type, const Pa
     get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
 }
 
-std::deque<descriptor::Output>& Node::get_outputs()
+std::vector<descriptor::Output>& Node::get_outputs()
 {
     return m_outputs;
 }
 
-const std::deque<descriptor::Output>& Node::get_outputs() const
+const std::vector<descriptor::Output>& Node::get_outputs() const
 {
     return m_outputs;
 }
@@ -298,14 +331,14 @@ bool Node::is_constant() const
 
 const std::string& Node::description() const
 {
-    if (m_node_type.size() == 0)
+    if (m_node_type == nullptr)
     {
         // Terrible transitional kludge to keep description working while we change
         // type_name to const_char and virtual description() to virtual get_type_name()
-        const_cast<Node*>(this)->m_node_type = get_type_name();
+        const_cast<Node*>(this)->m_node_type = intern_node_type(get_type_name());
     }
 
-    return m_node_type;
+    return *m_node_type;
 }
 
 const std::string& Node::get_friendly_name() const
@@ -351,14 +384,44 @@ void Node::set_placement_index(size_t placement)
     m_placement_index = placement;
 }
 
+Node::RTMap& Node::get_rt_info()
+{
+    if (!m_rt_info)
+    {
+        m_rt_info = std::make_shared<RTMap>();
+    }
+    else if (m_rt_info.use_count() > 1)
+    {
+        m_rt_info = std::make_shared<RTMap>(*m_rt_info);
+    }
+    return *m_rt_info;
+}
+
+const Node::RTMap& Node::get_rt_info() const
+{
+    return m_rt_info ? *m_rt_info : s_no_rt_info;
+}
+
+void Node::share_rt_info(const Node& node)
+{
+    m_rt_info = node.m_rt_info;
+}
+
 void Node::add_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.insert(node);
+    if (!m_provenance_group)
+    {
+        m_provenance_group.reset(new set<shared_ptr<Node>>());
+    }
+    m_provenance_group->insert(node);
 }
 
 void Node::remove_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.erase(node);
+    if (m_provenance_group)
+    {
+        m_provenance_group->erase(node);
+    }
 }
 
 void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
@@ -377,7 +440,7 @@ void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
 
 const set<shared_ptr<Node>>& Node::get_provenance_group_members() const
 {
-    return m_provenance_group;
+    return m_provenance_group ? *m_provenance_group : s_no_provenance_group;
 }
 
 shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& base)
@@ -409,7 +472,7 @@ shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& ba
         add_provenance_group_member(node->shared_from_this());
         for (auto value : node->input_values())
         {
-            if (m_provenance_group.count(value.get_node_shared_ptr()) == 0)
+            if (m_provenance_group->count(value.get_node_shared_ptr()) == 0)
             {
                 todo.push_back(value.get_node());
             }
@@ -447,13 +510,17 @@ void Node::add_provenance_tags_above(const OutputVector& base,
 
 const std::unordered_set<std::string>& Node::get_provenance_tags() const
 {
-    return m_provenance_tags;
+    return m_provenance_tags ? *m_provenance_tags : s_no_provenance_tags;
 }
 
 void Node::add_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.insert(tag);
-    for (auto node : m_provenance_group)
+    if (!m_provenance_tags)
+    {
+        m_provenance_tags.reset(new unordered_set<string>());
+    }
+    m_provenance_tags->insert(tag);
+    for (auto node : get_provenance_group_members())
     {
         node->add_provenance_tag(tag);
     }
@@ -461,7 +528,10 @@ void Node::add_provenance_tag(const std::string& tag)
 
 void Node::remove_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.erase(tag);
+    if (m_provenance_tags)
+    {
+        m_provenance_tags->erase(tag);
+    }
 }
 
 void Node::merge_provenance_tags_from(const std::shared_ptr<const Node>& source)
@@ -201,7 +201,18 @@ namespace ngraph
         /// Sets the number of outputs
         void set_output_size(size_t output_size);
 
-        void revalidate_and_infer_types() { validate_and_infer_types(); }
+        /// \brief Validates the node and infers its output types, and clears the dirty flag.
+        void revalidate_and_infer_types();
+        /// \brief Revalidates the node only if it is dirty.
+        /// \returns true if the node was revalidated.
+        bool revalidate_and_infer_types_if_dirty();
+        /// \brief A node is dirty until it has been validated, and again whenever one of its
+        ///        inputs is connected to a different output, the element type or shape of an
+        ///        input changes, or one of its attributes is set.
+        bool is_validation_dirty() const { return m_validation_dirty; }
+        /// \brief Marks the node as dirty. Attribute setters of the ops call this; code that
+        ///        changes type-relevant state of a node in any other way must call it too.
+        void mark_validation_dirty() { m_validation_dirty = true; }
         // Called after transition
         void delayed_validate_and_infer_types();
 
@@ -279,17 +290,17 @@ namespace ngraph
         /// \returns The stream os
         virtual std::ostream& write_description(std::ostream& os, uint32_t depth = 0) const;
 
-        std::deque<descriptor::Input>& get_inputs() NGRAPH_DEPRECATED("use inputs() instead")
+        std::vector<descriptor::Input>& get_inputs() NGRAPH_DEPRECATED("use inputs() instead")
         {
             return m_inputs;
         }
-        const std::deque<descriptor::Input>& get_inputs() const
+        const std::vector<descriptor::Input>& get_inputs() const
             NGRAPH_DEPRECATED("use inputs() instead")
         {
             return m_inputs;
         }
-        std::deque<descriptor::Output>& get_outputs() NGRAPH_DEPRECATED("use outputs() instead");
-        const std::deque<descriptor::Output>& get_outputs() const
+        std::vector<descriptor::Output>& get_outputs() NGRAPH_DEPRECATED("use outputs() instead");
+        const std::vector<descriptor::Output>& get_outputs() const
             NGRAPH_DEPRECATED("use outputs() instead");
 
         /// Get control dependencies registered on the node
@@ -437,8 +448,14 @@ namespace ngraph
 
         using RTMap = std::map<std::string, std::shared_ptr<Variant>>;
 
-        RTMap& get_rt_info() { return m_rt_info; }
-        const RTMap& get_rt_info() const { return m_rt_info; }
+        /// \brief Runtime info of the node. The map is only allocated once it is accessed
+        ///        through the non-const accessor, which also copies a map shared with
+        ///        share_rt_info. A reference obtained before sharing must not be written to.
+        RTMap& get_rt_info();
+        const RTMap& get_rt_info() const;
+        /// \brief Shares the runtime info of node with this node until either of them
+        ///        writes to it through the non-const get_rt_info().
+        void share_rt_info(const Node& node);
         const std::unordered_set<std::string>& get_provenance_tags() const;
         void add_provenance_tag(const std::string& tag);
         template <typename T>
@@ -537,20 +554,25 @@ namespace ngraph
 
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
-        std::string m_node_type;
+        // Interned; shared by all nodes with the same type name
+        const std::string* m_node_type{nullptr};
         size_t m_instance_id{m_next_instance_id.fetch_add(1)};
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
-        std::unordered_set<std::string> m_provenance_tags;
-        std::set<std::shared_ptr<Node>> m_provenance_group;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
-        std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
+        // Most nodes have no provenance or rt_info, so these are allocated on first use
+        std::unique_ptr<std::unordered_set<std::string>> m_provenance_tags;
+        std::unique_ptr<std::set<std::shared_ptr<Node>>> m_provenance_group;
+        // Inputs and outputs are referenced by address from the other end of their
+        // connection; their move constructors keep those references up to date
+        std::vector<descriptor::Input> m_inputs;
+        std::vector<descriptor::Output> m_outputs;
         Placement m_placement = Placement::DEFAULT;
         size_t m_placement_index = placement_invalid;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
-        std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
+        // Shared with clones until one of them writes to it
+        std::shared_ptr<RTMap> m_rt_info;
+        bool m_validation_dirty{true};
     };
 
     using NodeTypeInfo = Node::type_info_t;
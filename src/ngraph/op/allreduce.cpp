@@ -63,4 +63,5 @@ reduction::Type op::AllReduce::get_reduce_type() const
 void op::AllReduce::set_reduce_type(reduction::Type reduce_type)
 {
     m_reduce_type = reduce_type;
+    mark_validation_dirty();
 }
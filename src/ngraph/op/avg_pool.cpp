@@ -165,6 +165,7 @@ const Shape& op::v0::AvgPool::get_window_shape() const
 void op::v0::AvgPool::set_window_shape(const Shape& window_shape)
 {
     m_window_shape = window_shape;
+    mark_validation_dirty();
 }
 
 const Strides& op::v0::AvgPool::get_window_movement_strides() const
@@ -175,6 +176,7 @@ const Strides& op::v0::AvgPool::get_window_movement_strides() const
 void op::v0::AvgPool::set_window_movement_strides(const Strides& window_movement_strides)
 {
     m_window_movement_strides = window_movement_strides;
+    mark_validation_dirty();
 }
 
 const Shape& op::v0::AvgPool::get_padding_below() const
@@ -185,6 +187,7 @@ const Shape& op::v0::AvgPool::get_padding_below() const
 void op::v0::AvgPool::set_padding_below(const Shape& padding_below)
 {
     m_padding_below = padding_below;
+    mark_validation_dirty();
 }
 
 const Shape& op::v0::AvgPool::get_padding_above() const
@@ -195,6 +198,7 @@ const Shape& op::v0::AvgPool::get_padding_above() const
 void op::v0::AvgPool::set_padding_above(const Shape& padding_above)
 {
     m_padding_above = padding_above;
+    mark_validation_dirty();
 }
 
 bool op::v0::AvgPool::get_include_padding_in_avg_computation() const
@@ -206,6 +210,7 @@ void op::v0::AvgPool::set_include_padding_in_avg_computation(
     bool include_padding_in_avg_computation)
 {
     m_include_padding_in_avg_computation = include_padding_in_avg_computation;
+    mark_validation_dirty();
 }
 
 const op::PadType& op::v0::AvgPool::get_pad_type() const
@@ -216,6 +221,7 @@ const op::PadType& op::v0::AvgPool::get_pad_type() const
 void op::v0::AvgPool::set_pad_type(const op::PadType& pad_type)
 {
     m_pad_type = pad_type;
+    mark_validation_dirty();
 }
 
 bool op::v0::AvgPool::get_ceil_mode() const
@@ -226,6 +232,7 @@ bool op::v0::AvgPool::get_ceil_mode() const
 void op::v0::AvgPool::set_ceil_mode(bool ceil_mode)
 {
     m_ceil_mode = ceil_mode;
+    mark_validation_dirty();
 }
 
 shared_ptr<Node> op::v0::AvgPool::copy_with_new_args(const NodeVector& new_args) const
@@ -319,6 +326,7 @@ const Shape& op::v0::AvgPoolBackprop::get_forward_arg_shape() const
 void op::v0::AvgPoolBackprop::set_forward_arg_shape(const Shape& forward_arg_shape)
 {
     m_forward_arg_shape = forward_arg_shape;
+    mark_validation_dirty();
 }
 
 const Shape& op::v0::AvgPoolBackprop::get_window_shape() const
@@ -329,6 +337,7 @@ const Shape& op::v0::AvgPoolBackprop::get_window_shape() const
 void op::v0::AvgPoolBackprop::set_window_shape(const Shape& window_shape)
 {
     m_window_shape = window_shape;
+    mark_validation_dirty();
 }
 
 const Strides& op::v0::AvgPoolBackprop::get_window_movement_strides() const
@@ -339,6 +348,7 @@ const Strides& op::v0::AvgPoolBackprop::get_window_movement_strides() const
 void op::v0::AvgPoolBackprop::set_window_movement_strides(const Strides& window_movement_strides)
 {
     m_window_movement_strides = window_movement_strides;
+    mark_validation_dirty();
 }
 
 const Shape& op::v0::AvgPoolBackprop::get_padding_below() const
@@ -349,6 +359,7 @@ const Shape& op::v0::AvgPoolBackprop::get_padding_below() const
 void op::v0::AvgPoolBackprop::set_padding_below(const Shape& padding_below)
 {
     m_padding_below = padding_below;
+    mark_validation_dirty();
 }
 
 const Shape& op::v0::AvgPoolBackprop::get_padding_above() const
@@ -359,6 +370,7 @@ const Shape& op::v0::AvgPoolBackprop::get_padding_above() const
 void op::v0::AvgPoolBackprop::set_padding_above(const Shape& padding_above)
 {
     m_padding_above = padding_above;
+    mark_validation_dirty();
 }
 
 bool op::v0::AvgPoolBackprop::get_include_padding_in_avg_computation() const
@@ -370,6 +382,7 @@ void op::v0::AvgPoolBackprop::set_include_padding_in_avg_computation(
     bool include_padding_in_avg_computation)
 {
     m_include_padding_in_avg_computation = include_padding_in_avg_computation;
+    mark_validation_dirty();
 }
 
 shared_ptr<Node> op::v0::AvgPoolBackprop::copy_with_new_args(const NodeVector& new_args) const
@@ -519,6 +532,7 @@ const Shape& op::v1::AvgPool::get_kernel() const
 void op::v1::AvgPool::set_kernel(const Shape& kernel)
 {
     m_kernel = kernel;
+    mark_validation_dirty();
 }
 
 const Strides& op::v1::AvgPool::get_strides() const
@@ -529,6 +543,7 @@ const Strides& op::v1::AvgPool::get_strides() const
 void op::v1::AvgPool::set_strides(const Strides& strides)
 {
     m_strides = strides;
+    mark_validation_dirty();
 }
 
 const Shape& op::v1::AvgPool::get_pads_begin() const
@@ -539,6 +554,7 @@ const Shape& op::v1::AvgPool::get_pads_begin() const
 void op::v1::AvgPool::set_pads_begin(const Shape& pads_begin)
 {
     m_pads_begin = pads_begin;
+    mark_validation_dirty();
 }
 
 const Shape& op::v1::AvgPool::get_pads_end() const
@@ -549,6 +565,7 @@ const Shape& op::v1::AvgPool::get_pads_end() const
 void op::v1::AvgPool::set_pads_end(const Shape& pads_end)
 {
     m_pads_end = pads_end;
+    mark_validation_dirty();
 }
 
 bool op::v1::AvgPool::get_exclude_pad() const
@@ -559,6 +576,7 @@ bool op::v1::AvgPool::get_exclude_pad() const
 void op::v1::AvgPool::set_exclude_pad(bool exclude_pad)
 {
     m_exclude_pad = exclude_pad;
+    mark_validation_dirty();
 }
 
 const op::PadType& op::v1::AvgPool::get_auto_pad() const
@@ -569,6 +587,7 @@ const op::PadType& op::v1::AvgPool::get_auto_pad() const
 void op::v1::AvgPool::set_auto_pad(const op::PadType& auto_pad)
 {
     m_auto_pad = auto_pad;
+    mark_validation_dirty();
 }
 
 op::RoundingType op::v1::AvgPool::get_rounding_type() const
@@ -579,6 +598,7 @@ op::RoundingType op::v1::AvgPool::get_rounding_type() const
 void op::v1::AvgPool::set_rounding_type(op::RoundingType rounding_type)
 {
     m_rounding_type = rounding_type;
+    mark_validation_dirty();
 }
 
 shared_ptr<Node> op::v1::AvgPool::copy_with_new_args(const NodeVector& new_args) const
@@ -674,6 +694,7 @@ const Shape& op::v1::AvgPoolBackprop::get_kernel() const
 void op::v1::AvgPoolBackprop::set_kernel(const Shape& kernel)
 {
     m_kernel = kernel;
+    mark_validation_dirty();
 }
 
 const Strides& op::v1::AvgPoolBackprop::get_strides() const
@@ -684,6 +705,7 @@ const Strides& op::v1::AvgPoolBackprop::get_strides() const
 void op::v1::AvgPoolBackprop::set_strides(const Strides& strides)
 {
     m_strides = strides;
+    mark_validation_dirty();
 }
 
 const Shape& op::v1::AvgPoolBackprop::get_pads_begin() const
@@ -694,6 +716,7 @@ const Shape& op::v1::AvgPoolBackprop::get_pads_begin() const
 void op::v1::AvgPoolBackprop::set_pads_begin(const Shape& pads_begin)
 {
     m_pads_begin = pads_begin;
+    mark_validation_dirty();
 }
 
 const Shape& op::v1::AvgPoolBackprop::get_pads_end() const
@@ -704,6 +727,7 @@ const Shape& op::v1::AvgPoolBackprop::get_pads_end() const
 void op::v1::AvgPoolBackprop::set_pads_end(const Shape& pads_end)
 {
     m_pads_end = pads_end;
+    mark_validation_dirty();
 }
 
 bool op::v1::AvgPoolBackprop::get_exclude_pad() const
@@ -714,6 +738,7 @@ bool op::v1::AvgPoolBackprop::get_exclude_pad() const
 void op::v1::AvgPoolBackprop::set_exclude_pad(bool exclude_pad)
 {
     m_exclude_pad = exclude_pad;
+    mark_validation_dirty();
 }
 
 shared_ptr<Node> op::v1::AvgPoolBackprop::copy_with_new_args(const NodeVector& new_args) const
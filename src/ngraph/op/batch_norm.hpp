@@ -76,7 +76,7 @@ namespace ngraph
                 void validate_and_infer_types() override;
 
                 double get_eps_value() const { return m_epsilon; }
-                void set_eps_value(double epsilon) { m_epsilon = epsilon; }
+                void set_eps_value(double epsilon) { m_epsilon = epsilon; mark_validation_dirty(); }
                 virtual std::shared_ptr<Node>
                     copy_with_new_args(const NodeVector& new_args) const override;
 
@@ -143,7 +143,7 @@ namespace ngraph
                 void validate_and_infer_types() override;
 
                 double get_eps_value() const { return m_epsilon; }
-                void set_eps_value(double epsilon) { m_epsilon = epsilon; }
+                void set_eps_value(double epsilon) { m_epsilon = epsilon; mark_validation_dirty(); }
                 virtual std::shared_ptr<Node>
                     copy_with_new_args(const NodeVector& new_args) const override;
 
@@ -193,7 +193,7 @@ namespace ngraph
                 void validate_and_infer_types() override;
 
                 double get_eps_value() const { return m_epsilon; }
-                void set_eps_value(double epsilon) { m_epsilon = epsilon; }
+                void set_eps_value(double epsilon) { m_epsilon = epsilon; mark_validation_dirty(); }
                 virtual std::shared_ptr<Node>
                     copy_with_new_args(const NodeVector& new_args) const override;
 
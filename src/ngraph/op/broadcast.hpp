@@ -56,9 +56,14 @@ namespace ngraph
                 void set_broadcast_axes(const AxisSet& broadcast_axes)
                 {
                     m_broadcast_axes = broadcast_axes;
+                    mark_validation_dirty();
                 }
                 const Shape& get_broadcast_shape() const { return m_shape; }
-                void set_broadcast_shape(const Shape& shape) { m_shape = shape; }
+                void set_broadcast_shape(const Shape& shape)
+                {
+                    m_shape = shape;
+                    mark_validation_dirty();
+                }
             protected:
                 Broadcast(const OutputVector& args,
                           const Shape& shape,
@@ -104,6 +109,7 @@ namespace ngraph
                 void set_initial_broadcast_axes(const AxisSet& initial_broadcast_axes)
                 {
                     m_initial_broadcast_axes = initial_broadcast_axes;
+                    mark_validation_dirty();
                 }
 
             protected:
@@ -163,6 +169,7 @@ namespace ngraph
                 void set_broadcast_spec(const AutoBroadcastSpec& broadcast_spec)
                 {
                     m_broadcast_spec = broadcast_spec;
+                    mark_validation_dirty();
                 }
 
                 /// \return true and the AxisSet if broadcast axes can be fully determined.
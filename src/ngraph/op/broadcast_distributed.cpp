@@ -62,4 +62,5 @@ int64_t op::BroadcastDistributed::get_root_id() const
 void op::BroadcastDistributed::set_root_id(int64_t root_id)
 {
     m_root_id = root_id;
+    mark_validation_dirty();
 }
@@ -57,10 +57,11 @@ namespace ngraph
                 void set_concatenation_axis(int64_t concatenation_axis)
                 {
                     m_concat_axis = concatenation_axis;
+                    mark_validation_dirty();
                 }
                 /// \return The concatenation axis.
                 int64_t get_axis() const { return m_axis; }
-                void set_axis(int64_t axis) { m_axis = axis; }
+                void set_axis(int64_t axis) { m_axis = axis; mark_validation_dirty(); }
             protected:
                 virtual void generate_adjoints(autodiff::Adjoints& adjoints,
                                                const OutputVector& deltas) override;
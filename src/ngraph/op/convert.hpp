@@ -46,12 +46,14 @@ namespace ngraph
                 void set_destination_type(const element::Type& destination_type)
                 {
                     m_destination_type = destination_type;
+                    mark_validation_dirty();
                 }
 
                 const element::Type& get_convert_element_type() const { return m_destination_type; }
                 void set_convert_element_type(const element::Type& destination_type)
                 {
                     m_destination_type = destination_type;
+                    mark_validation_dirty();
                 }
 
             protected:
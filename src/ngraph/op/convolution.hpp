@@ -72,19 +72,39 @@ namespace ngraph
 
                 /// \return The strides.
                 const Strides& get_strides() const { return m_strides; }
-                void set_strides(const Strides& strides) { m_strides = strides; }
+                void set_strides(const Strides& strides)
+                {
+                    m_strides = strides;
+                    mark_validation_dirty();
+                }
                 /// \return The dilations.
                 const Strides& get_dilations() const { return m_dilations; }
-                void set_dilations(const Strides& dilations) { m_dilations = dilations; }
+                void set_dilations(const Strides& dilations)
+                {
+                    m_dilations = dilations;
+                    mark_validation_dirty();
+                }
                 /// \return The padding-below sizes (possibly negative).
                 const CoordinateDiff& get_pads_begin() const { return m_pads_begin; }
-                void set_pads_begin(const CoordinateDiff& pads_begin) { m_pads_begin = pads_begin; }
+                void set_pads_begin(const CoordinateDiff& pads_begin)
+                {
+                    m_pads_begin = pads_begin;
+                    mark_validation_dirty();
+                }
                 /// \return The padding-above sizes (possibly negative).
                 const CoordinateDiff& get_pads_end() const { return m_pads_end; }
-                void set_adding_above(const CoordinateDiff& pads_end) { m_pads_end = pads_end; }
+                void set_adding_above(const CoordinateDiff& pads_end)
+                {
+                    m_pads_end = pads_end;
+                    mark_validation_dirty();
+                }
                 /// \return The pad type for convolution.
                 const PadType& get_auto_pad() const { return m_auto_pad; }
-                void set_auto_pad(const PadType& auto_pad) { m_auto_pad = auto_pad; }
+                void set_auto_pad(const PadType& auto_pad)
+                {
+                    m_auto_pad = auto_pad;
+                    mark_validation_dirty();
+                }
                 /// \return The default value for Convolution.
                 virtual std::shared_ptr<Node> get_default_value() const override;
 
@@ -171,24 +191,45 @@ namespace ngraph
                 void set_output_shape(const Shape& output_shape);
                 /// \return The strides from the forward prop.
                 const Strides& get_strides() const { return m_strides; }
-                void set_strides(const Strides& strides) { m_strides = strides; }
+                void set_strides(const Strides& strides)
+                {
+                    m_strides = strides;
+                    mark_validation_dirty();
+                }
                 /// \return The dilations from the forward prop.
                 const Strides& get_dilations() const { return m_dilations; }
-                void set_dilations(const Strides& dilations) { m_dilations = dilations; }
+                void set_dilations(const Strides& dilations)
+                {
+                    m_dilations = dilations;
+                    mark_validation_dirty();
+                }
                 /// \return The padding-below sizes (possibly negative) from the forward prop.
                 const CoordinateDiff& get_pads_begin() const { return m_pads_begin; }
-                void set_pads_begin(const CoordinateDiff& pads_begin) { m_pads_begin = pads_begin; }
+                void set_pads_begin(const CoordinateDiff& pads_begin)
+                {
+                    m_pads_begin = pads_begin;
+                    mark_validation_dirty();
+                }
                 /// \return The padding-above sizes (possibly negative) from the forward prop.
                 const CoordinateDiff& get_pads_end() const { return m_pads_end; }
-                void set_pads_end(const CoordinateDiff& pads_end) { m_pads_end = pads_end; }
+                void set_pads_end(const CoordinateDiff& pads_end)
+                {
+                    m_pads_end = pads_end;
+                    mark_validation_dirty();
+                }
                 /// \return The auto pad.
                 const PadType& get_auto_pad() const { return m_auto_pad; }
-                void set_auto_pad(const PadType& auto_pad) { m_auto_pad = auto_pad; }
+                void set_auto_pad(const PadType& auto_pad)
+                {
+                    m_auto_pad = auto_pad;
+                    mark_validation_dirty();
+                }
                 /// \return The output padding.
                 const CoordinateDiff& get_output_padding() const { return m_output_padding; }
                 void set_output_padding(const CoordinateDiff& output_padding)
                 {
                     m_output_padding = output_padding;
+                    mark_validation_dirty();
                 }
 
             protected:
@@ -235,16 +276,32 @@ namespace ngraph
                 const Shape get_filters_shape() const;
                 /// \return The strides from the forward prop.
                 const Strides& get_strides() const { return m_strides; }
-                void set_strides(const Strides& strides) { m_strides = strides; }
+                void set_strides(const Strides& strides)
+                {
+                    m_strides = strides;
+                    mark_validation_dirty();
+                }
                 /// \return The dilations from the forward prop.
                 const Strides& get_dilations() const { return m_dilations; }
-                void set_dilations(const Strides& dilations) { m_dilations = dilations; }
+                void set_dilations(const Strides& dilations)
+                {
+                    m_dilations = dilations;
+                    mark_validation_dirty();
+                }
                 /// \return The padding-below sizes (possibly negative) from the forward prop.
                 const CoordinateDiff& get_pads_begin() const { return m_pads_begin; }
-                void set_pads_begin(const CoordinateDiff& pads_begin) { m_pads_begin = pads_begin; }
+                void set_pads_begin(const CoordinateDiff& pads_begin)
+                {
+                    m_pads_begin = pads_begin;
+                    mark_validation_dirty();
+                }
                 /// \return The padding-above sizes (possibly negative) from the forward prop.
                 const CoordinateDiff& get_pads_end() const { return m_pads_end; }
-                void set_pads_end(const CoordinateDiff& pads_end) { m_pads_end = pads_end; }
+                void set_pads_end(const CoordinateDiff& pads_end)
+                {
+                    m_pads_end = pads_end;
+                    mark_validation_dirty();
+                }
                 // Compute the pad_above value to be used if in a convolution
                 CoordinateDiff compute_backward_in_pad_above() const;
 
@@ -392,6 +449,7 @@ namespace ngraph
                 void set_window_movement_strides(const Strides& window_movement_strides)
                 {
                     m_window_movement_strides = window_movement_strides;
+                    mark_validation_dirty();
                 }
                 /// \return The window dilation strides.
                 const Strides& get_window_dilation_strides() const
@@ -401,28 +459,36 @@ namespace ngraph
                 void set_window_dilation_strides(const Strides& window_dilation_strides)
                 {
                     m_window_dilation_strides = window_dilation_strides;
+                    mark_validation_dirty();
                 }
                 /// \return The padding-below sizes (possibly negative).
                 const CoordinateDiff& get_padding_below() const { return m_padding_below; }
                 void set_padding_below(const CoordinateDiff& padding_below)
                 {
                     m_padding_below = padding_below;
+                    mark_validation_dirty();
                 }
                 /// \return The padding-above sizes (possibly negative).
                 const CoordinateDiff& get_padding_above() const { return m_padding_above; }
                 void set_adding_above(const CoordinateDiff& padding_above)
                 {
                     m_padding_above = padding_above;
+                    mark_validation_dirty();
                 }
                 /// \return The input data dilation strides.
                 const Strides& get_data_dilation_strides() const { return m_data_dilation_strides; }
                 void set_data_dilation_strides(const Strides& data_dilation_strides)
                 {
                     m_data_dilation_strides = data_dilation_strides;
+                    mark_validation_dirty();
                 }
                 /// \return The pad type for convolution.
                 const PadType& get_pad_type() const { return m_pad_type; }
-                void set_pad_type(const PadType& pad_type) { m_pad_type = pad_type; }
+                void set_pad_type(const PadType& pad_type)
+                {
+                    m_pad_type = pad_type;
+                    mark_validation_dirty();
+                }
                 /// \return The default value for Convolution.
                 virtual std::shared_ptr<Node> get_default_value() const override;
 
@@ -484,6 +550,7 @@ namespace ngraph
                 void set_data_batch_shape(const Shape& data_batch_shape)
                 {
                     m_data_batch_shape = data_batch_shape;
+                    mark_validation_dirty();
                 }
                 /// \return The window movement strides from the forward prop.
                 const Strides& get_window_movement_strides_forward() const
@@ -494,6 +561,7 @@ namespace ngraph
                     const Strides& window_movement_strides_forward)
                 {
                     m_window_movement_strides_forward = window_movement_strides_forward;
+                    mark_validation_dirty();
                 }
                 /// \return The window dilation strides from the forward prop.
                 const Strides& get_window_dilation_strides_forward() const
@@ -504,6 +572,7 @@ namespace ngraph
                     const Strides& window_dilation_strides_forward)
                 {
                     m_window_dilation_strides_forward = window_dilation_strides_forward;
+                    mark_validation_dirty();
                 }
                 /// \return The padding-below sizes (possibly negative) from the forward prop.
                 const CoordinateDiff& get_padding_below_forward() const
@@ -513,6 +582,7 @@ namespace ngraph
                 void set_padding_below_forward(const CoordinateDiff& padding_below_forward)
                 {
                     m_padding_below_forward = padding_below_forward;
+                    mark_validation_dirty();
                 }
                 /// \return The padding-above sizes (possibly negative) from the forward prop.
                 const CoordinateDiff& get_padding_above_forward() const
@@ -522,6 +592,7 @@ namespace ngraph
                 void set_padding_above_forward(const CoordinateDiff& padding_above_forward)
                 {
                     m_padding_above_forward = padding_above_forward;
+                    mark_validation_dirty();
                 }
                 /// \return The input data dilation strides from the forward prop.
                 const Strides& get_data_dilation_strides_forward() const
@@ -531,6 +602,7 @@ namespace ngraph
                 void set_data_dilation_strides_forward(const Strides& data_dilation_strides_forward)
                 {
                     m_data_dilation_strides_forward = data_dilation_strides_forward;
+                    mark_validation_dirty();
                 }
 
                 // Compute the pad_above values to be used if in a convolution
@@ -591,6 +663,7 @@ namespace ngraph
                     const Strides& window_movement_strides_forward)
                 {
                     m_window_movement_strides_forward = window_movement_strides_forward;
+                    mark_validation_dirty();
                 }
                 /// \return The window dilation strides from the forward prop.
                 const Strides& get_window_dilation_strides_forward() const
@@ -601,6 +674,7 @@ namespace ngraph
                     const Strides& window_dilation_strides_forward)
                 {
                     m_window_dilation_strides_forward = window_dilation_strides_forward;
+                    mark_validation_dirty();
                 }
                 /// \return The padding-below sizes (possibly negative) from the forward prop.
                 const CoordinateDiff& get_padding_below_forward() const
@@ -610,6 +684,7 @@ namespace ngraph
                 void set_padding_below_forward(const CoordinateDiff& padding_below_forward)
                 {
                     m_padding_below_forward = padding_below_forward;
+                    mark_validation_dirty();
                 }
                 /// \return The padding-above sizes (possibly negative) from the forward prop.
                 const CoordinateDiff& get_padding_above_forward() const
@@ -619,6 +694,7 @@ namespace ngraph
                 void set_padding_above_forward(const CoordinateDiff& padding_above_forward)
                 {
                     m_padding_above_forward = padding_above_forward;
+                    mark_validation_dirty();
                 }
                 /// \return The data dilation strides from the forward prop.
                 const Strides& get_data_dilation_strides_forward() const
@@ -628,6 +704,7 @@ namespace ngraph
                 void set_data_dilation_strides_forward(const Strides& data_dilation_strides_forward)
                 {
                     m_data_dilation_strides_forward = data_dilation_strides_forward;
+                    mark_validation_dirty();
                 }
 
                 // Compute the pad_above value to be used if in a convolution
@@ -58,11 +58,13 @@ namespace ngraph
                 void set_resize_method(ResizeMethod resize_method)
                 {
                     m_resize_method = resize_method;
+                    mark_validation_dirty();
                 }
                 float get_extrapolation_value() const { return m_extrapolation_value; }
                 void set_extrapolation_value(float extrapolation_value)
                 {
                     m_extrapolation_value = extrapolation_value;
+                    mark_validation_dirty();
                 }
 
             private:
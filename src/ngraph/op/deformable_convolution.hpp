@@ -70,21 +70,42 @@ namespace ngraph
                 void validate_and_infer_types() override;
 
                 const Strides& get_strides() const { return m_strides; }
-                void set_strides(const Strides& strides) { m_strides = strides; }
+                void set_strides(const Strides& strides)
+                {
+                    m_strides = strides;
+                    mark_validation_dirty();
+                }
                 const Strides& get_dilations() const { return m_dilations; }
-                void set_dilations(const Strides& dilations) { m_dilations = dilations; }
+                void set_dilations(const Strides& dilations)
+                {
+                    m_dilations = dilations;
+                    mark_validation_dirty();
+                }
                 const CoordinateDiff& get_pads_begin() const { return m_pads_begin; }
-                void set_pads_begin(const CoordinateDiff& pads_begin) { m_pads_begin = pads_begin; }
+                void set_pads_begin(const CoordinateDiff& pads_begin)
+                {
+                    m_pads_begin = pads_begin;
+                    mark_validation_dirty();
+                }
                 const CoordinateDiff& get_pads_end() const { return m_pads_end; }
-                void set_pads_end(const CoordinateDiff& pads_end) { m_pads_end = pads_end; }
+                void set_pads_end(const CoordinateDiff& pads_end)
+                {
+                    m_pads_end = pads_end;
+                    mark_validation_dirty();
+                }
                 const PadType& get_auto_pad() const { return m_auto_pad; }
-                void set_auto_pad(const PadType& auto_pad) { m_auto_pad = auto_pad; }
+                void set_auto_pad(const PadType& auto_pad)
+                {
+                    m_auto_pad = auto_pad;
+                    mark_validation_dirty();
+                }
                 int64_t get_group() const { return m_group; }
-                void set_group(const int64_t group) { m_group = group; }
+                void set_group(const int64_t group) { m_group = group; mark_validation_dirty(); }
                 int64_t get_deformable_group() const { return m_deformable_group; }
                 void set_deformable_group(const int64_t deformable_group)
                 {
                     m_deformable_group = deformable_group;
+                    mark_validation_dirty();
                 }
 
                 virtual std::shared_ptr<Node>
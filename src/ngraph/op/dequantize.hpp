@@ -56,9 +56,9 @@ namespace ngraph
                     copy_with_new_args(const NodeVector& new_args) const override;
 
                 const AxisSet& get_axes() const { return m_axes; }
-                void set_axes(const AxisSet& axes) { m_axes = axes; }
+                void set_axes(const AxisSet& axes) { m_axes = axes; mark_validation_dirty(); }
                 const element::Type& get_type() const { return m_type; }
-                void set_type(const element::Type& type) { m_type = type; }
+                void set_type(const element::Type& type) { m_type = type; mark_validation_dirty(); }
             protected:
                 virtual void generate_adjoints(autodiff::Adjoints& adjoints,
                                                const OutputVector& deltas) override;
@@ -56,7 +56,11 @@ namespace ngraph
                        const AutoBroadcastSpec& auto_broadcast = AutoBroadcastSpec());
                 bool visit_attributes(AttributeVisitor& visitor) override;
                 bool is_pythondiv() const { return m_pythondiv; }
-                void set_is_pythondiv(bool pythondiv) { m_pythondiv = pythondiv; }
+                void set_is_pythondiv(bool pythondiv)
+                {
+                    m_pythondiv = pythondiv;
+                    mark_validation_dirty();
+                }
                 virtual std::shared_ptr<Node>
                     copy_with_new_args(const NodeVector& new_args) const override;
 
@@ -105,7 +109,11 @@ namespace ngraph
                            AutoBroadcastSpec(AutoBroadcastType::NUMPY));
                 bool visit_attributes(AttributeVisitor& visitor) override;
                 bool is_pythondiv() const { return m_pythondiv; }
-                void set_is_pythondiv(bool pythondiv) { m_pythondiv = pythondiv; }
+                void set_is_pythondiv(bool pythondiv)
+                {
+                    m_pythondiv = pythondiv;
+                    mark_validation_dirty();
+                }
                 virtual std::shared_ptr<Node>
                     copy_with_new_args(const NodeVector& new_args) const override;
 
@@ -72,11 +72,13 @@ namespace ngraph
                 void set_reduction_axes_count(size_t reduction_axes_count)
                 {
                     m_reduction_axes_count = reduction_axes_count;
+                    mark_validation_dirty();
                 }
                 bool get_has_reduction_axes_count() const { return m_has_reduction_axes_count; }
                 void set_has_reduction_axes_count(bool has_reduction_axes_count)
                 {
                     m_has_reduction_axes_count = has_reduction_axes_count;
+                    mark_validation_dirty();
                 }
                 virtual std::shared_ptr<Node>
                     copy_with_new_args(const NodeVector& new_args) const override
@@ -0,0 +1,275 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/embedding_bag.hpp"
+#include "ngraph/attribute_visitor.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/scatter_add.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::EmbeddingBag::type_info;
+constexpr NodeTypeInfo op::EmbeddingBagBackprop::type_info;
+
+// Checks the inputs EmbeddingBag and EmbeddingBagBackprop share and returns the embedding
+// dimension
+static Dimension validate_embedding_bag_inputs(const Node* node,
+                                               size_t per_sample_weights_input,
+                                               op::EmbeddingBag::Reduction reduction)
+{
+    const PartialShape& weights_shape = node->get_input_partial_shape(0);
+    const PartialShape& indices_shape = node->get_input_partial_shape(1);
+    const PartialShape& offsets_shape = node->get_input_partial_shape(2);
+    const element::Type& indices_et = node->get_input_element_type(1);
+
+    NODE_VALIDATION_CHECK(node,
+                          weights_shape.rank().compatible(2),
+                          "weights are expected to be a matrix (got shape: ",
+                          weights_shape,
+                          ").");
+    NODE_VALIDATION_CHECK(node,
+                          indices_shape.rank().compatible(1),
+                          "indices are expected to be a vector (got shape: ",
+                          indices_shape,
+                          ").");
+    NODE_VALIDATION_CHECK(node,
+                          offsets_shape.rank().compatible(1),
+                          "offsets are expected to be a vector (got shape: ",
+                          offsets_shape,
+                          ").");
+    NODE_VALIDATION_CHECK(node,
+                          indices_et.is_dynamic() || indices_et == element::i32 ||
+                              indices_et == element::i64,
+                          "indices must be i32 or i64 (got ",
+                          indices_et,
+                          ").");
+    NODE_VALIDATION_CHECK(node,
+                          indices_et.compatible(node->get_input_element_type(2)),
+                          "offsets must have the element type of indices (got ",
+                          node->get_input_element_type(2),
+                          ", expected ",
+                          indices_et,
+                          ").");
+
+    // Bags must not overlap; offsets only known at run time are checked by the kernels
+    if (auto offsets = as_type_ptr<op::Constant>(node->input_value(2).get_node_shared_ptr()))
+    {
+        auto values = offsets->cast_vector<int64_t>();
+        NODE_VALIDATION_CHECK(node,
+                              is_sorted(values.begin(), values.end()),
+                              "offsets must be non-decreasing");
+    }
+
+    if (node->get_input_size() > per_sample_weights_input)
+    {
+        NODE_VALIDATION_CHECK(node,
+                              reduction == op::EmbeddingBag::Reduction::SUM,
+                              "per-sample weights are only supported with the SUM reduction");
+        NODE_VALIDATION_CHECK(
+            node,
+            node->get_input_element_type(0).compatible(
+                node->get_input_element_type(per_sample_weights_input)),
+            "per-sample weights must have the element type of weights");
+        NODE_VALIDATION_CHECK(
+            node,
+            node->get_input_partial_shape(per_sample_weights_input).compatible(indices_shape),
+            "per-sample weights must have the shape of indices (got ",
+            node->get_input_partial_shape(per_sample_weights_input),
+            ", expected ",
+            indices_shape,
+            ").");
+    }
+
+    return weights_shape.rank().is_static() ? weights_shape[1] : Dimension::dynamic();
+}
+
+op::EmbeddingBag::EmbeddingBag(const Output<Node>& weights,
+                               const Output<Node>& indices,
+                               const Output<Node>& offsets,
+                               Reduction reduction)
+    : Op({weights, indices, offsets})
+    , m_reduction(reduction)
+{
+    constructor_validate_and_infer_types();
+}
+
+op::EmbeddingBag::EmbeddingBag(const Output<Node>& weights,
+                               const Output<Node>& indices,
+                               const Output<Node>& offsets,
+                               const Output<Node>& per_sample_weights,
+                               Reduction reduction)
+    : Op({weights, indices, offsets, per_sample_weights})
+    , m_reduction(reduction)
+{
+    constructor_validate_and_infer_types();
+}
+
+bool op::EmbeddingBag::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("reduction", m_reduction);
+    return true;
+}
+
+void op::EmbeddingBag::validate_and_infer_types()
+{
+    Dimension embedding_dim = validate_embedding_bag_inputs(this, 3, m_reduction);
+
+    const PartialShape& offsets_shape = get_input_partial_shape(2);
+    Dimension bags = offsets_shape.rank().is_static() ? offsets_shape[0] : Dimension::dynamic();
+    set_output_type(0, get_input_element_type(0), PartialShape{bags, embedding_dim});
+}
+
+shared_ptr<Node> op::EmbeddingBag::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() == 3)
+    {
+        return make_shared<EmbeddingBag>(
+            new_args.at(0), new_args.at(1), new_args.at(2), m_reduction);
+    }
+    else if (new_args.size() == 4)
+    {
+        return make_shared<EmbeddingBag>(
+            new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), m_reduction);
+    }
+    throw ngraph_error("Incorrect number of new arguments");
+}
+
+void op::EmbeddingBag::generate_adjoints(autodiff::Adjoints& adjoints, const OutputVector& deltas)
+{
+    auto delta = deltas.at(0);
+    auto weights = input_value(0);
+    auto indices = input_value(1);
+    auto offsets = input_value(2);
+
+    shared_ptr<EmbeddingBagBackprop> bprop;
+    if (has_per_sample_weights())
+    {
+        bprop = make_shared<EmbeddingBagBackprop>(
+            weights, indices, offsets, delta, input_value(3), m_reduction);
+    }
+    else
+    {
+        bprop = make_shared<EmbeddingBagBackprop>(weights, indices, offsets, delta, m_reduction);
+    }
+
+    // Only the rows that were looked up receive a gradient; ScatterAdd accumulates them,
+    // including repeated indices, into an otherwise zero gradient
+    auto zero = make_shared<op::Broadcast>(
+        op::Constant::create(weights.get_element_type(), Shape{}, {0}),
+        weights.get_shape(),
+        AxisSet{0, 1});
+    adjoints.add_delta(weights, make_shared<op::ScatterAdd>(zero, indices, bprop->output(0)));
+    if (has_per_sample_weights())
+    {
+        adjoints.add_delta(input_value(3), bprop->output(1));
+    }
+}
+
+op::EmbeddingBagBackprop::EmbeddingBagBackprop(const Output<Node>& weights,
+                                               const Output<Node>& indices,
+                                               const Output<Node>& offsets,
+                                               const Output<Node>& delta,
+                                               EmbeddingBag::Reduction reduction)
+    : Op({weights, indices, offsets, delta})
+    , m_reduction(reduction)
+{
+    constructor_validate_and_infer_types();
+}
+
+op::EmbeddingBagBackprop::EmbeddingBagBackprop(const Output<Node>& weights,
+                                               const Output<Node>& indices,
+                                               const Output<Node>& offsets,
+                                               const Output<Node>& delta,
+                                               const Output<Node>& per_sample_weights,
+                                               EmbeddingBag::Reduction reduction)
+    : Op({weights, indices, offsets, delta, per_sample_weights})
+    , m_reduction(reduction)
+{
+    constructor_validate_and_infer_types();
+}
+
+bool op::EmbeddingBagBackprop::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("reduction", m_reduction);
+    return true;
+}
+
+void op::EmbeddingBagBackprop::validate_and_infer_types()
+{
+    Dimension embedding_dim = validate_embedding_bag_inputs(this, 4, m_reduction);
+
+    const PartialShape& offsets_shape = get_input_partial_shape(2);
+    Dimension bags = offsets_shape.rank().is_static() ? offsets_shape[0] : Dimension::dynamic();
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(3).compatible(get_input_element_type(0)),
+                          "delta must have the element type of weights");
+    NODE_VALIDATION_CHECK(this,
+                          get_input_partial_shape(3).compatible(PartialShape{bags, embedding_dim}),
+                          "delta must have shape [offsets, embedding size] (got ",
+                          get_input_partial_shape(3),
+                          ").");
+
+    const PartialShape& indices_shape = get_input_partial_shape(1);
+    Dimension indices_count =
+        indices_shape.rank().is_static() ? indices_shape[0] : Dimension::dynamic();
+    set_output_type(0, get_input_element_type(0), PartialShape{indices_count, embedding_dim});
+    if (has_per_sample_weights())
+    {
+        set_output_type(1, get_input_element_type(0), PartialShape{indices_count});
+    }
+}
+
+shared_ptr<Node> op::EmbeddingBagBackprop::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() == 4)
+    {
+        return make_shared<EmbeddingBagBackprop>(
+            new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), m_reduction);
+    }
+    else if (new_args.size() == 5)
+    {
+        return make_shared<EmbeddingBagBackprop>(new_args.at(0),
+                                                 new_args.at(1),
+                                                 new_args.at(2),
+                                                 new_args.at(3),
+                                                 new_args.at(4),
+                                                 m_reduction);
+    }
+    throw ngraph_error("Incorrect number of new arguments");
+}
+
+namespace ngraph
+{
+    template <>
+    EnumNames<op::v0::EmbeddingBag::Reduction>& EnumNames<op::v0::EmbeddingBag::Reduction>::get()
+    {
+        static auto enum_names = EnumNames<op::v0::EmbeddingBag::Reduction>(
+            "op::v0::EmbeddingBag::Reduction",
+            {{"sum", op::v0::EmbeddingBag::Reduction::SUM},
+             {"mean", op::v0::EmbeddingBag::Reduction::MEAN},
+             {"max", op::v0::EmbeddingBag::Reduction::MAX}});
+        return enum_names;
+    }
+
+    constexpr DiscreteTypeInfo AttributeAdapter<op::v0::EmbeddingBag::Reduction>::type_info;
+
+    std::ostream& operator<<(std::ostream& s, const op::v0::EmbeddingBag::Reduction& type)
+    {
+        return s << as_string(type);
+    }
+}
@@ -0,0 +1,140 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        namespace v0
+        {
+            /// \brief Pools bags of embedding rows into one vector per bag.
+            ///
+            /// Bag b holds the rows indices[offsets[b]] .. indices[offsets[b + 1] - 1] of
+            /// weights; the last bag ends with the last index. Equivalent to an
+            /// EmbeddingLookup followed by a reduction over each bag, without materializing
+            /// the gathered rows.
+            class NGRAPH_API EmbeddingBag : public Op
+            {
+            public:
+                enum class Reduction
+                {
+                    SUM,
+                    MEAN,
+                    MAX
+                };
+
+                static constexpr NodeTypeInfo type_info{"EmbeddingBag", 0};
+                const NodeTypeInfo& get_type_info() const override { return type_info; }
+                /// \brief Constructs an EmbeddingBag operation.
+                EmbeddingBag() = default;
+                /// \brief Constructs an EmbeddingBag operation.
+                ///
+                /// \param weights Embedding table of shape [N, D]
+                /// \param indices 1-D i32 or i64 tensor of rows of weights
+                /// \param offsets 1-D tensor, of the same type as indices, with the position in
+                ///                indices where every bag starts; must be non-decreasing
+                /// \param reduction How the rows of a bag are combined
+                EmbeddingBag(const Output<Node>& weights,
+                             const Output<Node>& indices,
+                             const Output<Node>& offsets,
+                             Reduction reduction = Reduction::SUM);
+                /// \brief Constructs an EmbeddingBag operation with per-sample weights.
+                ///
+                /// \param per_sample_weights 1-D tensor with one factor per index that scales
+                ///                           its row before the rows are summed. Only valid
+                ///                           with Reduction::SUM.
+                EmbeddingBag(const Output<Node>& weights,
+                             const Output<Node>& indices,
+                             const Output<Node>& offsets,
+                             const Output<Node>& per_sample_weights,
+                             Reduction reduction = Reduction::SUM);
+
+                bool visit_attributes(AttributeVisitor& visitor) override;
+                void validate_and_infer_types() override;
+
+                virtual std::shared_ptr<Node>
+                    copy_with_new_args(const NodeVector& new_args) const override;
+
+                Reduction get_reduction() const { return m_reduction; }
+                bool has_per_sample_weights() const { return get_input_size() == 4; }
+            protected:
+                virtual void generate_adjoints(autodiff::Adjoints& adjoints,
+                                               const OutputVector& deltas) override;
+
+                Reduction m_reduction{Reduction::SUM};
+            };
+
+            /// \brief Gradients of EmbeddingBag.
+            ///
+            /// Output 0 holds, for every index, the gradient of the row of weights it selected
+            /// (shape [indices, D]); ScatterAdd accumulates it into the gradient of weights.
+            /// With per-sample weights, output 1 holds their gradient.
+            class NGRAPH_API EmbeddingBagBackprop : public Op
+            {
+            public:
+                static constexpr NodeTypeInfo type_info{"EmbeddingBagBackprop", 0};
+                const NodeTypeInfo& get_type_info() const override { return type_info; }
+                EmbeddingBagBackprop() = default;
+                /// \param delta Gradient of the EmbeddingBag output, of shape [offsets, D]
+                EmbeddingBagBackprop(const Output<Node>& weights,
+                                     const Output<Node>& indices,
+                                     const Output<Node>& offsets,
+                                     const Output<Node>& delta,
+                                     EmbeddingBag::Reduction reduction);
+                EmbeddingBagBackprop(const Output<Node>& weights,
+                                     const Output<Node>& indices,
+                                     const Output<Node>& offsets,
+                                     const Output<Node>& delta,
+                                     const Output<Node>& per_sample_weights,
+                                     EmbeddingBag::Reduction reduction);
+
+                bool visit_attributes(AttributeVisitor& visitor) override;
+                void validate_and_infer_types() override;
+
+                virtual std::shared_ptr<Node>
+                    copy_with_new_args(const NodeVector& new_args) const override;
+
+                EmbeddingBag::Reduction get_reduction() const { return m_reduction; }
+                bool has_per_sample_weights() const { return get_input_size() == 5; }
+            protected:
+                EmbeddingBag::Reduction m_reduction{EmbeddingBag::Reduction::SUM};
+            };
+        }
+        using v0::EmbeddingBag;
+        using v0::EmbeddingBagBackprop;
+    }
+
+    std::ostream& operator<<(std::ostream& s, const op::v0::EmbeddingBag::Reduction& type);
+
+    template <>
+    class NGRAPH_API AttributeAdapter<op::v0::EmbeddingBag::Reduction>
+        : public EnumAttributeAdapterBase<op::v0::EmbeddingBag::Reduction>
+    {
+    public:
+        AttributeAdapter(op::v0::EmbeddingBag::Reduction& value)
+            : EnumAttributeAdapterBase<op::v0::EmbeddingBag::Reduction>(value)
+        {
+        }
+
+        static constexpr DiscreteTypeInfo type_info{
+            "AttributeAdapter<op::v0::EmbeddingBag::Reduction>", 0};
+        const DiscreteTypeInfo& get_type_info() const override { return type_info; }
+    };
+}
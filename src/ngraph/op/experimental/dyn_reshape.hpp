@@ -59,7 +59,11 @@ namespace ngraph
                     copy_with_new_args(const NodeVector& new_args) const override;
 
                 bool get_zero_flag() const { return m_zero_flag; }
-                void set_zero_flag(bool zero_flag) { m_zero_flag = zero_flag; }
+                void set_zero_flag(bool zero_flag)
+                {
+                    m_zero_flag = zero_flag;
+                    mark_validation_dirty();
+                }
             protected:
                 virtual void generate_adjoints(autodiff::Adjoints& adjoints,
                                                const OutputVector& deltas) override;
@@ -53,6 +53,7 @@ namespace ngraph
                 void set_element_type(const element::Type& element_type)
                 {
                     m_element_type = element_type;
+                    mark_validation_dirty();
                 }
 
                 /// Deprecated accessor for transitional attributes
@@ -112,6 +113,7 @@ namespace ngraph
                 void set_element_type(const element::Type& element_type)
                 {
                     m_element_type = element_type;
+                    mark_validation_dirty();
                 }
 
                 /// Deprecated accessor for transitional attributes
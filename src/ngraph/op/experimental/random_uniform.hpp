@@ -70,7 +70,11 @@ namespace ngraph
                 /// \brief Sets the fixed seed value to be supplied to the random number generator
                 ///        if `use_fixed_seed` is `true`. If `use_fixed_seed` is `false`, this value
                 ///        is ignored.
-                void set_fixed_seed(uint64_t fixed_seed) { m_fixed_seed = fixed_seed; }
+                void set_fixed_seed(uint64_t fixed_seed)
+                {
+                    m_fixed_seed = fixed_seed;
+                    mark_validation_dirty();
+                }
                 // Internally, any implementation of RandomUniform will have state, since it is
                 // backed by a random number generator.
                 bool has_state() const override { return true; }
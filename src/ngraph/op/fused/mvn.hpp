@@ -73,7 +73,11 @@ namespace ngraph
                 double get_eps() const { return m_eps; }
                 bool get_normalize_variance() const { return m_normalize_variance; }
                 AxisSet get_reduction_axes() const { return m_reduction_axes; }
-                void set_reduction_axes(AxisSet axes) { m_reduction_axes = axes; }
+                void set_reduction_axes(AxisSet axes)
+                {
+                    m_reduction_axes = axes;
+                    mark_validation_dirty();
+                }
             private:
                 double m_eps;
                 bool m_across_channels;
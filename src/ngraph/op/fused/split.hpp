@@ -101,7 +101,11 @@ namespace ngraph
                     copy_with_new_args(const NodeVector& new_args) const override;
 
                 size_t get_num_splits() const { return m_num_splits; }
-                void set_num_splits(const size_t num_splits) { m_num_splits = num_splits; }
+                void set_num_splits(const size_t num_splits)
+                {
+                    m_num_splits = num_splits;
+                    mark_validation_dirty();
+                }
                 bool supports_decompose() const override { return false; }
             protected:
                 size_t m_num_splits;
@@ -55,6 +55,7 @@ namespace ngraph
                 void set_autob(const AutoBroadcastSpec& auto_broadcast)
                 {
                     m_autobroadcast = auto_broadcast;
+                    mark_validation_dirty();
                 }
 
             private:
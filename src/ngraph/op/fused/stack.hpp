@@ -61,7 +61,7 @@ namespace ngraph
 
                 /// \return The stack axis
                 int64_t get_axis() const { return m_axis; }
-                void set_axis(int64_t axis) { m_axis = axis; }
+                void set_axis(int64_t axis) { m_axis = axis; mark_validation_dirty(); }
             private:
                 int64_t m_axis;
             };
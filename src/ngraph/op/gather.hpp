@@ -42,7 +42,7 @@ namespace ngraph
                                        const OutputVector& deltas) override;
 
                 size_t get_axis() const { return m_axis; }
-                void set_axis(size_t axis) { m_axis = axis; }
+                void set_axis(size_t axis) { m_axis = axis; mark_validation_dirty(); }
                 virtual std::shared_ptr<Node>
                     copy_with_new_args(const NodeVector& new_args) const override;
 
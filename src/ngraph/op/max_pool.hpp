@@ -103,7 +103,11 @@ namespace ngraph
 
                 /// \return The window shape.
                 const Shape& get_window_shape() const { return m_window_shape; }
-                void set_window_shape(const Shape& window_shape) { m_window_shape = window_shape; }
+                void set_window_shape(const Shape& window_shape)
+                {
+                    m_window_shape = window_shape;
+                    mark_validation_dirty();
+                }
                 /// \return The window movement strides.
                 const Strides& get_window_movement_strides() const
                 {
@@ -112,25 +116,36 @@ namespace ngraph
                 void set_window_movement_strides(const Strides& window_movement_strides)
                 {
                     m_window_movement_strides = window_movement_strides;
+                    mark_validation_dirty();
                 }
                 /// \return The below-padding shape.
                 const Shape& get_padding_below() const { return m_padding_below; }
                 void set_padding_below(const Shape& padding_below)
                 {
                     m_padding_below = padding_below;
+                    mark_validation_dirty();
                 }
                 /// \return The above-padding shape.
                 const Shape& get_padding_above() const { return m_padding_above; }
                 void set_adding_above(const Shape& padding_above)
                 {
                     m_padding_above = padding_above;
+                    mark_validation_dirty();
                 }
                 /// \return The pad type for pooling.
                 const PadType& get_pad_type() const { return m_pad_type; }
-                void set_pad_type(const PadType& pad_type) { m_pad_type = pad_type; }
+                void set_pad_type(const PadType& pad_type)
+                {
+                    m_pad_type = pad_type;
+                    mark_validation_dirty();
+                }
                 /// \return The ceiling mode being used for output shape computations
                 bool get_ceil_mode() const { return m_ceil_mode; }
-                void set_ceil_mode(bool ceil_mode) { m_ceil_mode = ceil_mode; }
+                void set_ceil_mode(bool ceil_mode)
+                {
+                    m_ceil_mode = ceil_mode;
+                    mark_validation_dirty();
+                }
                 /// \return The default value for MaxPool.
                 virtual std::shared_ptr<Node> get_default_value() const override;
 
@@ -174,7 +189,11 @@ namespace ngraph
                 void validate_and_infer_types() override;
 
                 const Shape& get_window_shape() const { return m_window_shape; }
-                void set_window_shape(const Shape& window_shape) { m_window_shape = window_shape; }
+                void set_window_shape(const Shape& window_shape)
+                {
+                    m_window_shape = window_shape;
+                    mark_validation_dirty();
+                }
                 const Strides& get_window_movement_strides() const
                 {
                     return m_window_movement_strides;
@@ -182,16 +201,19 @@ namespace ngraph
                 void set_window_movement_strides(const Strides& window_movement_strides)
                 {
                     m_window_movement_strides = window_movement_strides;
+                    mark_validation_dirty();
                 }
                 const Shape& get_padding_below() const { return m_padding_below; }
                 void set_padding_below(const Shape& padding_below)
                 {
                     m_padding_below = padding_below;
+                    mark_validation_dirty();
                 }
                 const Shape& get_padding_above() const { return m_padding_above; }
                 void set_padding_above(const Shape& padding_above)
                 {
                     m_padding_above = padding_above;
+                    mark_validation_dirty();
                 }
 
             protected:
@@ -256,24 +278,41 @@ namespace ngraph
 
                 /// \return The kernel shape.
                 const Shape& get_kernel() const { return m_kernel; }
-                void set_kernel(const Shape& kernel) { m_kernel = kernel; }
+                void set_kernel(const Shape& kernel) { m_kernel = kernel; mark_validation_dirty(); }
                 /// \return The strides.
                 const Strides& get_strides() const { return m_strides; }
-                void set_strides(const Strides& strides) { m_strides = strides; }
+                void set_strides(const Strides& strides)
+                {
+                    m_strides = strides;
+                    mark_validation_dirty();
+                }
                 /// \return The beginning of padding shape.
                 const Shape& get_pads_begin() const { return m_pads_begin; }
-                void set_pads_begin(const Shape& pads_begin) { m_pads_begin = pads_begin; }
+                void set_pads_begin(const Shape& pads_begin)
+                {
+                    m_pads_begin = pads_begin;
+                    mark_validation_dirty();
+                }
                 /// \return The end of padding shape.
                 const Shape& get_pads_end() const { return m_pads_end; }
-                void set_adding_above(const Shape& pads_end) { m_pads_end = pads_end; }
+                void set_adding_above(const Shape& pads_end)
+                {
+                    m_pads_end = pads_end;
+                    mark_validation_dirty();
+                }
                 /// \return The pad type for pooling.
                 const PadType& get_auto_pad() const { return m_auto_pad; }
-                void set_auto_pad(const PadType& auto_pad) { m_auto_pad = auto_pad; }
+                void set_auto_pad(const PadType& auto_pad)
+                {
+                    m_auto_pad = auto_pad;
+                    mark_validation_dirty();
+                }
                 /// \return The ceiling mode being used for output shape computations
                 op::RoundingType get_rounding_type() const { return m_rounding_type; }
                 void set_rounding_type(op::RoundingType rounding_mode)
                 {
                     m_rounding_type = rounding_mode;
+                    mark_validation_dirty();
                 }
                 /// \return The default value for MaxPool.
                 virtual std::shared_ptr<Node> get_default_value() const override;
@@ -319,13 +358,25 @@ namespace ngraph
                 void validate_and_infer_types() override;
 
                 const Shape& get_kernel() const { return m_kernel; }
-                void set_kernel(const Shape& kernel) { m_kernel = kernel; }
+                void set_kernel(const Shape& kernel) { m_kernel = kernel; mark_validation_dirty(); }
                 const Strides& get_strides() const { return m_strides; }
-                void set_strides(const Strides& strides) { m_strides = strides; }
+                void set_strides(const Strides& strides)
+                {
+                    m_strides = strides;
+                    mark_validation_dirty();
+                }
                 const Shape& get_pads_begin() const { return m_pads_begin; }
-                void set_pads_begin(const Shape& pads_begin) { m_pads_begin = pads_begin; }
+                void set_pads_begin(const Shape& pads_begin)
+                {
+                    m_pads_begin = pads_begin;
+                    mark_validation_dirty();
+                }
                 const Shape& get_pads_end() const { return m_pads_end; }
-                void set_pads_end(const Shape& pads_end) { m_pads_end = pads_end; }
+                void set_pads_end(const Shape& pads_end)
+                {
+                    m_pads_end = pads_end;
+                    mark_validation_dirty();
+                }
             protected:
                 Shape m_kernel;
                 Strides m_strides;
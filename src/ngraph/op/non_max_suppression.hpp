@@ -77,12 +77,14 @@ namespace ngraph
                 void set_box_encoding(const BoxEncodingType box_encoding)
                 {
                     m_box_encoding = box_encoding;
+                    mark_validation_dirty();
                 }
 
                 bool get_sort_result_descending() const { return m_sort_result_descending; }
                 void set_sort_result_descending(const bool sort_result_descending)
                 {
                     m_sort_result_descending = sort_result_descending;
+                    mark_validation_dirty();
                 }
 
             protected:
@@ -67,7 +67,11 @@ namespace ngraph
 
                 /// \return The index of the one-hot axis.
                 size_t get_one_hot_axis() const { return m_one_hot_axis; }
-                void set_one_hot_axis(size_t one_hot_axis) { m_one_hot_axis = one_hot_axis; }
+                void set_one_hot_axis(size_t one_hot_axis)
+                {
+                    m_one_hot_axis = one_hot_axis;
+                    mark_validation_dirty();
+                }
             protected:
                 PartialShape m_shape;
                 size_t m_one_hot_axis;
@@ -105,7 +109,7 @@ namespace ngraph
 
                 /// \return The index of the one-hot axis.
                 int64_t get_axis() const { return m_axis; }
-                void set_axis(int64_t axis) { m_axis = axis; }
+                void set_axis(int64_t axis) { m_axis = axis; mark_validation_dirty(); }
             protected:
                 int64_t m_axis;
             };
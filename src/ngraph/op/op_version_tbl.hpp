@@ -91,6 +91,8 @@ NGRAPH_OP(DynReplaceSlice, ngraph::op::v0, 0)
 NGRAPH_OP(DynReshape, ngraph::op::v0, 0)
 NGRAPH_OP(DynSlice, ngraph::op::v0, 0)
 NGRAPH_OP(Elu, ngraph::op::v0, 0)
+NGRAPH_OP(EmbeddingBag, ngraph::op::v0, 0)
+NGRAPH_OP(EmbeddingBagBackprop, ngraph::op::v0, 0)
 NGRAPH_OP(EmbeddingLookup, ngraph::op::v0, 0)
 NGRAPH_OP(Equal, ngraph::op::v0, 0)
 NGRAPH_OP(Equal, ngraph::op::v1, 1)
@@ -62,12 +62,14 @@ namespace ngraph
                 void set_padding_below(const CoordinateDiff& padding_below)
                 {
                     m_padding_below = padding_below;
+                    mark_validation_dirty();
                 }
                 /// \return The padding-above sizes.
                 const CoordinateDiff& get_padding_above() const { return m_padding_above; }
                 void set_padding_above(const CoordinateDiff& padding_above)
                 {
                     m_padding_above = padding_above;
+                    mark_validation_dirty();
                 }
 
                 /// \brief DEPRECATED. This is just a stub for backends that used to implement the
@@ -77,7 +79,11 @@ namespace ngraph
                 const Shape& get_padding_interior() const { return m_padding_interior_fake; }
                 /// \return The padding mode.
                 PadMode get_pad_mode() const { return m_pad_mode; }
-                void set_pad_mode(PadMode pad_mode) { m_pad_mode = pad_mode; }
+                void set_pad_mode(PadMode pad_mode)
+                {
+                    m_pad_mode = pad_mode;
+                    mark_validation_dirty();
+                }
                 /// \return The default value for Pad.
                 virtual std::shared_ptr<Node> get_default_value() const override;
 
@@ -150,7 +156,11 @@ namespace ngraph
 
                 /// \return The padding mode.
                 PadMode get_pad_mode() const { return m_pad_mode; }
-                void set_pad_mode(PadMode pad_mode) { m_pad_mode = pad_mode; }
+                void set_pad_mode(PadMode pad_mode)
+                {
+                    m_pad_mode = pad_mode;
+                    mark_validation_dirty();
+                }
             protected:
                 virtual void generate_adjoints(autodiff::Adjoints& adjoints,
                                                const OutputVector& deltas) override;
@@ -69,4 +69,5 @@ bool op::Parameter::is_relevant_to_shapes() const
 void op::Parameter::set_is_relevant_to_shapes(bool is_relevant)
 {
     m_is_relevant_to_shapes = is_relevant;
+    mark_validation_dirty();
 }
@@ -68,6 +68,7 @@ namespace ngraph
                 void set_reduction_axes_count(size_t reduction_axes_count)
                 {
                     m_reduction_axes_count = reduction_axes_count;
+                    mark_validation_dirty();
                 }
                 void validate_and_infer_types() override;
                 virtual std::shared_ptr<Node>
@@ -95,16 +95,22 @@ namespace ngraph
                 void set_lower_bounds(const Coordinate& lower_bounds)
                 {
                     m_lower_bounds = lower_bounds;
+                    mark_validation_dirty();
                 }
                 /// \return The exclusive upper-bound coordinates.
                 const Coordinate& get_upper_bounds() const { return m_upper_bounds; }
                 void set_uppper_bounds(const Coordinate& upper_bounds)
                 {
                     m_upper_bounds = upper_bounds;
+                    mark_validation_dirty();
                 }
                 /// \return The slicing strides.
                 const Strides& get_strides() const { return m_strides; }
-                void set_strides(const Strides& strides) { m_strides = strides; }
+                void set_strides(const Strides& strides)
+                {
+                    m_strides = strides;
+                    mark_validation_dirty();
+                }
             protected:
                 virtual void generate_adjoints(autodiff::Adjoints& adjoints,
                                                const OutputVector& deltas) override;
@@ -93,12 +93,24 @@ namespace ngraph
 
                 /// \return The order in which to iterate over input axes.
                 const AxisVector& get_input_order() const { return m_input_order; }
-                void set_input_order(const AxisVector& input_order) { m_input_order = input_order; }
+                void set_input_order(const AxisVector& input_order)
+                {
+                    m_input_order = input_order;
+                    mark_validation_dirty();
+                }
                 /// \return The shape of the output tensor.
                 const Shape& get_output_shape() const { return m_output_shape; }
-                void set_output_shape(const Shape& output_shape) { m_output_shape = output_shape; }
+                void set_output_shape(const Shape& output_shape)
+                {
+                    m_output_shape = output_shape;
+                    mark_validation_dirty();
+                }
                 bool get_is_transpose() const { return m_is_transpose; }
-                void set_is_transpose(bool is_transpose) { m_is_transpose = is_transpose; }
+                void set_is_transpose(bool is_transpose)
+                {
+                    m_is_transpose = is_transpose;
+                    mark_validation_dirty();
+                }
             protected:
                 virtual void generate_adjoints(autodiff::Adjoints& adjoints,
                                                const OutputVector& deltas) override;
@@ -145,7 +157,11 @@ namespace ngraph
                     copy_with_new_args(const NodeVector& new_args) const override;
 
                 bool get_special_zero() const { return m_special_zero; }
-                void set_special_zero(bool special_zero) { m_special_zero = special_zero; }
+                void set_special_zero(bool special_zero)
+                {
+                    m_special_zero = special_zero;
+                    mark_validation_dirty();
+                }
             protected:
                 virtual void generate_adjoints(autodiff::Adjoints& adjoints,
                                                const OutputVector& deltas) override;
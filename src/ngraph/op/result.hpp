@@ -45,7 +45,11 @@ namespace ngraph
                     copy_with_new_args(const NodeVector& new_args) const override;
 
                 virtual bool is_output() const override { return true; }
-                void set_needs_default_layout(bool val) { m_needs_default_layout = val; }
+                void set_needs_default_layout(bool val)
+                {
+                    m_needs_default_layout = val;
+                    mark_validation_dirty();
+                }
                 bool needs_default_layout() const { return m_needs_default_layout; }
             protected:
                 virtual void generate_adjoints(autodiff::Adjoints& adjoints,
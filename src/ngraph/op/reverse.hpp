@@ -70,6 +70,7 @@ namespace ngraph
                 void set_reversed_axes(const AxisSet& reversed_axes)
                 {
                     m_reversed_axes = reversed_axes;
+                    mark_validation_dirty();
                 }
 
             protected:
@@ -116,7 +117,7 @@ namespace ngraph
 
                 /// \return The second input data interpretation mode.
                 Mode get_mode() const { return m_mode; }
-                void set_mode(const Mode mode) { m_mode = mode; }
+                void set_mode(const Mode mode) { m_mode = mode; mark_validation_dirty(); }
                 virtual size_t get_version() const override { return 1; }
             protected:
                 virtual void generate_adjoints(autodiff::Adjoints& adjoints,
@@ -46,10 +46,18 @@ namespace ngraph
 
                 size_t get_batch_axis() const { return m_normalized_batch_axis; }
                 int64_t get_origin_batch_axis() const { return m_batch_axis; }
-                void set_batch_axis(int64_t batch_axis) { m_batch_axis = batch_axis; }
+                void set_batch_axis(int64_t batch_axis)
+                {
+                    m_batch_axis = batch_axis;
+                    mark_validation_dirty();
+                }
                 size_t get_sequence_axis() const { return m_normalized_seq_axis; }
                 int64_t get_origin_sequence_axis() const { return m_seq_axis; }
-                void set_sequence_axis(int64_t sequence_axis) { m_seq_axis = sequence_axis; }
+                void set_sequence_axis(int64_t sequence_axis)
+                {
+                    m_seq_axis = sequence_axis;
+                    mark_validation_dirty();
+                }
             protected:
                 virtual void generate_adjoints(autodiff::Adjoints& adjoints,
                                                const OutputVector& deltas) override;
@@ -120,6 +120,7 @@ namespace ngraph
                 void set_auto_broadcast(const AutoBroadcastSpec& auto_broadcast)
                 {
                     m_auto_broadcast = auto_broadcast;
+                    mark_validation_dirty();
                 }
                 bool supports_auto_broadcast() const override { return true; }
                 // TODO: Move all uses of get_autob to get_auto_broadcast() and remove this.
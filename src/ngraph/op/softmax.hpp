@@ -96,7 +96,7 @@ namespace ngraph
                     copy_with_new_args(const NodeVector& new_args) const override;
 
                 size_t get_axis() const { return m_axis; }
-                void set_axis(const size_t axis) { m_axis = axis; }
+                void set_axis(const size_t axis) { m_axis = axis; mark_validation_dirty(); }
             protected:
                 virtual void generate_adjoints(autodiff::Adjoints& adjoints,
                                                const OutputVector& deltas) override;
@@ -162,6 +162,7 @@ void op::TensorIterator::set_sliced_input(const std::shared_ptr<op::Parameter>&
                                            part_size,
                                            end,
                                            axis));
+    mark_validation_dirty();
 }
 
 void op::TensorIterator::set_merged_input(const std::shared_ptr<Parameter>& body_parameter,
@@ -172,6 +173,7 @@ void op::TensorIterator::set_merged_input(const std::shared_ptr<Parameter>& body
         make_shared<MergedInputDescription>(input_for_value(initial_value).get_index(),
                                             m_body->get_parameter_index(body_parameter),
                                             m_body->get_result_index(successive_value)));
+    mark_validation_dirty();
 }
 
 void op::TensorIterator::set_invariant_input(const std::shared_ptr<Parameter>& body_parameter,
@@ -179,6 +181,7 @@ void op::TensorIterator::set_invariant_input(const std::shared_ptr<Parameter>& b
 {
     m_input_descriptions.push_back(make_shared<InvariantInputDescription>(
         input_for_value(value).get_index(), m_body->get_parameter_index(body_parameter)));
+    mark_validation_dirty();
 }
 
 Output<Node> op::TensorIterator::get_iter_value(const Output<Node>& body_value, int64_t iteration)
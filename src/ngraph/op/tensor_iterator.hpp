@@ -267,7 +267,11 @@ namespace ngraph
                 /// \return the body of the iteration
                 std::shared_ptr<BodyLambda> get_body() const { return m_body; }
                 /// \param body set the body of the iteration
-                void set_body(const std::shared_ptr<BodyLambda>& body) { m_body = body; }
+                void set_body(const std::shared_ptr<BodyLambda>& body)
+                {
+                    m_body = body;
+                    mark_validation_dirty();
+                }
                 /// \return a reference to the input descriptions.
                 const std::vector<std::shared_ptr<InputDescription>>& get_input_descriptions() const
                 {
@@ -303,6 +307,7 @@ namespace ngraph
                 void set_num_iterations(int64_t num_iterations)
                 {
                     m_num_iterations = num_iterations;
+                    mark_validation_dirty();
                 }
 
             private:
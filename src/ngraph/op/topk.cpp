@@ -319,6 +319,7 @@ void op::v1::TopK::set_axis(const int64_t axis)
         m_normalized_axis = UNKNOWN_NORMALIZED_AXIS;
     }
     m_axis = axis;
+    mark_validation_dirty();
 }
 
 uint64_t op::v1::TopK::get_axis() const
@@ -392,12 +393,8 @@ void op::v1::TopK::generate_adjoints(autodiff::Adjoints& /*adjoints*/,
 shared_ptr<Node> op::v1::TopK::copy_with_new_args(const NodeVector& new_args) const
 {
     check_new_args_count(this, new_args);
-    auto new_v1_topk =
-        make_shared<v1::TopK>(new_args.at(0), new_args.at(1), m_axis, m_mode, m_sort);
-
-    new_v1_topk->set_index_element_type(m_index_element_type);
-
-    return std::move(new_v1_topk);
+    return make_shared<v1::TopK>(
+        new_args.at(0), new_args.at(1), m_axis, m_mode, m_sort, m_index_element_type);
 }
 
 op::v1::TopK::Mode op::v1::TopK::mode_from_string(const std::string& mode) const
@@ -170,13 +170,14 @@ namespace ngraph
                 int64_t get_provided_axis() const { return m_axis; }
                 void set_axis(const int64_t axis);
                 Mode get_mode() const { return m_mode; }
-                void set_mode(const Mode mode) { m_mode = mode; }
+                void set_mode(const Mode mode) { m_mode = mode; mark_validation_dirty(); }
                 SortType get_sort_type() const { return m_sort; }
-                void set_sort_type(const SortType sort) { m_sort = sort; }
+                void set_sort_type(const SortType sort) { m_sort = sort; mark_validation_dirty(); }
                 element::Type get_index_element_type() const { return m_index_element_type; }
                 void set_index_element_type(const element::Type& index_element_type)
                 {
                     m_index_element_type = index_element_type;
+                    mark_validation_dirty();
                 }
 
                 /// \brief Returns the value of K, if available
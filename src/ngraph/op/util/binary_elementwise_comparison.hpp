@@ -89,7 +89,11 @@ namespace ngraph
                 void validate_and_infer_types() override;
 
                 const AutoBroadcastSpec& get_autob() const override { return m_autob; }
-                void set_autob(const AutoBroadcastSpec& autob) { m_autob = autob; }
+                void set_autob(const AutoBroadcastSpec& autob)
+                {
+                    m_autob = autob;
+                    mark_validation_dirty();
+                }
                 bool supports_auto_broadcast() const override { return true; }
                 bool is_binary_elementwise_comparison() const override { return true; }
                 bool visit_attributes(AttributeVisitor& visitor) override;
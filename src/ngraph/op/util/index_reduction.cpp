@@ -61,6 +61,7 @@ uint64_t op::util::IndexReduction::get_reduction_axis() const
 void op::util::IndexReduction::set_reduction_axis(uint64_t value)
 {
     m_axis = value;
+    mark_validation_dirty();
 }
 element::Type op::util::IndexReduction::get_index_element_type() const
 {
@@ -69,6 +70,7 @@ element::Type op::util::IndexReduction::get_index_element_type() const
 void op::util::IndexReduction::set_index_element_type(const element::Type& index_element_type)
 {
     m_index_element_type = index_element_type;
+    mark_validation_dirty();
 }
 
 void op::util::IndexReduction::validate_and_infer_types()
@@ -45,7 +45,11 @@ namespace ngraph
                 /// \return If set to 1 it holds axes that are used for reduction.
                 /// For each such axis, output dimension is equal to 1.
                 bool get_keep_dims() const { return m_keep_dims; }
-                void set_keep_dims(bool keep_dims) { m_keep_dims = keep_dims; }
+                void set_keep_dims(bool keep_dims)
+                {
+                    m_keep_dims = keep_dims;
+                    mark_validation_dirty();
+                }
             private:
                 bool m_keep_dims = false;
             };
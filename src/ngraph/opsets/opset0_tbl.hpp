@@ -99,6 +99,8 @@ NGRAPH_OP(DynReplaceSlice, ngraph::op)
 NGRAPH_OP(DynReshape, ngraph::op)
 NGRAPH_OP(DynSlice, ngraph::op)
 NGRAPH_OP(Elu, ngraph::op)
+NGRAPH_OP(EmbeddingBag, ngraph::op)
+NGRAPH_OP(EmbeddingBagBackprop, ngraph::op)
 NGRAPH_OP(EmbeddingLookup, ngraph::op)
 NGRAPH_OP(Equal, ngraph::op)
 NGRAPH_OP(Erf, ngraph::op)
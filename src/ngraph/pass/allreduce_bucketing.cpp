@@ -0,0 +1,154 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr size_t pass::AllReduceBucketing::s_default_bucket_bytes;
+
+size_t pass::AllReduceBucketing::get_default_bucket_bytes()
+{
+    int32_t bucket_bytes = getenv_int("NGRAPH_ALLREDUCE_BUCKET_BYTES");
+    return bucket_bytes > 0 ? static_cast<size_t>(bucket_bytes) : s_default_bucket_bytes;
+}
+
+static void replace_bucket(const vector<shared_ptr<op::AllReduce>>& bucket)
+{
+    OutputVector flat_args;
+    for (auto& all_reduce : bucket)
+    {
+        auto arg = all_reduce->input_value(0);
+        const Shape& shape = arg.get_shape();
+        flat_args.push_back(make_shared<op::Reshape>(
+            arg, get_default_order(shape), Shape{shape_size(shape)}));
+    }
+    auto concat = make_shared<op::Concat>(flat_args, 0);
+    auto fused = make_shared<op::AllReduce>(concat, bucket.front()->get_reduce_type());
+
+    size_t offset = 0;
+    for (auto& all_reduce : bucket)
+    {
+        const Shape& shape = all_reduce->get_shape();
+        size_t count = shape_size(shape);
+        auto slice = make_shared<op::Slice>(fused, Coordinate{offset}, Coordinate{offset + count});
+        auto reshape = make_shared<op::Reshape>(slice, AxisVector{0}, shape);
+        replace_node(all_reduce, reshape);
+        offset += count;
+    }
+}
+
+bool pass::AllReduceBucketing::run_on_function(shared_ptr<Function> function)
+{
+    using BucketKey = pair<element::Type_t, reduction::Type>;
+    struct Bucket
+    {
+        vector<shared_ptr<op::AllReduce>> members;
+        // Position in topological order of the first member
+        size_t begin = 0;
+        size_t bytes = 0;
+    };
+
+    auto ops = function->get_ordered_ops();
+    if (none_of(ops.begin(), ops.end(), [](const shared_ptr<Node>& node) {
+            return is_type<op::AllReduce>(node);
+        }))
+    {
+        return false;
+    }
+
+    // Buckets under construction, keyed by element type and reduction
+    map<BucketKey, Bucket> open_buckets;
+    vector<vector<shared_ptr<op::AllReduce>>> full_buckets;
+
+    // For every node, the position (counting from 1, 0 for none) of the latest bucketed
+    // AllReduce of any key it depends on. An AllReduce only joins a bucket that started after
+    // everything bucketed it depends on, so every dependency between fused AllReduces goes
+    // from a bucket that started earlier to one that started later, and fusing cannot create
+    // a cycle, even through AllReduces of other keys. One walk over the graph replaces a
+    // search per AllReduce.
+    unordered_map<Node*, size_t> latest_dependency;
+
+    size_t position = 0;
+    for (auto& node : ops)
+    {
+        position++;
+        size_t& latest = latest_dependency[node.get()];
+        for (auto& input : node->inputs())
+        {
+            latest = std::max(latest, latest_dependency[input.get_source_output().get_node()]);
+        }
+        for (auto& control_dep : node->get_control_dependencies())
+        {
+            latest = std::max(latest, latest_dependency[control_dep.get()]);
+        }
+
+        auto all_reduce = as_type_ptr<op::AllReduce>(node);
+        if (!all_reduce)
+        {
+            continue;
+        }
+        size_t bytes = shape_size(all_reduce->get_shape()) * all_reduce->get_element_type().size();
+        if (bytes == 0 || bytes > m_bucket_bytes)
+        {
+            continue;
+        }
+
+        BucketKey key{all_reduce->get_element_type(), all_reduce->get_reduce_type()};
+        auto& bucket = open_buckets[key];
+        if (bucket.bytes + bytes > m_bucket_bytes ||
+            (!bucket.members.empty() && latest >= bucket.begin))
+        {
+            full_buckets.push_back(move(bucket.members));
+            bucket = Bucket();
+        }
+        if (bucket.members.empty())
+        {
+            bucket.begin = position;
+        }
+        bucket.members.push_back(all_reduce);
+        bucket.bytes += bytes;
+        latest = position;
+    }
+    for (auto& bucket : open_buckets)
+    {
+        full_buckets.push_back(move(bucket.second.members));
+    }
+
+    bool replaced = false;
+    for (auto& bucket : full_buckets)
+    {
+        if (bucket.size() > 1)
+        {
+            NGRAPH_DEBUG << "AllReduceBucketing: fusing " << bucket.size() << " AllReduce ops";
+            replace_bucket(bucket);
+            replaced = true;
+        }
+    }
+    return replaced;
+}
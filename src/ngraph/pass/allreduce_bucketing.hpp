@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Packs small AllReduce ops into flat buckets.
+        ///
+        /// AllReduce ops with the same element type and reduction are grouped, in topological
+        /// order, into buckets of at most bucket_bytes. Each bucket with more than one member
+        /// is rewritten as: flatten every argument, Concat them, run a single AllReduce on the
+        /// result and Slice each member's range back out. Backends that run Concat and Slice
+        /// in place (e.g. the CPU backend) turn this into one communication call per bucket
+        /// with no extra copies. AllReduce ops larger than bucket_bytes are left alone.
+        class NGRAPH_API AllReduceBucketing : public FunctionPass
+        {
+        public:
+            static constexpr size_t s_default_bucket_bytes = 16 * 1024 * 1024;
+
+            AllReduceBucketing(size_t bucket_bytes = get_default_bucket_bytes())
+                : m_bucket_bytes(bucket_bytes)
+            {
+                set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+            }
+            bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+            /// \brief Bucket size from NGRAPH_ALLREDUCE_BUCKET_BYTES, or s_default_bucket_bytes
+            static size_t get_default_bucket_bytes();
+
+        private:
+            size_t m_bucket_bytes;
+        };
+    }
+}
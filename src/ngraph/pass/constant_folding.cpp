@@ -15,13 +15,15 @@
 //*****************************************************************************
 
 #include "constant_folding.hpp"
+#include "ngraph/env_util.hpp"
+#include "ngraph/thread_pool.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 bool ngraph::pass::revalidate_and_ensure_static(shared_ptr<Node> n)
 {
-    n->revalidate_and_infer_types();
+    n->revalidate_and_infer_types_if_dirty();
     for (auto& o : n->outputs())
     {
         if (o.get_partial_shape().is_dynamic() || o.get_element_type().is_dynamic())
@@ -31,3 +33,33 @@ bool ngraph::pass::revalidate_and_ensure_static(shared_ptr<Node> n)
     }
     return true;
 }
+
+void ngraph::pass::parallel_fold(size_t count,
+                                 size_t num_threads,
+                                 const function<void(size_t begin, size_t end)>& func)
+{
+    ThreadPool::get_shared().parallel_for(count, min_fold_elements_per_thread, num_threads, func);
+}
+
+size_t pass::ConstantFolding::get_default_num_threads()
+{
+    static int32_t s_num_threads = getenv_int("NGRAPH_CONSTANT_FOLDING_THREADS", 0);
+    if (s_num_threads == 0)
+    {
+        return ThreadPool::get_shared().get_max_threads();
+    }
+    return s_num_threads > 1 ? static_cast<size_t>(s_num_threads) : 1;
+}
+
+bool pass::ConstantFolding::run_on_function(shared_ptr<Function> f)
+{
+    m_generic_bytes_folded = 0;
+    bool rewritten = false;
+    if (m_generic_enabled && m_num_threads > 1)
+    {
+        // Fold the generically evaluable subgraphs up front, wave by wave, so independent
+        // nodes can be evaluated concurrently. The matchers below pick up whatever is left.
+        rewritten = run_generic_folding_in_parallel(f);
+    }
+    return GraphRewrite::run_on_function(f) || rewritten;
+}
@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <functional>
+
 #include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/util.hpp"
@@ -27,6 +30,29 @@ namespace ngraph
     {
         class ConstantFolding;
         bool revalidate_and_ensure_static(std::shared_ptr<ngraph::Node> n);
+
+        /// Smallest number of elements worth giving a thread of its own in a fold
+        constexpr size_t min_fold_elements_per_thread = 16384;
+
+        /// \brief Splits the computation of count output elements of a fold into contiguous
+        ///        ranges and runs func(begin, end) on them on up to num_threads threads of the
+        ///        shared ThreadPool.
+        void parallel_fold(size_t count,
+                           size_t num_threads,
+                           const std::function<void(size_t begin, size_t end)>& func);
+
+        /// \brief Evaluates `node` with the reference kernels, reading its arguments from the
+        ///        constants that feed it. Supported ops are Acos, ArgMax, ArgMin, Asin, Atan,
+        ///        AvgPool, Convolution, Cos, Cosh, Dot, Erf, Exp, Log, MaxPool, Sigmoid, Sin,
+        ///        Sinh, Softmax, Tan, Tanh and TopK (all v0), on non-boolean integral, f32 and
+        ///        f64 types.
+        /// \param num_threads Number of threads the kernel may be split across. Results do not
+        ///        depend on this value.
+        /// \returns One constant per output of `node`, or an empty vector if any input is not
+        ///          constant or the op/element type is not supported by the evaluator.
+        NGRAPH_API
+        OutputVector evaluate_on_constants(const std::shared_ptr<ngraph::Node>& node,
+                                           size_t num_threads = 1);
     }
 }
 
@@ -62,9 +88,13 @@ public:
         SPLIT,
         VARIADIC_SPLIT,
         ONE_HOT,
-        TILE
+        TILE,
+        GENERIC
     };
 
+    /// Default per-function limit, in bytes, on the constant data the generic folder may create.
+    static constexpr size_t s_default_generic_memory_budget = 64 * 1024 * 1024;
+
     ConstantFolding(const ngraph::BuildNodeExecutorMap& cfmap = ngraph::BuildNodeExecutorMap())
         : GraphRewrite()
     {
@@ -144,10 +174,30 @@ public:
             case CFTransformations::VARIADIC_SPLIT: construct_constant_variadic_split(); break;
             case CFTransformations::ONE_HOT: construct_constant_one_hot(); break;
             case CFTransformations::TILE: construct_constant_tile(); break;
+            case CFTransformations::GENERIC: construct_constant_generic(); break;
             }
         }
     }
 
+    /// \brief Additionally folds any op supported by \sa evaluate_on_constants whose inputs
+    ///        are all constant.
+    /// \param memory_budget Upper bound, per function, on the total size in bytes of the
+    ///        constants created by the generic folder.
+    void enable_generic_folding(size_t memory_budget = s_default_generic_memory_budget)
+    {
+        m_generic_memory_budget = memory_budget;
+        construct_constant_generic();
+    }
+
+    /// \brief Sets the number of threads used for folding. With more than one thread the
+    ///        kernels of large generic, Reshape, Transpose and Quantize folds are split across
+    ///        threads, and independent generic folds are evaluated concurrently; the folded
+    ///        graph is identical to the single-threaded one. Defaults to
+    ///        NGRAPH_CONSTANT_FOLDING_THREADS, or to the size of the shared ThreadPool if that
+    ///        is unset.
+    void set_num_threads(size_t num_threads) { m_num_threads = std::max<size_t>(num_threads, 1); }
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
 private:
     void construct_constant_reshape();
     void construct_constant_broadcast();
@@ -177,6 +227,16 @@ private:
     void construct_constant_variadic_split();
     void construct_constant_one_hot();
     void construct_constant_tile();
+    void construct_constant_generic();
+
+    bool is_generic_foldable(const std::shared_ptr<Node>& node, size_t& output_bytes);
+    bool run_generic_folding_in_parallel(std::shared_ptr<ngraph::Function> f);
 
     ngraph::BuildNodeExecutorMap m_cfmap;
+    bool m_generic_enabled = false;
+    size_t m_generic_memory_budget = s_default_generic_memory_budget;
+    size_t m_generic_bytes_folded = 0;
+    size_t m_num_threads = get_default_num_threads();
+
+    static size_t get_default_num_threads();
 };
@@ -0,0 +1,585 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <map>
+
+#include "constant_folding.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/acos.hpp"
+#include "ngraph/op/argmax.hpp"
+#include "ngraph/op/argmin.hpp"
+#include "ngraph/op/asin.hpp"
+#include "ngraph/op/atan.hpp"
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/cos.hpp"
+#include "ngraph/op/cosh.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/erf.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sin.hpp"
+#include "ngraph/op/sinh.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/tan.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/op/topk.hpp"
+#include "ngraph/runtime/reference/acos.hpp"
+#include "ngraph/runtime/reference/argmax.hpp"
+#include "ngraph/runtime/reference/argmin.hpp"
+#include "ngraph/runtime/reference/asin.hpp"
+#include "ngraph/runtime/reference/atan.hpp"
+#include "ngraph/runtime/reference/avg_pool.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/cos.hpp"
+#include "ngraph/runtime/reference/cosh.hpp"
+#include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/erf.hpp"
+#include "ngraph/runtime/reference/exp.hpp"
+#include "ngraph/runtime/reference/log.hpp"
+#include "ngraph/runtime/reference/max_pool.hpp"
+#include "ngraph/runtime/reference/sigmoid.hpp"
+#include "ngraph/runtime/reference/sin.hpp"
+#include "ngraph/runtime/reference/sinh.hpp"
+#include "ngraph/runtime/reference/softmax.hpp"
+#include "ngraph/runtime/reference/tan.hpp"
+#include "ngraph/runtime/reference/tanh.hpp"
+#include "ngraph/runtime/reference/topk.hpp"
+#include "ngraph/thread_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Ops the generic folder can evaluate. This tree has no per-op evaluate() hook, so every op
+// needs a dispatch to its reference kernel in evaluate_generic below; ops missing from this
+// list are left to the construct_constant_* matchers, or survive folding.
+static bool is_supported_generic_op(const Node* n)
+{
+    return is_type<op::Acos>(n) || is_type<op::ArgMax>(n) || is_type<op::ArgMin>(n) ||
+           is_type<op::Asin>(n) || is_type<op::Atan>(n) || is_type<op::v0::AvgPool>(n) ||
+           is_type<op::v0::Convolution>(n) || is_type<op::Cos>(n) || is_type<op::Cosh>(n) ||
+           is_type<op::Dot>(n) || is_type<op::Erf>(n) || is_type<op::Exp>(n) ||
+           is_type<op::Log>(n) || is_type<op::v0::MaxPool>(n) || is_type<op::Sigmoid>(n) ||
+           is_type<op::Sin>(n) || is_type<op::Sinh>(n) || is_type<op::v0::Softmax>(n) ||
+           is_type<op::Tan>(n) || is_type<op::Tanh>(n) || is_type<op::v0::TopK>(n);
+}
+
+template <typename T>
+static void evaluate_unary(void (*kernel)(const T*, T*, size_t),
+                           const T* arg,
+                           runtime::AlignedBuffer& output,
+                           size_t count,
+                           size_t num_threads)
+{
+    T* out = output.get_ptr<T>();
+    pass::parallel_fold(count, num_threads, [&](size_t begin, size_t end) {
+        kernel(arg + begin, out + begin, end - begin);
+    });
+}
+
+template <typename T, typename U>
+static void evaluate_index_op(const Node* node, const T* arg, U* out)
+{
+    if (auto argmax = as_type<const op::ArgMax>(node))
+    {
+        runtime::reference::argmax<T, U>(arg,
+                                         out,
+                                         node->get_input_shape(0),
+                                         node->get_output_shape(0),
+                                         argmax->get_reduction_axis());
+    }
+    else if (auto argmin = as_type<const op::ArgMin>(node))
+    {
+        runtime::reference::argmin<T, U>(arg,
+                                         out,
+                                         node->get_input_shape(0),
+                                         node->get_output_shape(0),
+                                         argmin->get_reduction_axis());
+    }
+}
+
+template <typename T, typename U>
+static void evaluate_topk(const op::v0::TopK* topk,
+                          const T* arg,
+                          vector<runtime::AlignedBuffer>& outputs)
+{
+    runtime::reference::topk<T, U>(arg,
+                                   outputs[0].get_ptr<U>(),
+                                   outputs[1].get_ptr<T>(),
+                                   topk->get_input_shape(0),
+                                   topk->get_output_shape(0),
+                                   topk->get_top_k_axis(),
+                                   topk->get_k(),
+                                   topk->get_compute_max(),
+                                   topk->get_sort());
+}
+
+template <typename T>
+static bool evaluate_generic(const Node* node,
+                             const vector<const op::Constant*>& args,
+                             vector<runtime::AlignedBuffer>& outputs,
+                             size_t num_threads)
+{
+    const T* arg0 = args[0]->get_data_ptr<T>();
+    size_t count = shape_size(node->get_output_shape(0));
+
+    if (is_type<op::Acos>(node))
+    {
+        evaluate_unary<T>(runtime::reference::acos<T>, arg0, outputs[0], count, num_threads);
+    }
+    else if (is_type<op::Asin>(node))
+    {
+        evaluate_unary<T>(runtime::reference::asin<T>, arg0, outputs[0], count, num_threads);
+    }
+    else if (is_type<op::Atan>(node))
+    {
+        evaluate_unary<T>(runtime::reference::atan<T>, arg0, outputs[0], count, num_threads);
+    }
+    else if (is_type<op::Cos>(node))
+    {
+        evaluate_unary<T>(runtime::reference::cos<T>, arg0, outputs[0], count, num_threads);
+    }
+    else if (is_type<op::Cosh>(node))
+    {
+        evaluate_unary<T>(runtime::reference::cosh<T>, arg0, outputs[0], count, num_threads);
+    }
+    else if (is_type<op::Erf>(node))
+    {
+        evaluate_unary<T>(runtime::reference::erf<T>, arg0, outputs[0], count, num_threads);
+    }
+    else if (is_type<op::Exp>(node))
+    {
+        evaluate_unary<T>(runtime::reference::exp<T>, arg0, outputs[0], count, num_threads);
+    }
+    else if (is_type<op::Log>(node))
+    {
+        evaluate_unary<T>(runtime::reference::log<T>, arg0, outputs[0], count, num_threads);
+    }
+    else if (is_type<op::Sigmoid>(node))
+    {
+        evaluate_unary<T>(runtime::reference::sigmoid<T>, arg0, outputs[0], count, num_threads);
+    }
+    else if (is_type<op::Sin>(node))
+    {
+        evaluate_unary<T>(runtime::reference::sin<T>, arg0, outputs[0], count, num_threads);
+    }
+    else if (is_type<op::Sinh>(node))
+    {
+        evaluate_unary<T>(runtime::reference::sinh<T>, arg0, outputs[0], count, num_threads);
+    }
+    else if (is_type<op::Tan>(node))
+    {
+        evaluate_unary<T>(runtime::reference::tan<T>, arg0, outputs[0], count, num_threads);
+    }
+    else if (is_type<op::Tanh>(node))
+    {
+        evaluate_unary<T>(runtime::reference::tanh<T>, arg0, outputs[0], count, num_threads);
+    }
+    else if (auto dot = as_type<const op::Dot>(node))
+    {
+        if (args[1]->get_element_type() != args[0]->get_element_type())
+        {
+            return false;
+        }
+        const Shape& arg0_shape = node->get_input_shape(0);
+        const Shape& out_shape = node->get_output_shape(0);
+        size_t reduction_axes_count = dot->get_reduction_axes_count();
+        T* out = outputs[0].get_ptr<T>();
+        if (arg0_shape.size() > reduction_axes_count && shape_size(out_shape) > 0)
+        {
+            // The leading axis of arg0 is a free axis, so rows of arg0 map to contiguous
+            // blocks of the output and can be computed independently.
+            size_t arg0_row = shape_size(arg0_shape) / arg0_shape[0];
+            size_t out_row = shape_size(out_shape) / out_shape[0];
+            size_t min_rows = pass::min_fold_elements_per_thread / std::max<size_t>(out_row, 1);
+            auto fold_rows = [&](size_t begin, size_t end) {
+                Shape arg0_chunk = arg0_shape;
+                Shape out_chunk = out_shape;
+                arg0_chunk[0] = out_chunk[0] = end - begin;
+                runtime::reference::dot<T, T, T>(arg0 + begin * arg0_row,
+                                                 args[1]->get_data_ptr<T>(),
+                                                 out + begin * out_row,
+                                                 arg0_chunk,
+                                                 node->get_input_shape(1),
+                                                 out_chunk,
+                                                 reduction_axes_count);
+            };
+            ThreadPool::get_shared().parallel_for(
+                arg0_shape[0], min_rows, num_threads, fold_rows);
+        }
+        else
+        {
+            runtime::reference::dot<T, T, T>(arg0,
+                                             args[1]->get_data_ptr<T>(),
+                                             out,
+                                             arg0_shape,
+                                             node->get_input_shape(1),
+                                             out_shape,
+                                             reduction_axes_count);
+        }
+    }
+    else if (auto conv = as_type<const op::v0::Convolution>(node))
+    {
+        if (args[1]->get_element_type() != args[0]->get_element_type())
+        {
+            return false;
+        }
+        runtime::reference::convolution<T, T, T, T>(arg0,
+                                                    args[1]->get_data_ptr<T>(),
+                                                    outputs[0].get_ptr<T>(),
+                                                    node->get_input_shape(0),
+                                                    node->get_input_shape(1),
+                                                    node->get_output_shape(0),
+                                                    conv->get_window_movement_strides(),
+                                                    conv->get_window_dilation_strides(),
+                                                    conv->get_padding_below(),
+                                                    conv->get_padding_above(),
+                                                    conv->get_data_dilation_strides());
+    }
+    else if (auto softmax = as_type<const op::v0::Softmax>(node))
+    {
+        runtime::reference::softmax<T>(
+            arg0, outputs[0].get_ptr<T>(), node->get_output_shape(0), softmax->get_axes());
+    }
+    else if (auto max_pool = as_type<const op::v0::MaxPool>(node))
+    {
+        runtime::reference::max_pool<T>(arg0,
+                                        outputs[0].get_ptr<T>(),
+                                        node->get_input_shape(0),
+                                        node->get_output_shape(0),
+                                        max_pool->get_window_shape(),
+                                        max_pool->get_window_movement_strides(),
+                                        max_pool->get_padding_below(),
+                                        max_pool->get_padding_above());
+    }
+    else if (auto avg_pool = as_type<const op::v0::AvgPool>(node))
+    {
+        runtime::reference::avg_pool<T>(arg0,
+                                        outputs[0].get_ptr<T>(),
+                                        node->get_input_shape(0),
+                                        node->get_output_shape(0),
+                                        avg_pool->get_window_shape(),
+                                        avg_pool->get_window_movement_strides(),
+                                        avg_pool->get_padding_below(),
+                                        avg_pool->get_padding_above(),
+                                        avg_pool->get_include_padding_in_avg_computation());
+    }
+    else if (is_type<op::ArgMax>(node) || is_type<op::ArgMin>(node))
+    {
+        auto index_type = node->get_output_element_type(0);
+        if (index_type == element::i64)
+        {
+            evaluate_index_op<T, int64_t>(node, arg0, outputs[0].get_ptr<int64_t>());
+        }
+        else if (index_type == element::i32)
+        {
+            evaluate_index_op<T, int32_t>(node, arg0, outputs[0].get_ptr<int32_t>());
+        }
+        else
+        {
+            return false;
+        }
+    }
+    else if (auto topk = as_type<const op::v0::TopK>(node))
+    {
+        auto index_type = node->get_output_element_type(0);
+        if (index_type == element::i64)
+        {
+            evaluate_topk<T, int64_t>(topk, arg0, outputs);
+        }
+        else if (index_type == element::i32)
+        {
+            evaluate_topk<T, int32_t>(topk, arg0, outputs);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+// Evaluates node into freshly allocated output buffers. Touches no shared graph state, so it
+// may run concurrently for different nodes.
+static bool evaluate_into_buffers(const Node* node,
+                                  vector<runtime::AlignedBuffer>& outputs,
+                                  size_t num_threads)
+{
+    if (!is_supported_generic_op(node) || node->get_input_size() == 0)
+    {
+        return false;
+    }
+
+    vector<const op::Constant*> args;
+    for (auto& input : node->inputs())
+    {
+        auto constant = as_type<const op::Constant>(input.get_source_output().get_node());
+        if (constant == nullptr)
+        {
+            return false;
+        }
+        args.push_back(constant);
+    }
+
+    outputs.clear();
+    for (auto& output : node->outputs())
+    {
+        outputs.emplace_back(shape_size(output.get_shape()) * output.get_element_type().size());
+    }
+
+    switch (args[0]->get_element_type())
+    {
+    case element::Type_t::f32: return evaluate_generic<float>(node, args, outputs, num_threads);
+    case element::Type_t::f64: return evaluate_generic<double>(node, args, outputs, num_threads);
+    case element::Type_t::i8: return evaluate_generic<int8_t>(node, args, outputs, num_threads);
+    case element::Type_t::i16: return evaluate_generic<int16_t>(node, args, outputs, num_threads);
+    case element::Type_t::i32: return evaluate_generic<int32_t>(node, args, outputs, num_threads);
+    case element::Type_t::i64: return evaluate_generic<int64_t>(node, args, outputs, num_threads);
+    case element::Type_t::u8: return evaluate_generic<uint8_t>(node, args, outputs, num_threads);
+    case element::Type_t::u16:
+        return evaluate_generic<uint16_t>(node, args, outputs, num_threads);
+    case element::Type_t::u32:
+        return evaluate_generic<uint32_t>(node, args, outputs, num_threads);
+    case element::Type_t::u64:
+        return evaluate_generic<uint64_t>(node, args, outputs, num_threads);
+    case element::Type_t::undefined:
+    case element::Type_t::dynamic:
+    case element::Type_t::u1:
+    case element::Type_t::boolean:
+    case element::Type_t::bf16:
+    case element::Type_t::f16: break;
+    }
+    return false;
+}
+
+static OutputVector make_output_constants(const shared_ptr<Node>& node,
+                                          vector<runtime::AlignedBuffer>& outputs)
+{
+    OutputVector replacements;
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        replacements.push_back(make_shared<op::Constant>(
+            node->get_output_element_type(i), node->get_output_shape(i), outputs[i].get_ptr()));
+    }
+    return replacements;
+}
+
+static void replace_outputs(const shared_ptr<Node>& node, const OutputVector& replacements)
+{
+    for (auto& output : node->outputs())
+    {
+        auto& replacement = replacements.at(output.get_index());
+        for (auto& target : output.get_target_inputs())
+        {
+            // Multi-output v0 ops are consumed through GetOutputElement, which must be
+            // bypassed since the replacement constants have a single output each.
+            auto goe = as_type<op::GetOutputElement>(target.get_node());
+            if (goe != nullptr)
+            {
+                replace_node(goe->shared_from_this(), replacement.get_node_shared_ptr());
+            }
+            else
+            {
+                target.replace_source_output(replacement);
+            }
+        }
+    }
+}
+
+OutputVector pass::evaluate_on_constants(const shared_ptr<Node>& node, size_t num_threads)
+{
+    vector<runtime::AlignedBuffer> outputs;
+    if (!evaluate_into_buffers(node.get(), outputs, num_threads))
+    {
+        return OutputVector{};
+    }
+    return make_output_constants(node, outputs);
+}
+
+bool pass::ConstantFolding::is_generic_foldable(const shared_ptr<Node>& node,
+                                                size_t& output_bytes)
+{
+    if (!is_supported_generic_op(node.get()))
+    {
+        return false;
+    }
+
+    for (auto& input : node->inputs())
+    {
+        if (!input.get_source_output().get_node()->is_constant())
+        {
+            return false;
+        }
+    }
+
+    if (!revalidate_and_ensure_static(node))
+    {
+        return false;
+    }
+
+    // The whole output is charged against the budget: the input constants may still have
+    // other users, so folding does not necessarily free them.
+    output_bytes = 0;
+    for (auto& output : node->outputs())
+    {
+        output_bytes += shape_size(output.get_shape()) * output.get_element_type().size();
+    }
+    if (m_generic_bytes_folded + output_bytes > m_generic_memory_budget)
+    {
+        NGRAPH_DEBUG << "Skipping generic folding of " << node->get_name()
+                     << ": memory budget exhausted";
+        return false;
+    }
+    return true;
+}
+
+bool pass::ConstantFolding::run_generic_folding_in_parallel(shared_ptr<Function> f)
+{
+    // Topological position of every node, so waves are always processed in the same order
+    map<Node*, size_t> order;
+    NodeVector candidates;
+    for (auto& node : f->get_ordered_ops())
+    {
+        order.emplace(node.get(), order.size());
+        candidates.push_back(node);
+    }
+
+    bool rewritten = false;
+    while (!candidates.empty())
+    {
+        // Every node whose inputs are all constant is independent of the others in this
+        // wave. Only consumers of the nodes folded in a wave can join the next one. Budget is
+        // reserved in topological order so the selection is deterministic.
+        NodeVector wave;
+        vector<size_t> output_bytes;
+        for (auto& node : candidates)
+        {
+            size_t bytes = 0;
+            if (is_generic_foldable(node, bytes))
+            {
+                wave.push_back(node);
+                output_bytes.push_back(bytes);
+                m_generic_bytes_folded += bytes;
+            }
+        }
+        if (wave.empty())
+        {
+            break;
+        }
+
+        size_t outer_threads = std::min(m_num_threads, wave.size());
+        size_t kernel_threads = std::max<size_t>(1, m_num_threads / outer_threads);
+        vector<vector<runtime::AlignedBuffer>> results(wave.size());
+        vector<char> evaluated(wave.size(), 0);
+        ThreadPool::get_shared().parallel_for(wave.size(), outer_threads, [&](size_t i) {
+            evaluated[i] = evaluate_into_buffers(wave[i].get(), results[i], kernel_threads);
+        });
+
+        // Constants are created and spliced in topological order on this thread so node
+        // names and the resulting graph do not depend on thread scheduling.
+        map<size_t, shared_ptr<Node>> next;
+        auto add_candidate = [&](Node* node) {
+            auto it = order.find(node);
+            if (it != order.end())
+            {
+                next.emplace(it->second, node->shared_from_this());
+            }
+        };
+        for (size_t i = 0; i < wave.size(); i++)
+        {
+            if (!evaluated[i])
+            {
+                m_generic_bytes_folded -= output_bytes[i];
+                continue;
+            }
+            for (auto& output : wave[i]->outputs())
+            {
+                for (auto& target : output.get_target_inputs())
+                {
+                    Node* consumer = target.get_node();
+                    if (is_type<op::GetOutputElement>(consumer))
+                    {
+                        for (auto& goe_target : consumer->output(0).get_target_inputs())
+                        {
+                            add_candidate(goe_target.get_node());
+                        }
+                    }
+                    else
+                    {
+                        add_candidate(consumer);
+                    }
+                }
+            }
+            replace_outputs(wave[i], make_output_constants(wave[i], results[i]));
+            rewritten = true;
+        }
+        candidates.clear();
+        for (auto& entry : next)
+        {
+            candidates.push_back(entry.second);
+        }
+    }
+    return rewritten;
+}
+
+void pass::ConstantFolding::construct_constant_generic()
+{
+    // GENERIC and enable_generic_folding may both ask for the matcher; a second copy would
+    // only try every node again
+    if (m_generic_enabled)
+    {
+        return;
+    }
+    m_generic_enabled = true;
+
+    auto generic_label =
+        make_shared<pattern::op::Label>(element::f32, Shape{2, 3}, [](shared_ptr<Node> n) {
+            return is_supported_generic_op(n.get());
+        });
+
+    auto constant_generic_callback = [this](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for constant_generic_callback against node = "
+                     << m.get_match_root()->get_name();
+
+        auto node = m.get_match_root();
+        size_t output_bytes = 0;
+        if (!is_generic_foldable(node, output_bytes))
+        {
+            return false;
+        }
+
+        OutputVector replacements = evaluate_on_constants(node, m_num_threads);
+        if (replacements.empty())
+        {
+            return false;
+        }
+        m_generic_bytes_folded += output_bytes;
+        replace_outputs(node, replacements);
+        return true;
+    };
+
+    auto generic_matcher =
+        make_shared<pattern::Matcher>(generic_label, "ConstantFolding.ConstantGeneric");
+    this->add_matcher(
+        generic_matcher, constant_generic_callback, PassProperty::CHANGE_DYNAMIC_STATE);
+}
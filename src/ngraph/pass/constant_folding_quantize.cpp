@@ -17,6 +17,7 @@
 #include "constant_folding.hpp"
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/thread_pool.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -25,20 +26,56 @@ template <class REAL, class QUANT>
 shared_ptr<op::Constant> fold_constant_quantize(shared_ptr<op::Constant> constant,
                                                 shared_ptr<op::Quantize> quant,
                                                 shared_ptr<op::Constant> scale,
-                                                shared_ptr<op::Constant> offset)
+                                                shared_ptr<op::Constant> offset,
+                                                size_t num_threads)
 {
     const Shape& out_shape = constant->get_shape();
     runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(QUANT));
     QUANT* data_ptr = buffer.get_ptr<QUANT>();
-
-    runtime::reference::quantize<REAL, QUANT>(constant->get_vector<REAL>().data(),
-                                              scale->get_vector<REAL>().data(),
-                                              offset->get_vector<QUANT>().data(),
-                                              data_ptr,
-                                              constant->get_shape(),
-                                              scale->get_shape(),
-                                              quant->get_axes(),
-                                              quant->get_round_mode());
+    const REAL* input = constant->get_data_ptr<REAL>();
+    const REAL* scale_ptr = scale->get_data_ptr<REAL>();
+    const QUANT* offset_ptr = offset->get_data_ptr<QUANT>();
+    const AxisSet& axes = quant->get_axes();
+
+    if (num_threads > 1 && !out_shape.empty() && out_shape[0] > 1)
+    {
+        // Blocks along the leading axis are quantized independently. When the leading axis
+        // is a quantization axis it is also the leading axis of scale and offset, which are
+        // split the same way.
+        size_t row = shape_size(out_shape) / out_shape[0];
+        bool per_row = axes.count(0) != 0;
+        size_t scale_row = per_row ? shape_size(scale->get_shape()) / out_shape[0] : 0;
+        size_t min_rows = pass::min_fold_elements_per_thread / std::max<size_t>(row, 1);
+        auto fold_rows = [&](size_t begin, size_t end) {
+            Shape in_chunk = out_shape;
+            in_chunk[0] = end - begin;
+            Shape scale_chunk = scale->get_shape();
+            if (per_row)
+            {
+                scale_chunk[0] = end - begin;
+            }
+            runtime::reference::quantize<REAL, QUANT>(input + begin * row,
+                                                      scale_ptr + begin * scale_row,
+                                                      offset_ptr + begin * scale_row,
+                                                      data_ptr + begin * row,
+                                                      in_chunk,
+                                                      scale_chunk,
+                                                      axes,
+                                                      quant->get_round_mode());
+        };
+        ThreadPool::get_shared().parallel_for(out_shape[0], min_rows, num_threads, fold_rows);
+    }
+    else
+    {
+        runtime::reference::quantize<REAL, QUANT>(input,
+                                                  scale_ptr,
+                                                  offset_ptr,
+                                                  data_ptr,
+                                                  out_shape,
+                                                  scale->get_shape(),
+                                                  axes,
+                                                  quant->get_round_mode());
+    }
 
     return make_shared<op::Constant>(quant->get_element_type(), out_shape, data_ptr);
 }
@@ -54,7 +91,7 @@ void pass::ConstantFolding::construct_constant_quantize()
         make_shared<op::Quantize>(constant_label, q_scale, q_offset, element::i8, AxisSet{}, mode);
     auto quant = make_shared<pattern::op::Label>(quant_op, nullptr, NodeVector{quant_op});
 
-    auto constant_quantize_callback = [constant_label, quant](pattern::Matcher& m) {
+    auto constant_quantize_callback = [this, constant_label, quant](pattern::Matcher& m) {
         NGRAPH_DEBUG << "In callback for constant_quantize_callback against node = "
                      << m.get_match_root()->get_name();
 
@@ -81,14 +118,16 @@ void pass::ConstantFolding::construct_constant_quantize()
         {
             replace_node(
                 m.get_match_root(),
-                fold_constant_quantize<float, uint8_t>(constant_match, quantize_op, scale, offset));
+                fold_constant_quantize<float, uint8_t>(
+                    constant_match, quantize_op, scale, offset, m_num_threads));
             return true;
         }
         else if (type == element::i8)
         {
             replace_node(
                 m.get_match_root(),
-                fold_constant_quantize<float, int8_t>(constant_match, quantize_op, scale, offset));
+                fold_constant_quantize<float, int8_t>(
+                    constant_match, quantize_op, scale, offset, m_num_threads));
             return true;
         }
 
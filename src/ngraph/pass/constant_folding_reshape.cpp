@@ -24,7 +24,8 @@ using namespace ngraph;
 template <class T>
 shared_ptr<op::Constant> fold_constant_reshape(shared_ptr<op::Constant> constant,
                                                shared_ptr<op::Reshape> reshape,
-                                               NodeExecutorTy func)
+                                               NodeExecutorTy func,
+                                               size_t num_threads)
 {
     const Shape& out_shape = reshape->get_shape();
     runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(T));
@@ -39,6 +40,17 @@ shared_ptr<op::Constant> fold_constant_reshape(shared_ptr<op::Constant> constant
 
         func(inputs, outputs);
     }
+    else if (num_threads > 1)
+    {
+        pass::parallel_fold(shape_size(out_shape), num_threads, [&](size_t begin, size_t end) {
+            runtime::opt_kernel::reshape_range<T>(constant->get_data_ptr<T>(),
+                                                  data_ptr,
+                                                  constant->get_shape(),
+                                                  reshape->get_input_order(),
+                                                  begin,
+                                                  end);
+        });
+    }
     else
     {
         runtime::opt_kernel::reshape<T>(constant->get_data_ptr<T>(),
@@ -92,43 +104,56 @@ void pass::ConstantFolding::construct_constant_reshape()
             NGRAPH_CHECK(false, "Encountered 'u1' element type in constant_reshape_callback");
             break;
         case element::Type_t::boolean:
-            replacement = fold_constant_reshape<char>(constant_match, reshape_match, func);
+            replacement = fold_constant_reshape<char>(
+                constant_match, reshape_match, func, m_num_threads);
             break;
         case element::Type_t::bf16:
-            replacement = fold_constant_reshape<bfloat16>(constant_match, reshape_match, func);
+            replacement = fold_constant_reshape<bfloat16>(
+                constant_match, reshape_match, func, m_num_threads);
             break;
         case element::Type_t::f16:
-            replacement = fold_constant_reshape<float16>(constant_match, reshape_match, func);
+            replacement = fold_constant_reshape<float16>(
+                constant_match, reshape_match, func, m_num_threads);
             break;
         case element::Type_t::f32:
-            replacement = fold_constant_reshape<float>(constant_match, reshape_match, func);
+            replacement = fold_constant_reshape<float>(
+                constant_match, reshape_match, func, m_num_threads);
             break;
         case element::Type_t::f64:
-            replacement = fold_constant_reshape<double>(constant_match, reshape_match, func);
+            replacement = fold_constant_reshape<double>(
+                constant_match, reshape_match, func, m_num_threads);
             break;
         case element::Type_t::i8:
-            replacement = fold_constant_reshape<int8_t>(constant_match, reshape_match, func);
+            replacement = fold_constant_reshape<int8_t>(
+                constant_match, reshape_match, func, m_num_threads);
             break;
         case element::Type_t::i16:
-            replacement = fold_constant_reshape<int16_t>(constant_match, reshape_match, func);
+            replacement = fold_constant_reshape<int16_t>(
+                constant_match, reshape_match, func, m_num_threads);
             break;
         case element::Type_t::i32:
-            replacement = fold_constant_reshape<int32_t>(constant_match, reshape_match, func);
+            replacement = fold_constant_reshape<int32_t>(
+                constant_match, reshape_match, func, m_num_threads);
             break;
         case element::Type_t::i64:
-            replacement = fold_constant_reshape<int64_t>(constant_match, reshape_match, func);
+            replacement = fold_constant_reshape<int64_t>(
+                constant_match, reshape_match, func, m_num_threads);
             break;
         case element::Type_t::u8:
-            replacement = fold_constant_reshape<uint8_t>(constant_match, reshape_match, func);
+            replacement = fold_constant_reshape<uint8_t>(
+                constant_match, reshape_match, func, m_num_threads);
             break;
         case element::Type_t::u16:
-            replacement = fold_constant_reshape<uint16_t>(constant_match, reshape_match, func);
+            replacement = fold_constant_reshape<uint16_t>(
+                constant_match, reshape_match, func, m_num_threads);
             break;
         case element::Type_t::u32:
-            replacement = fold_constant_reshape<uint32_t>(constant_match, reshape_match, func);
+            replacement = fold_constant_reshape<uint32_t>(
+                constant_match, reshape_match, func, m_num_threads);
             break;
         case element::Type_t::u64:
-            replacement = fold_constant_reshape<uint64_t>(constant_match, reshape_match, func);
+            replacement = fold_constant_reshape<uint64_t>(
+                constant_match, reshape_match, func, m_num_threads);
             break;
         }
 
@@ -24,18 +24,33 @@ using namespace ngraph;
 template <class T>
 shared_ptr<op::Constant> fold_constant_transpose(shared_ptr<op::Constant> constant_data,
                                                  shared_ptr<op::Constant> constant_perm,
-                                                 shared_ptr<op::Transpose> transpose)
+                                                 shared_ptr<op::Transpose> transpose,
+                                                 size_t num_threads)
 {
     const Shape& out_shape = transpose->get_shape();
     auto input_order = constant_perm->get_axis_vector_val();
 
     runtime::AlignedBuffer buffer(shape_size(out_shape) * sizeof(T));
 
-    runtime::opt_kernel::reshape<T>(constant_data->get_data_ptr<T>(),
-                                    buffer.get_ptr<T>(),
-                                    constant_data->get_shape(),
-                                    input_order,
-                                    out_shape);
+    if (num_threads > 1)
+    {
+        pass::parallel_fold(shape_size(out_shape), num_threads, [&](size_t begin, size_t end) {
+            runtime::opt_kernel::reshape_range<T>(constant_data->get_data_ptr<T>(),
+                                                  buffer.get_ptr<T>(),
+                                                  constant_data->get_shape(),
+                                                  input_order,
+                                                  begin,
+                                                  end);
+        });
+    }
+    else
+    {
+        runtime::opt_kernel::reshape<T>(constant_data->get_data_ptr<T>(),
+                                        buffer.get_ptr<T>(),
+                                        constant_data->get_shape(),
+                                        input_order,
+                                        out_shape);
+    }
 
     return make_shared<op::Constant>(transpose->get_element_type(), out_shape, buffer.get_ptr<T>());
 }
@@ -48,8 +63,8 @@ void pass::ConstantFolding::construct_constant_transpose()
         make_shared<pattern::op::Label>(element::i64, Shape{2}, pattern::has_class<op::Constant>());
     auto transpose = make_shared<op::Transpose>(constant_data_label, constant_perm_label);
 
-    auto constant_transpose_callback = [constant_data_label,
-                                        constant_perm_label](pattern::Matcher& m) {
+    auto constant_transpose_callback = [this, constant_data_label, constant_perm_label](
+        pattern::Matcher& m) {
         NGRAPH_DEBUG << "In callback for constant_transpose_callback against node = "
                      << m.get_match_root()->get_name();
 
@@ -80,55 +95,55 @@ void pass::ConstantFolding::construct_constant_transpose()
             break;
         case element::Type_t::boolean:
             replacement = fold_constant_transpose<char>(
-                constant_data_match, constant_perm_match, transpose_match);
+                constant_data_match, constant_perm_match, transpose_match, m_num_threads);
             break;
         case element::Type_t::bf16:
             replacement = fold_constant_transpose<bfloat16>(
-                constant_data_match, constant_perm_match, transpose_match);
+                constant_data_match, constant_perm_match, transpose_match, m_num_threads);
             break;
         case element::Type_t::f16:
             replacement = fold_constant_transpose<float16>(
-                constant_data_match, constant_perm_match, transpose_match);
+                constant_data_match, constant_perm_match, transpose_match, m_num_threads);
             break;
         case element::Type_t::f32:
             replacement = fold_constant_transpose<float>(
-                constant_data_match, constant_perm_match, transpose_match);
+                constant_data_match, constant_perm_match, transpose_match, m_num_threads);
             break;
         case element::Type_t::f64:
             replacement = fold_constant_transpose<double>(
-                constant_data_match, constant_perm_match, transpose_match);
+                constant_data_match, constant_perm_match, transpose_match, m_num_threads);
             break;
         case element::Type_t::i8:
             replacement = fold_constant_transpose<int8_t>(
-                constant_data_match, constant_perm_match, transpose_match);
+                constant_data_match, constant_perm_match, transpose_match, m_num_threads);
             break;
         case element::Type_t::i16:
             replacement = fold_constant_transpose<int16_t>(
-                constant_data_match, constant_perm_match, transpose_match);
+                constant_data_match, constant_perm_match, transpose_match, m_num_threads);
             break;
         case element::Type_t::i32:
             replacement = fold_constant_transpose<int32_t>(
-                constant_data_match, constant_perm_match, transpose_match);
+                constant_data_match, constant_perm_match, transpose_match, m_num_threads);
             break;
         case element::Type_t::i64:
             replacement = fold_constant_transpose<int64_t>(
-                constant_data_match, constant_perm_match, transpose_match);
+                constant_data_match, constant_perm_match, transpose_match, m_num_threads);
             break;
         case element::Type_t::u8:
             replacement = fold_constant_transpose<uint8_t>(
-                constant_data_match, constant_perm_match, transpose_match);
+                constant_data_match, constant_perm_match, transpose_match, m_num_threads);
             break;
         case element::Type_t::u16:
             replacement = fold_constant_transpose<uint16_t>(
-                constant_data_match, constant_perm_match, transpose_match);
+                constant_data_match, constant_perm_match, transpose_match, m_num_threads);
             break;
         case element::Type_t::u32:
             replacement = fold_constant_transpose<uint32_t>(
-                constant_data_match, constant_perm_match, transpose_match);
+                constant_data_match, constant_perm_match, transpose_match, m_num_threads);
             break;
         case element::Type_t::u64:
             replacement = fold_constant_transpose<uint64_t>(
-                constant_data_match, constant_perm_match, transpose_match);
+                constant_data_match, constant_perm_match, transpose_match, m_num_threads);
             break;
         }
 
@@ -71,6 +71,8 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
     // it behind an environment variable for now. TODO: Find a less expensive way to handle this.
     static bool s_rerun_dynamic_check = getenv_bool("NGRAPH_GRAPH_REWRITE_RERUN_DYNAMIC_CHECK");
     bool is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
+    // Only nodes that are dirty since they were last validated need shape inference
+    static bool s_full_revalidation = getenv_bool("NGRAPH_FULL_REVALIDATION");
     do
     {
         rewritten = false;
@@ -82,7 +84,14 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         {
             if (m_enable_shape_inference)
             {
-                node->revalidate_and_infer_types();
+                if (s_full_revalidation)
+                {
+                    node->revalidate_and_infer_types();
+                }
+                else
+                {
+                    node->revalidate_and_infer_types_if_dirty();
+                }
             }
             for (auto& closure : matchers_to_run)
             {
@@ -104,6 +113,11 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
                     if (closure.callback(*closure.matcher.get()))
                     {
                         rewritten = true;
+                        // Callbacks may also change the matched nodes in place
+                        for (auto& value : closure.matcher->get_matched_values())
+                        {
+                            value.get_node()->mark_validation_dirty();
+                        }
                         // If call back may change function's is_dynamic state, we need to
                         // update the cached value.
                         if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
@@ -0,0 +1,217 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
+#include "ngraph/op/quantized_dot.hpp"
+#include "ngraph/pass/int8_quantization.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    struct Candidate
+    {
+        shared_ptr<Node> node;
+        shared_ptr<op::Constant> weights;
+        float data_scale;
+        float output_scale;
+    };
+
+    shared_ptr<Node> scale_constant(float scale)
+    {
+        return op::Constant::create(element::f32, Shape{}, {scale});
+    }
+
+    shared_ptr<Node> make_quantized_op(const Candidate& candidate,
+                                       const Output<Node>& data,
+                                       const shared_ptr<Node>& weights,
+                                       float weight_scale)
+    {
+        auto u8_zero = op::Constant::create(element::u8, Shape{}, {0});
+        auto i8_zero = op::Constant::create(element::i8, Shape{}, {0});
+        auto data_scale = scale_constant(candidate.data_scale);
+        auto output_scale = scale_constant(candidate.output_scale);
+        auto filter_scale = scale_constant(weight_scale);
+
+        if (auto conv = as_type_ptr<op::v0::Convolution>(candidate.node))
+        {
+            return make_shared<op::QuantizedConvolution>(data,
+                                                         weights,
+                                                         conv->get_window_movement_strides(),
+                                                         conv->get_window_dilation_strides(),
+                                                         conv->get_padding_below(),
+                                                         conv->get_padding_above(),
+                                                         conv->get_data_dilation_strides(),
+                                                         data_scale,
+                                                         u8_zero,
+                                                         filter_scale,
+                                                         i8_zero,
+                                                         output_scale,
+                                                         i8_zero,
+                                                         element::i8);
+        }
+        if (auto conv = as_type_ptr<op::v1::Convolution>(candidate.node))
+        {
+            return make_shared<op::QuantizedConvolution>(
+                data,
+                weights,
+                conv->get_strides(),
+                conv->get_dilations(),
+                conv->get_pads_begin(),
+                conv->get_pads_end(),
+                Strides(conv->get_strides().size(), 1),
+                data_scale,
+                u8_zero,
+                filter_scale,
+                i8_zero,
+                output_scale,
+                i8_zero,
+                element::i8);
+        }
+        auto dot = as_type_ptr<op::v0::Dot>(candidate.node);
+        return make_shared<op::QuantizedDot>(data,
+                                             weights,
+                                             dot->get_reduction_axes_count(),
+                                             data_scale,
+                                             u8_zero,
+                                             filter_scale,
+                                             i8_zero,
+                                             output_scale,
+                                             i8_zero,
+                                             element::i8,
+                                             AxisSet{},
+                                             AxisSet{},
+                                             AxisSet{});
+    }
+}
+
+bool pass::Int8Quantization::run_on_function(shared_ptr<Function> function)
+{
+    // Look up all ranges before rewriting anything: once an op is replaced, its consumers
+    // see the Dequantize instead of the output the table knows about.
+    vector<Candidate> candidates;
+    for (auto& node : function->get_ordered_ops())
+    {
+        if (!is_type<op::v0::Convolution>(node) && !is_type<op::v1::Convolution>(node) &&
+            !is_type<op::v0::Dot>(node))
+        {
+            continue;
+        }
+        auto weights = as_type_ptr<op::Constant>(node->input_value(1).get_node_shared_ptr());
+        if (node->get_output_element_type(0) != element::f32 || !weights)
+        {
+            continue;
+        }
+        // QuantizedDot is only implemented for matrix products; other Dots stay in float
+        if (auto dot = as_type_ptr<op::v0::Dot>(node))
+        {
+            auto is_matrix = [](const PartialShape& shape) {
+                return shape.rank().is_static() && shape.rank().get_length() == 2;
+            };
+            if (dot->get_reduction_axes_count() != 1 ||
+                !is_matrix(dot->get_input_partial_shape(0)) ||
+                !is_matrix(dot->get_input_partial_shape(1)))
+            {
+                NGRAPH_DEBUG << "Int8Quantization: " << node->get_name()
+                             << " is not a matrix product";
+                continue;
+            }
+        }
+        auto data_range = m_table.find(runtime::calibration_key(node->input_value(0)));
+        auto output_range = m_table.find(runtime::calibration_key(node->output(0)));
+        if (data_range == m_table.end() || output_range == m_table.end())
+        {
+            NGRAPH_DEBUG << "Int8Quantization: no calibration range for " << node->get_name();
+            continue;
+        }
+        float data_max = data_range->second.get_max();
+        if (data_range->second.get_min() < 0 || data_max <= 0)
+        {
+            NGRAPH_DEBUG << "Int8Quantization: data of " << node->get_name()
+                         << " is not non-negative";
+            continue;
+        }
+        float output_max =
+            max(fabs(output_range->second.get_min()), fabs(output_range->second.get_max()));
+        if (output_max <= 0)
+        {
+            continue;
+        }
+        candidates.push_back(Candidate{node, weights, data_max / 255, output_max / 127});
+    }
+
+    // Quantize each activation once even if several ops consume it
+    map<pair<Node*, size_t>, shared_ptr<Node>> quantized_data;
+    bool modified = false;
+    for (const Candidate& candidate : candidates)
+    {
+        vector<float> weight_values = candidate.weights->get_vector<float>();
+        float weight_max = 0;
+        for (float value : weight_values)
+        {
+            weight_max = max(weight_max, fabs(value));
+        }
+        if (weight_max == 0)
+        {
+            continue;
+        }
+        float weight_scale = weight_max / 127;
+        vector<int8_t> quantized_weights(weight_values.size());
+        for (size_t i = 0; i < weight_values.size(); i++)
+        {
+            float value = nearbyint(weight_values[i] / weight_scale);
+            quantized_weights[i] = static_cast<int8_t>(max(-127.0f, min(127.0f, value)));
+        }
+        auto weights = make_shared<op::Constant>(
+            element::i8, candidate.weights->get_shape(), quantized_weights);
+
+        Output<Node> data = candidate.node->input_value(0);
+        auto& quantized = quantized_data[make_pair(data.get_node(), data.get_index())];
+        if (!quantized)
+        {
+            quantized = make_shared<op::Quantize>(
+                data,
+                scale_constant(candidate.data_scale),
+                op::Constant::create(element::u8, Shape{}, {0}),
+                element::u8,
+                AxisSet{},
+                op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+        }
+
+        auto quantized_op = make_quantized_op(candidate, quantized, weights, weight_scale);
+        auto output_zero = op::Constant::create(element::i8, Shape{}, {0});
+        auto dequantize = make_shared<op::Dequantize>(quantized_op,
+                                                      scale_constant(candidate.output_scale),
+                                                      output_zero,
+                                                      element::f32,
+                                                      AxisSet{});
+        replace_node(candidate.node, dequantize);
+        modified = true;
+    }
+    return modified;
+}
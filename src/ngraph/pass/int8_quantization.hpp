@@ -0,0 +1,51 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/calibrator.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Rewrites f32 Convolution and Dot ops with constant weights into INT8 ops,
+        ///        using activation ranges recorded by runtime::Calibrator.
+        ///
+        /// Each rewritten op becomes
+        ///     Quantize(data, u8) -> QuantizedConvolution/QuantizedDot(u8 x i8 -> i8)
+        ///         -> Dequantize(f32)
+        /// with zero zero-points, which is the form the CPU backend's quantization fusions
+        /// expect. Weights are quantized symmetrically at rewrite time. An op is left in f32 if
+        /// its data or output is missing from the table or if its data range is not
+        /// non-negative, since the quantized kernels take unsigned activations. Per-channel
+        /// ranges are reduced to one range per tensor as the quantized ops take scalar scales.
+        class NGRAPH_API Int8Quantization : public FunctionPass
+        {
+        public:
+            Int8Quantization(const runtime::CalibrationTable& table)
+                : m_table(table)
+            {
+                set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+            }
+            bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+        private:
+            runtime::CalibrationTable m_table;
+        };
+    }
+}
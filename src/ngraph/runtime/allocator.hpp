@@ -31,6 +31,25 @@ namespace ngraph
         /// \brief Create a default allocator that calls into system
         ///        allocation libraries
         ngraph::runtime::Allocator* get_default_allocator();
+
+        /// \brief Allocation statistics reported by allocators that track them
+        struct AllocatorStats
+        {
+            /// Number of calls to malloc
+            size_t num_allocations = 0;
+            /// Number of calls to free
+            size_t num_frees = 0;
+            /// Bytes currently handed out to callers
+            size_t bytes_in_use = 0;
+            /// Largest value bytes_in_use has reached
+            size_t peak_bytes_in_use = 0;
+            /// Bytes currently held from the system, including cached blocks and rounding
+            size_t bytes_reserved = 0;
+            /// Allocations served from memory the allocator already held
+            size_t num_reused = 0;
+            /// Bytes currently backed by explicitly reserved huge pages
+            size_t bytes_in_huge_pages = 0;
+        };
     }
 }
 
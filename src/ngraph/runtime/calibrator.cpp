@@ -0,0 +1,413 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "ngraph/except.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/calibrator.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Histogram of |x| over [0, max_abs) with equally wide bins
+    struct ChannelStatistics
+    {
+        float min = numeric_limits<float>::infinity();
+        float max = -numeric_limits<float>::infinity();
+        float histogram_max = 0;
+        vector<double> histogram;
+    };
+
+    // Widens the histogram to cover max_abs. The range is doubled until it does, so every new
+    // bin is the union of a whole number of old bins and no counts are smeared.
+    void grow_histogram(ChannelStatistics& channel, float max_abs)
+    {
+        if (max_abs <= channel.histogram_max)
+        {
+            return;
+        }
+        if (channel.histogram_max == 0)
+        {
+            // Everything seen so far was zero and sits in bin 0, which stays correct
+            channel.histogram_max = max_abs;
+            return;
+        }
+        size_t factor = 1;
+        float range = channel.histogram_max;
+        while (range < max_abs)
+        {
+            range *= 2;
+            factor *= 2;
+        }
+        size_t bins = channel.histogram.size();
+        vector<double> merged(bins, 0);
+        for (size_t i = 0; i < bins; i++)
+        {
+            merged[i / factor] += channel.histogram[i];
+        }
+        channel.histogram.swap(merged);
+        channel.histogram_max = range;
+    }
+
+    float percentile_threshold(const ChannelStatistics& channel, double percentile)
+    {
+        const vector<double>& histogram = channel.histogram;
+        double total = 0;
+        for (double count : histogram)
+        {
+            total += count;
+        }
+        double target = total * percentile / 100;
+        double bin_width = static_cast<double>(channel.histogram_max) / histogram.size();
+        double cumulative = 0;
+        for (size_t i = 0; i < histogram.size(); i++)
+        {
+            cumulative += histogram[i];
+            if (cumulative >= target)
+            {
+                return static_cast<float>((i + 1) * bin_width);
+            }
+        }
+        return channel.histogram_max;
+    }
+
+    double kl_divergence(const vector<double>& p, const vector<double>& q, size_t size)
+    {
+        double p_sum = 0;
+        double q_sum = 0;
+        for (size_t i = 0; i < size; i++)
+        {
+            p_sum += p[i];
+            q_sum += q[i];
+        }
+        if (p_sum == 0 || q_sum == 0)
+        {
+            return numeric_limits<double>::infinity();
+        }
+        // Bins the quantized distribution leaves empty would make the divergence infinite
+        const double epsilon = 1e-10;
+        double divergence = 0;
+        for (size_t i = 0; i < size; i++)
+        {
+            if (p[i] > 0)
+            {
+                double p_i = p[i] / p_sum;
+                double q_i = std::max(q[i] / q_sum, epsilon);
+                divergence += p_i * log(p_i / q_i);
+            }
+        }
+        return divergence;
+    }
+
+    // Entropy calibration: for each candidate clipping bin i, folds the tail into bin i - 1,
+    // requantizes the first i bins into `levels` levels and keeps the i with the smallest
+    // divergence between the two.
+    float kl_threshold(const ChannelStatistics& channel, size_t levels)
+    {
+        const vector<double>& histogram = channel.histogram;
+        size_t bins = histogram.size();
+        if (bins <= levels)
+        {
+            return channel.histogram_max;
+        }
+
+        double total = 0;
+        for (double count : histogram)
+        {
+            total += count;
+        }
+
+        vector<double> reference(bins);
+        vector<double> quantized(bins);
+        double best_divergence = numeric_limits<double>::infinity();
+        size_t best_bins = bins;
+        double prefix = 0;
+        for (size_t i = 0; i < levels - 1; i++)
+        {
+            prefix += histogram[i];
+        }
+        for (size_t i = levels; i <= bins; i++)
+        {
+            prefix += histogram[i - 1];
+            copy(histogram.begin(), histogram.begin() + i, reference.begin());
+            reference[i - 1] += total - prefix;
+
+            for (size_t level = 0; level < levels; level++)
+            {
+                size_t begin = level * i / levels;
+                size_t end = (level + 1) * i / levels;
+                double level_count = 0;
+                size_t nonzero = 0;
+                for (size_t j = begin; j < end; j++)
+                {
+                    level_count += histogram[j];
+                    nonzero += reference[j] != 0;
+                }
+                for (size_t j = begin; j < end; j++)
+                {
+                    quantized[j] = reference[j] != 0 ? level_count / nonzero : 0;
+                }
+            }
+
+            double divergence = kl_divergence(reference, quantized, i);
+            if (divergence < best_divergence)
+            {
+                best_divergence = divergence;
+                best_bins = i;
+            }
+        }
+        return static_cast<float>(static_cast<double>(channel.histogram_max) * best_bins / bins);
+    }
+}
+
+class runtime::Calibrator::TensorStatistics
+{
+public:
+    TensorStatistics(const string& key, const CalibrationOptions& options)
+        : m_key(key)
+        , m_options(options)
+    {
+    }
+
+    const string& get_key() const { return m_key; }
+    void update(const float* data, const Shape& shape)
+    {
+        size_t channels = 1;
+        size_t inner = shape_size(shape);
+        if (m_options.per_channel && shape.size() > m_options.channel_axis)
+        {
+            channels = shape[m_options.channel_axis];
+            inner = 1;
+            for (size_t axis = m_options.channel_axis + 1; axis < shape.size(); axis++)
+            {
+                inner *= shape[axis];
+            }
+        }
+        if (m_channels.empty())
+        {
+            m_channels.resize(channels);
+        }
+        else if (m_channels.size() != channels)
+        {
+            throw ngraph_error("Calibrator: number of channels of " + m_key +
+                               " changed between batches");
+        }
+        size_t count = shape_size(shape);
+        if (count == 0)
+        {
+            return;
+        }
+
+        vector<float> batch_min(channels, numeric_limits<float>::infinity());
+        vector<float> batch_max(channels, -numeric_limits<float>::infinity());
+        for (size_t i = 0; i < count; i++)
+        {
+            size_t channel = (i / inner) % channels;
+            batch_min[channel] = std::min(batch_min[channel], data[i]);
+            batch_max[channel] = std::max(batch_max[channel], data[i]);
+        }
+        for (size_t channel = 0; channel < channels; channel++)
+        {
+            ChannelStatistics& statistics = m_channels[channel];
+            statistics.min = std::min(statistics.min, batch_min[channel]);
+            statistics.max = std::max(statistics.max, batch_max[channel]);
+        }
+
+        if (m_options.method == CalibrationMethod::MIN_MAX)
+        {
+            return;
+        }
+        for (size_t channel = 0; channel < channels; channel++)
+        {
+            ChannelStatistics& statistics = m_channels[channel];
+            statistics.histogram.resize(m_options.histogram_bins, 0);
+            grow_histogram(statistics,
+                           std::max(fabs(batch_min[channel]), fabs(batch_max[channel])));
+        }
+        size_t bins = m_options.histogram_bins;
+        for (size_t i = 0; i < count; i++)
+        {
+            ChannelStatistics& statistics = m_channels[(i / inner) % channels];
+            size_t bin = 0;
+            if (statistics.histogram_max > 0)
+            {
+                bin = std::min(
+                    bins - 1, static_cast<size_t>(fabs(data[i]) / statistics.histogram_max * bins));
+            }
+            statistics.histogram[bin] += 1;
+        }
+    }
+
+    TensorRange get_range() const
+    {
+        TensorRange range;
+        for (const ChannelStatistics& statistics : m_channels)
+        {
+            if (statistics.min > statistics.max)
+            {
+                // Nothing observed
+                range.min.push_back(0);
+                range.max.push_back(0);
+                continue;
+            }
+            float threshold = std::max(fabs(statistics.min), fabs(statistics.max));
+            switch (m_options.method)
+            {
+            case CalibrationMethod::MIN_MAX: break;
+            case CalibrationMethod::PERCENTILE:
+                threshold =
+                    std::min(threshold, percentile_threshold(statistics, m_options.percentile));
+                break;
+            case CalibrationMethod::KL_DIVERGENCE:
+                // Non-negative tensors are quantized to u8, others to i8
+                threshold =
+                    std::min(threshold, kl_threshold(statistics, statistics.min >= 0 ? 256 : 128));
+                break;
+            }
+            range.min.push_back(statistics.min < 0 ? std::max(statistics.min, -threshold)
+                                                   : statistics.min);
+            range.max.push_back(std::min(statistics.max, threshold));
+        }
+        return range;
+    }
+
+private:
+    string m_key;
+    CalibrationOptions m_options;
+    vector<ChannelStatistics> m_channels;
+};
+
+float runtime::TensorRange::get_min() const
+{
+    return min.empty() ? 0 : *min_element(min.begin(), min.end());
+}
+
+float runtime::TensorRange::get_max() const
+{
+    return max.empty() ? 0 : *max_element(max.begin(), max.end());
+}
+
+string runtime::calibration_key(const Output<Node>& output)
+{
+    return output.get_node()->get_name() + ":" + to_string(output.get_index());
+}
+
+runtime::Calibrator::Calibrator(const shared_ptr<Function>& function,
+                                const shared_ptr<Backend>& backend,
+                                const CalibrationOptions& options,
+                                const vector<Output<Node>>& observed)
+    : m_options(options)
+{
+    if (m_options.method != CalibrationMethod::MIN_MAX && m_options.histogram_bins == 0)
+    {
+        throw ngraph_error("Calibrator: histogram_bins must be positive");
+    }
+    if (m_options.percentile <= 0 || m_options.percentile > 100)
+    {
+        throw ngraph_error("Calibrator: percentile must be in (0, 100]");
+    }
+
+    vector<Output<Node>> observed_outputs = observed;
+    if (observed_outputs.empty())
+    {
+        for (auto& node : function->get_ordered_ops())
+        {
+            if (node->is_parameter() || node->is_constant() || node->is_output())
+            {
+                continue;
+            }
+            for (auto& output : node->outputs())
+            {
+                if (output.get_element_type() == element::f32)
+                {
+                    observed_outputs.push_back(output);
+                }
+            }
+        }
+    }
+
+    NodeMap node_map;
+    auto clone = clone_function(*function, node_map);
+    ResultVector results = clone->get_results();
+    m_observed_offset = results.size();
+    for (auto& output : observed_outputs)
+    {
+        if (output.get_element_type() != element::f32)
+        {
+            throw ngraph_error("Calibrator: " + calibration_key(output) + " is not f32");
+        }
+        Output<Node> cloned_output(node_map.at(output.get_node()), output.get_index());
+        results.push_back(make_shared<op::Result>(cloned_output));
+        m_statistics.emplace_back(new TensorStatistics(calibration_key(output), m_options));
+    }
+    auto observed_function = make_shared<Function>(results, clone->get_parameters());
+    m_executable = backend->compile(observed_function);
+
+    for (auto& result : observed_function->get_results())
+    {
+        const PartialShape& shape = result->get_output_partial_shape(0);
+        if (shape.is_static())
+        {
+            m_outputs.push_back(
+                backend->create_tensor(result->get_output_element_type(0), shape.to_shape()));
+        }
+        else
+        {
+            m_outputs.push_back(
+                backend->create_dynamic_tensor(result->get_output_element_type(0), shape));
+        }
+    }
+}
+
+runtime::Calibrator::~Calibrator()
+{
+}
+
+void runtime::Calibrator::run(const vector<shared_ptr<Tensor>>& inputs)
+{
+    m_executable->call_with_validate(m_outputs, inputs);
+    vector<float> values;
+    for (size_t i = 0; i < m_statistics.size(); i++)
+    {
+        auto& tensor = m_outputs[m_observed_offset + i];
+        Shape shape = tensor->get_shape();
+        values.resize(shape_size(shape));
+        tensor->read(values.data(), values.size() * sizeof(float));
+        m_statistics[i]->update(values.data(), shape);
+    }
+    m_batch_count++;
+}
+
+runtime::CalibrationTable runtime::Calibrator::get_table() const
+{
+    CalibrationTable table;
+    for (auto& statistics : m_statistics)
+    {
+        table[statistics->get_key()] = statistics->get_range();
+    }
+    return table;
+}
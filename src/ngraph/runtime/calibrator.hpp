@@ -0,0 +1,118 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/ngraph_visibility.hpp"
+#include "ngraph/node.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class Backend;
+        class Executable;
+        class Tensor;
+
+        /// \brief How the Calibrator turns observed activations into quantization ranges.
+        enum class CalibrationMethod
+        {
+            /// Smallest and largest value seen over all batches
+            MIN_MAX,
+            /// Clip |x| at a percentile of its distribution
+            PERCENTILE,
+            /// Clip |x| at the threshold minimizing the KL divergence between the observed
+            /// distribution and its quantized approximation
+            KL_DIVERGENCE
+        };
+
+        struct CalibrationOptions
+        {
+            CalibrationMethod method = CalibrationMethod::MIN_MAX;
+            /// Percentile of |x| kept by CalibrationMethod::PERCENTILE, in (0, 100]
+            double percentile = 99.99;
+            /// Number of histogram bins used by PERCENTILE and KL_DIVERGENCE
+            size_t histogram_bins = 2048;
+            /// Record one range per channel instead of one per tensor
+            bool per_channel = false;
+            /// Channel axis used when per_channel is set. Tensors of lower rank get a single
+            /// range.
+            size_t channel_axis = 1;
+        };
+
+        /// \brief Quantization range of one tensor. min and max hold a single entry for
+        ///        per-tensor ranges and one entry per channel otherwise.
+        struct TensorRange
+        {
+            std::vector<float> min;
+            std::vector<float> max;
+
+            bool is_per_channel() const { return min.size() > 1; }
+            /// \brief Smallest min over all channels
+            float get_min() const;
+            /// \brief Largest max over all channels
+            float get_max() const;
+        };
+
+        /// \brief Ranges keyed by calibration_key of the calibrated Function's node outputs.
+        ///        Keys use node names, so a table does not apply to clones of that Function.
+        using CalibrationTable = std::map<std::string, TensorRange>;
+
+        /// \brief Key of a node output in a CalibrationTable
+        NGRAPH_API std::string calibration_key(const Output<Node>& output);
+
+        /// \brief Records activation ranges of a floating point Function over sample batches.
+        ///
+        /// The Function is cloned, every observed output is added to the clone as an extra
+        /// Result and the clone is compiled on the given backend, so the original Function is
+        /// left untouched. By default every f32 output of every node other than Parameter,
+        /// Constant and Result is observed.
+        class NGRAPH_API Calibrator
+        {
+        public:
+            Calibrator(const std::shared_ptr<Function>& function,
+                       const std::shared_ptr<Backend>& backend,
+                       const CalibrationOptions& options = CalibrationOptions(),
+                       const std::vector<Output<Node>>& observed = {});
+            ~Calibrator();
+
+            /// \brief Runs one batch and folds its activations into the statistics
+            /// \param inputs One tensor per parameter of the calibrated Function
+            void run(const std::vector<std::shared_ptr<Tensor>>& inputs);
+
+            /// \brief Number of batches run so far
+            size_t get_batch_count() const { return m_batch_count; }
+            /// \brief Ranges of all observed outputs computed with the configured method
+            CalibrationTable get_table() const;
+
+        private:
+            class TensorStatistics;
+
+            CalibrationOptions m_options;
+            std::shared_ptr<Executable> m_executable;
+            std::vector<std::shared_ptr<Tensor>> m_outputs;
+            size_t m_observed_offset;
+            std::vector<std::unique_ptr<TensorStatistics>> m_statistics;
+            size_t m_batch_count = 0;
+        };
+    }
+}
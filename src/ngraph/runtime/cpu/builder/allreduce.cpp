@@ -17,6 +17,7 @@
 #include "ngraph/op/allreduce.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -55,6 +56,31 @@ namespace ngraph
                         : node->get_friendly_name().c_str(),
                     count);
 
+                if (external_function->is_async_communication_enabled())
+                {
+                    // Only start the reduction here. The DEX loop waits for it right before the
+                    // first op that depends on it, so it overlaps the ops in between.
+                    auto slot = external_function->add_async_communication_op(node);
+                    auto queue = &external_function->get_communication_queue();
+                    auto functor = [count,
+                                    reduce_type,
+                                    data_type,
+                                    arg_buffer_index,
+                                    out_buffer_index,
+                                    slot,
+                                    queue](CPURuntimeContext* ctx,
+                                           CPUExecutionContext* /* ectx */) {
+                        void* arg = ctx->buffer_data[arg_buffer_index];
+                        void* out = ctx->buffer_data[out_buffer_index];
+                        ctx->pending_communication[slot] = queue->schedule([=]() {
+                            get_distributed_interface()->all_reduce(
+                                arg, out, data_type, reduce_type, count);
+                        });
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 auto functor =
                     [&, count, reduce_type, data_type, arg_buffer_index, out_buffer_index](
                         CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
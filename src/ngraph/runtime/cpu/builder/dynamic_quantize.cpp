@@ -0,0 +1,96 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/dynamic_quantize.hpp"
+#include "ngraph/runtime/cpu/op/dynamic_quantize.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::DynamicQuantize)
+            {
+                (void)node;
+                auto& functors = external_function->get_functors();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto scale_buffer_index = external_function->get_buffer_index(out[1].get_name());
+                auto count = shape_size(args[0].get_shape());
+
+                auto functor = [&, count, arg_buffer_index, out_buffer_index, scale_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                    kernel::dynamic_quantize(
+                        static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
+                        static_cast<uint8_t*>(ctx->buffer_data[out_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[scale_buffer_index]),
+                        count);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::DynamicDequantize)
+            {
+                (void)node;
+                auto& functors = external_function->get_functors();
+
+                auto acc_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto scale_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto compensation_buffer_index =
+                    external_function->get_buffer_index(args[2].get_name());
+                auto weight_scales_buffer_index =
+                    external_function->get_buffer_index(args[3].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto rows = args[0].get_shape()[0];
+                auto cols = args[0].get_shape()[1];
+
+                auto functor = [&,
+                                rows,
+                                cols,
+                                acc_buffer_index,
+                                scale_buffer_index,
+                                compensation_buffer_index,
+                                weight_scales_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* /* ectx */) {
+                    kernel::dynamic_dequantize(
+                        static_cast<int32_t*>(ctx->buffer_data[acc_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[scale_buffer_index]),
+                        static_cast<int32_t*>(ctx->buffer_data[compensation_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[weight_scales_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                        rows,
+                        cols);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_dynamic_quantize_cpp()
+            {
+                REGISTER_OP_BUILDER(DynamicQuantize);
+                REGISTER_OP_BUILDER(DynamicDequantize);
+            }
+        }
+    }
+}
@@ -0,0 +1,240 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <limits>
+
+#include "ngraph/op/embedding_bag.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/embedding_bag.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace
+            {
+                template <typename T, typename U>
+                CPUKernelFunctor make_embedding_bag_functor(size_t weights_index,
+                                                            size_t indices_index,
+                                                            size_t offsets_index,
+                                                            size_t per_sample_weights_index,
+                                                            size_t out_index,
+                                                            size_t num_embeddings,
+                                                            size_t embedding_dim,
+                                                            size_t indices_count,
+                                                            size_t bags,
+                                                            op::EmbeddingBag::Reduction reduction)
+                {
+                    return [=](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                        const T* per_sample_weights =
+                            per_sample_weights_index == numeric_limits<size_t>::max()
+                                ? nullptr
+                                : static_cast<T*>(ctx->buffer_data[per_sample_weights_index]);
+                        kernel::embedding_bag<T, U>(
+                            static_cast<T*>(ctx->buffer_data[weights_index]),
+                            static_cast<U*>(ctx->buffer_data[indices_index]),
+                            static_cast<U*>(ctx->buffer_data[offsets_index]),
+                            per_sample_weights,
+                            static_cast<T*>(ctx->buffer_data[out_index]),
+                            num_embeddings,
+                            embedding_dim,
+                            indices_count,
+                            bags,
+                            reduction);
+                    };
+                }
+
+                template <typename T, typename U>
+                CPUKernelFunctor
+                    make_embedding_bag_backprop_functor(size_t weights_index,
+                                                        size_t indices_index,
+                                                        size_t offsets_index,
+                                                        size_t delta_index,
+                                                        size_t per_sample_weights_index,
+                                                        size_t d_rows_index,
+                                                        size_t d_per_sample_weights_index,
+                                                        size_t num_embeddings,
+                                                        size_t embedding_dim,
+                                                        size_t indices_count,
+                                                        size_t bags,
+                                                        op::EmbeddingBag::Reduction reduction)
+                {
+                    return [=](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                        const T* per_sample_weights = nullptr;
+                        T* d_per_sample_weights = nullptr;
+                        if (per_sample_weights_index != numeric_limits<size_t>::max())
+                        {
+                            per_sample_weights =
+                                static_cast<T*>(ctx->buffer_data[per_sample_weights_index]);
+                            d_per_sample_weights =
+                                static_cast<T*>(ctx->buffer_data[d_per_sample_weights_index]);
+                        }
+                        kernel::embedding_bag_backprop<T, U>(
+                            static_cast<T*>(ctx->buffer_data[weights_index]),
+                            static_cast<U*>(ctx->buffer_data[indices_index]),
+                            static_cast<U*>(ctx->buffer_data[offsets_index]),
+                            static_cast<T*>(ctx->buffer_data[delta_index]),
+                            per_sample_weights,
+                            static_cast<T*>(ctx->buffer_data[d_rows_index]),
+                            d_per_sample_weights,
+                            num_embeddings,
+                            embedding_dim,
+                            indices_count,
+                            bags,
+                            reduction);
+                    };
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::EmbeddingBag)
+            {
+                auto bag = static_cast<const ngraph::op::EmbeddingBag*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto weights_index = external_function->get_buffer_index(args[0].get_name());
+                auto indices_index = external_function->get_buffer_index(args[1].get_name());
+                auto offsets_index = external_function->get_buffer_index(args[2].get_name());
+                auto per_sample_weights_index =
+                    bag->has_per_sample_weights()
+                        ? external_function->get_buffer_index(args[3].get_name())
+                        : numeric_limits<size_t>::max();
+                auto out_index = external_function->get_buffer_index(out[0].get_name());
+
+                size_t num_embeddings = args[0].get_shape().at(0);
+                size_t embedding_dim = args[0].get_shape().at(1);
+                size_t indices_count = shape_size(args[1].get_shape());
+                size_t bags = shape_size(args[2].get_shape());
+                auto reduction = bag->get_reduction();
+
+                auto element_type = args[0].get_element_type();
+                auto index_type = args[1].get_element_type();
+                CPUKernelFunctor functor;
+#define EMBEDDING_BAG_FUNCTOR(T, U)                                                                \
+    make_embedding_bag_functor<T, U>(weights_index,                                                \
+                                     indices_index,                                                \
+                                     offsets_index,                                                \
+                                     per_sample_weights_index,                                     \
+                                     out_index,                                                    \
+                                     num_embeddings,                                               \
+                                     embedding_dim,                                                \
+                                     indices_count,                                                \
+                                     bags,                                                         \
+                                     reduction)
+                if (element_type == element::f32 && index_type == element::i32)
+                {
+                    functor = EMBEDDING_BAG_FUNCTOR(float, int32_t);
+                }
+                else if (element_type == element::f32 && index_type == element::i64)
+                {
+                    functor = EMBEDDING_BAG_FUNCTOR(float, int64_t);
+                }
+                else if (element_type == element::f64 && index_type == element::i32)
+                {
+                    functor = EMBEDDING_BAG_FUNCTOR(double, int32_t);
+                }
+                else if (element_type == element::f64 && index_type == element::i64)
+                {
+                    functor = EMBEDDING_BAG_FUNCTOR(double, int64_t);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type in CPU Builder for EmbeddingBag");
+                }
+#undef EMBEDDING_BAG_FUNCTOR
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::EmbeddingBagBackprop)
+            {
+                auto bprop = static_cast<const ngraph::op::EmbeddingBagBackprop*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto weights_index = external_function->get_buffer_index(args[0].get_name());
+                auto indices_index = external_function->get_buffer_index(args[1].get_name());
+                auto offsets_index = external_function->get_buffer_index(args[2].get_name());
+                auto delta_index = external_function->get_buffer_index(args[3].get_name());
+                auto per_sample_weights_index = numeric_limits<size_t>::max();
+                auto d_per_sample_weights_index = numeric_limits<size_t>::max();
+                if (bprop->has_per_sample_weights())
+                {
+                    per_sample_weights_index =
+                        external_function->get_buffer_index(args[4].get_name());
+                    d_per_sample_weights_index =
+                        external_function->get_buffer_index(out[1].get_name());
+                }
+                auto d_rows_index = external_function->get_buffer_index(out[0].get_name());
+
+                size_t num_embeddings = args[0].get_shape().at(0);
+                size_t embedding_dim = args[0].get_shape().at(1);
+                size_t indices_count = shape_size(args[1].get_shape());
+                size_t bags = shape_size(args[2].get_shape());
+                auto reduction = bprop->get_reduction();
+
+                auto element_type = args[0].get_element_type();
+                auto index_type = args[1].get_element_type();
+                CPUKernelFunctor functor;
+#define EMBEDDING_BAG_BACKPROP_FUNCTOR(T, U)                                                       \
+    make_embedding_bag_backprop_functor<T, U>(weights_index,                                       \
+                                              indices_index,                                       \
+                                              offsets_index,                                       \
+                                              delta_index,                                         \
+                                              per_sample_weights_index,                            \
+                                              d_rows_index,                                        \
+                                              d_per_sample_weights_index,                          \
+                                              num_embeddings,                                      \
+                                              embedding_dim,                                       \
+                                              indices_count,                                       \
+                                              bags,                                                \
+                                              reduction)
+                if (element_type == element::f32 && index_type == element::i32)
+                {
+                    functor = EMBEDDING_BAG_BACKPROP_FUNCTOR(float, int32_t);
+                }
+                else if (element_type == element::f32 && index_type == element::i64)
+                {
+                    functor = EMBEDDING_BAG_BACKPROP_FUNCTOR(float, int64_t);
+                }
+                else if (element_type == element::f64 && index_type == element::i32)
+                {
+                    functor = EMBEDDING_BAG_BACKPROP_FUNCTOR(double, int32_t);
+                }
+                else if (element_type == element::f64 && index_type == element::i64)
+                {
+                    functor = EMBEDDING_BAG_BACKPROP_FUNCTOR(double, int64_t);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type in CPU Builder for EmbeddingBagBackprop");
+                }
+#undef EMBEDDING_BAG_BACKPROP_FUNCTOR
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_embedding_bag_cpp()
+            {
+                REGISTER_OP_BUILDER(EmbeddingBag);
+                REGISTER_OP_BUILDER(EmbeddingBagBackprop);
+            }
+        }
+    }
+}
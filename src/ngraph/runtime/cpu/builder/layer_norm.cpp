@@ -0,0 +1,247 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <limits>
+#include <tuple>
+
+#include "ngraph/op/fused/layer_norm.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/layer_norm.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace
+            {
+                // Rows are the axes before begin_norm_axis, columns the normalized axes
+                pair<size_t, size_t> get_layer_norm_rows_cols(const Shape& shape,
+                                                              int64_t begin_norm_axis)
+                {
+                    size_t n_axis = static_cast<size_t>(
+                        begin_norm_axis >= 0 ? begin_norm_axis : shape.size() + begin_norm_axis);
+                    size_t rows = shape_size(Shape(shape.begin(), shape.begin() + n_axis));
+                    size_t cols = shape_size(Shape(shape.begin() + n_axis, shape.end()));
+                    return make_pair(rows, cols);
+                }
+
+                template <typename T>
+                T* get_optional_buffer(CPURuntimeContext* ctx, size_t index)
+                {
+                    return index == numeric_limits<size_t>::max()
+                               ? nullptr
+                               : static_cast<T*>(ctx->buffer_data[index]);
+                }
+
+                template <typename T>
+                CPUKernelFunctor make_layer_norm_functor(size_t data_index,
+                                                         size_t scale_index,
+                                                         size_t bias_index,
+                                                         size_t out_index,
+                                                         size_t mean_index,
+                                                         size_t variance_index,
+                                                         size_t rows,
+                                                         size_t cols,
+                                                         double epsilon)
+                {
+                    return [=](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                        kernel::layer_norm<T>(static_cast<T*>(ctx->buffer_data[data_index]),
+                                              get_optional_buffer<T>(ctx, scale_index),
+                                              get_optional_buffer<T>(ctx, bias_index),
+                                              static_cast<T*>(ctx->buffer_data[out_index]),
+                                              get_optional_buffer<T>(ctx, mean_index),
+                                              get_optional_buffer<T>(ctx, variance_index),
+                                              rows,
+                                              cols,
+                                              epsilon);
+                    };
+                }
+
+                template <typename T>
+                CPUKernelFunctor make_layer_norm_backprop_functor(size_t data_index,
+                                                                  size_t delta_index,
+                                                                  size_t mean_index,
+                                                                  size_t variance_index,
+                                                                  size_t scale_index,
+                                                                  size_t d_data_index,
+                                                                  size_t d_scale_index,
+                                                                  size_t d_bias_index,
+                                                                  size_t rows,
+                                                                  size_t cols,
+                                                                  double epsilon)
+                {
+                    return [=](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                        kernel::layer_norm_backprop<T>(
+                            static_cast<T*>(ctx->buffer_data[data_index]),
+                            static_cast<T*>(ctx->buffer_data[delta_index]),
+                            get_optional_buffer<T>(ctx, mean_index),
+                            get_optional_buffer<T>(ctx, variance_index),
+                            get_optional_buffer<T>(ctx, scale_index),
+                            static_cast<T*>(ctx->buffer_data[d_data_index]),
+                            get_optional_buffer<T>(ctx, d_scale_index),
+                            get_optional_buffer<T>(ctx, d_bias_index),
+                            rows,
+                            cols,
+                            epsilon);
+                    };
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::LayerNorm)
+            {
+                auto layer_norm = static_cast<const ngraph::op::LayerNorm*>(node);
+                auto& functors = external_function->get_functors();
+
+                const size_t none = numeric_limits<size_t>::max();
+                auto data_index = external_function->get_buffer_index(args[0].get_name());
+                auto scale_index = none;
+                auto bias_index = none;
+                if (layer_norm->get_use_affine())
+                {
+                    scale_index = external_function->get_buffer_index(args[1].get_name());
+                    bias_index = external_function->get_buffer_index(args[2].get_name());
+                }
+                auto out_index = external_function->get_buffer_index(out[0].get_name());
+                auto mean_index = none;
+                auto variance_index = none;
+                if (layer_norm->get_keep_stats())
+                {
+                    mean_index = external_function->get_buffer_index(out[1].get_name());
+                    variance_index = external_function->get_buffer_index(out[2].get_name());
+                }
+
+                size_t rows, cols;
+                tie(rows, cols) = get_layer_norm_rows_cols(args[0].get_shape(),
+                                                           layer_norm->get_begin_norm_axis());
+                double epsilon = layer_norm->get_epsilon();
+
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    functors.emplace_back(
+                        make_layer_norm_functor<float>(data_index,
+                                                       scale_index,
+                                                       bias_index,
+                                                       out_index,
+                                                       mean_index,
+                                                       variance_index,
+                                                       rows,
+                                                       cols,
+                                                       epsilon));
+                }
+                else if (element_type == element::f64)
+                {
+                    functors.emplace_back(
+                        make_layer_norm_functor<double>(data_index,
+                                                        scale_index,
+                                                        bias_index,
+                                                        out_index,
+                                                        mean_index,
+                                                        variance_index,
+                                                        rows,
+                                                        cols,
+                                                        epsilon));
+                }
+                else
+                {
+                    throw ngraph_error("LayerNorm is supported only for f32 and f64.");
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::LayerNormBackprop)
+            {
+                auto layer_norm = static_cast<const ngraph::op::LayerNormBackprop*>(node);
+                auto& functors = external_function->get_functors();
+
+                const size_t none = numeric_limits<size_t>::max();
+                auto data_index = external_function->get_buffer_index(args[0].get_name());
+                auto delta_index = external_function->get_buffer_index(args[1].get_name());
+                auto mean_index = none;
+                auto variance_index = none;
+                auto scale_index = none;
+                size_t arg = 2;
+                if (layer_norm->get_use_stats())
+                {
+                    mean_index = external_function->get_buffer_index(args[arg++].get_name());
+                    variance_index = external_function->get_buffer_index(args[arg++].get_name());
+                }
+                auto d_data_index = external_function->get_buffer_index(out[0].get_name());
+                auto d_scale_index = none;
+                auto d_bias_index = none;
+                if (layer_norm->get_use_affine())
+                {
+                    scale_index = external_function->get_buffer_index(args[arg].get_name());
+                    d_scale_index = external_function->get_buffer_index(out[1].get_name());
+                    d_bias_index = external_function->get_buffer_index(out[2].get_name());
+                }
+
+                size_t rows, cols;
+                tie(rows, cols) = get_layer_norm_rows_cols(args[0].get_shape(),
+                                                           layer_norm->get_begin_norm_axis());
+                double epsilon = layer_norm->get_epsilon();
+
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    functors.emplace_back(
+                        make_layer_norm_backprop_functor<float>(data_index,
+                                                                delta_index,
+                                                                mean_index,
+                                                                variance_index,
+                                                                scale_index,
+                                                                d_data_index,
+                                                                d_scale_index,
+                                                                d_bias_index,
+                                                                rows,
+                                                                cols,
+                                                                epsilon));
+                }
+                else if (element_type == element::f64)
+                {
+                    functors.emplace_back(
+                        make_layer_norm_backprop_functor<double>(data_index,
+                                                                 delta_index,
+                                                                 mean_index,
+                                                                 variance_index,
+                                                                 scale_index,
+                                                                 d_data_index,
+                                                                 d_scale_index,
+                                                                 d_bias_index,
+                                                                 rows,
+                                                                 cols,
+                                                                 epsilon));
+                }
+                else
+                {
+                    throw ngraph_error("LayerNormBackprop is supported only for f32 and f64.");
+                }
+            }
+
+            void register_builders_layer_norm_cpp()
+            {
+                REGISTER_OP_BUILDER(LayerNorm);
+                REGISTER_OP_BUILDER(LayerNormBackprop);
+            }
+        }
+    }
+}
@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "ngraph/op/fused/mvn.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/mvn.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::MVN)
+            {
+                auto mvn = static_cast<const ngraph::op::MVN*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                // The group offsets depend only on the shape, so they are computed once here
+                // and shared by every call
+                auto groups = make_shared<kernel::ReductionGroups>(args[0].get_shape(),
+                                                                   mvn->get_reduction_axes());
+                bool normalize_variance = mvn->get_normalize_variance();
+                double eps = mvn->get_eps();
+
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    auto functor = [&,
+                                    groups,
+                                    normalize_variance,
+                                    eps,
+                                    arg_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* /* ectx */) {
+                        kernel::mvn<float>(static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
+                                           static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                                           *groups,
+                                           normalize_variance,
+                                           eps);
+                    };
+                    functors.emplace_back(functor);
+                }
+                else if (element_type == element::f64)
+                {
+                    auto functor = [&,
+                                    groups,
+                                    normalize_variance,
+                                    eps,
+                                    arg_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* /* ectx */) {
+                        kernel::mvn<double>(
+                            static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
+                            static_cast<double*>(ctx->buffer_data[out_buffer_index]),
+                            *groups,
+                            normalize_variance,
+                            eps);
+                    };
+                    functors.emplace_back(functor);
+                }
+                else
+                {
+                    throw ngraph_error("MVN is supported only for f32 and f64.");
+                }
+            }
+
+            void register_builders_mvn_cpp() { REGISTER_OP_BUILDER(MVN); }
+        }
+    }
+}
@@ -0,0 +1,121 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/sparse_matmul.hpp"
+#include "ngraph/runtime/cpu/op/sparse_matmul.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::SparseDot)
+            {
+                auto& functors = external_function->get_functors();
+                auto sparse_dot = static_cast<const ngraph::op::SparseDot*>(node);
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto values_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto indices_buffer_index =
+                    external_function->get_buffer_index(args[2].get_name());
+                auto offsets_buffer_index =
+                    external_function->get_buffer_index(args[3].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto k = args[3].get_shape()[0] - 1;
+                auto rows = k > 0 ? shape_size(args[0].get_shape()) / k : 0;
+                auto n = sparse_dot->get_columns();
+
+                auto functor = [&,
+                                rows,
+                                k,
+                                n,
+                                arg_buffer_index,
+                                values_buffer_index,
+                                indices_buffer_index,
+                                offsets_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* /* ectx */) {
+                    kernel::dense_sparse_matmul(
+                        static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[values_buffer_index]),
+                        static_cast<int32_t*>(ctx->buffer_data[indices_buffer_index]),
+                        static_cast<int32_t*>(ctx->buffer_data[offsets_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                        rows,
+                        k,
+                        n);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::SparseConvolution)
+            {
+                (void)node;
+                auto& functors = external_function->get_functors();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto values_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto indices_buffer_index =
+                    external_function->get_buffer_index(args[2].get_name());
+                auto offsets_buffer_index =
+                    external_function->get_buffer_index(args[3].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                const Shape& data_shape = args[0].get_shape();
+                auto batch = data_shape[0];
+                auto input_channels = data_shape[1];
+                auto output_channels = args[3].get_shape()[0] - 1;
+                auto spatial = shape_size(data_shape) / std::max<size_t>(batch * input_channels, 1);
+
+                auto functor = [&,
+                                batch,
+                                input_channels,
+                                output_channels,
+                                spatial,
+                                arg_buffer_index,
+                                values_buffer_index,
+                                indices_buffer_index,
+                                offsets_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* /* ectx */) {
+                    kernel::sparse_dense_matmul(
+                        static_cast<float*>(ctx->buffer_data[values_buffer_index]),
+                        static_cast<int32_t*>(ctx->buffer_data[indices_buffer_index]),
+                        static_cast<int32_t*>(ctx->buffer_data[offsets_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                        batch,
+                        output_channels,
+                        input_channels,
+                        spatial);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_sparse_matmul_cpp()
+            {
+                REGISTER_OP_BUILDER(SparseDot);
+                REGISTER_OP_BUILDER(SparseConvolution);
+            }
+        }
+    }
+}
@@ -18,7 +18,7 @@
 
 #include "ngraph/op/topk.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/topk.hpp"
+#include "ngraph/runtime/cpu/kernel/topk.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -49,7 +49,6 @@ namespace ngraph
                 bool is_int64 = out[0].get_element_type() == element::i64;
                 auto axis = topk->get_top_k_axis();
                 auto in_shape = args[0].get_shape();
-                auto out_shape = out[0].get_shape();
                 auto k = topk->get_k();
                 auto compute_max = topk->get_compute_max();
                 auto sort = topk->get_sort();
@@ -61,7 +60,6 @@ namespace ngraph
                     {
                         functor = [&,
                                    in_shape,
-                                   out_shape,
                                    axis,
                                    k,
                                    compute_max,
@@ -70,12 +68,11 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<float, int64_t>(
+                            kernel::topk<float, int64_t>(
                                 static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
-                                out_shape,
                                 axis,
                                 k,
                                 compute_max,
@@ -86,7 +83,6 @@ namespace ngraph
                     {
                         functor = [&,
                                    in_shape,
-                                   out_shape,
                                    axis,
                                    k,
                                    compute_max,
@@ -95,12 +91,11 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<float, int32_t>(
+                            kernel::topk<float, int32_t>(
                                 static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
-                                out_shape,
                                 axis,
                                 k,
                                 compute_max,
@@ -114,7 +109,6 @@ namespace ngraph
                     {
                         functor = [&,
                                    in_shape,
-                                   out_shape,
                                    axis,
                                    k,
                                    compute_max,
@@ -123,12 +117,11 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<double, int64_t>(
+                            kernel::topk<double, int64_t>(
                                 static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
-                                out_shape,
                                 axis,
                                 k,
                                 compute_max,
@@ -139,7 +132,6 @@ namespace ngraph
                     {
                         functor = [&,
                                    in_shape,
-                                   out_shape,
                                    axis,
                                    k,
                                    compute_max,
@@ -148,12 +140,11 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<double, int32_t>(
+                            kernel::topk<double, int32_t>(
                                 static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
-                                out_shape,
                                 axis,
                                 k,
                                 compute_max,
@@ -167,7 +158,6 @@ namespace ngraph
                     {
                         functor = [&,
                                    in_shape,
-                                   out_shape,
                                    axis,
                                    k,
                                    compute_max,
@@ -176,12 +166,11 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<int32_t, int64_t>(
+                            kernel::topk<int32_t, int64_t>(
                                 static_cast<int32_t*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
-                                out_shape,
                                 axis,
                                 k,
                                 compute_max,
@@ -192,7 +181,6 @@ namespace ngraph
                     {
                         functor = [&,
                                    in_shape,
-                                   out_shape,
                                    axis,
                                    k,
                                    compute_max,
@@ -201,12 +189,11 @@ namespace ngraph
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<int32_t, int32_t>(
+                            kernel::topk<int32_t, int32_t>(
                                 static_cast<int32_t*>(ctx->buffer_data[arg_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
                                 static_cast<int32_t*>(ctx->buffer_data[out_values_buffer_index]),
                                 in_shape,
-                                out_shape,
                                 axis,
                                 k,
                                 compute_max,
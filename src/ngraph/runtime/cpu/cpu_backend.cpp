@@ -73,7 +73,7 @@ shared_ptr<runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Backend::make_call_fra
 shared_ptr<runtime::Tensor>
     runtime::cpu::CPU_Backend::create_tensor(const element::Type& element_type, const Shape& shape)
 {
-    return make_shared<runtime::cpu::CPUTensorView>(element_type, shape);
+    return make_shared<runtime::cpu::CPUTensorView>(element_type, shape, nullptr, m_allocator);
 }
 
 shared_ptr<runtime::Tensor> runtime::cpu::CPU_Backend::create_tensor(
@@ -138,6 +138,15 @@ runtime::cpu::CPU_Executable::CPU_Executable(shared_ptr<Function> func,
         instance.m_external_function->m_emit_timing = performance_counters_enabled;
         auto cf = instance.m_external_function->make_call_frame(pass_config, allocator);
         instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
+
+        // DEX has one functor per op, timed in the order of the performance counters
+        vector<shared_ptr<const Node>> ops;
+        for (auto& counter : instance.m_external_function->m_perf_counters)
+        {
+            ops.push_back(counter.get_node());
+        }
+        m_latency_profiler.set_ops(ops);
+        instance.m_external_function->m_latency_profiler = &m_latency_profiler;
     }
     set_parameters_and_results(*func);
 }
@@ -160,8 +169,15 @@ bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>
         throw runtime_error("compile() must be called before call().");
     }
 
+    bool profile_latency = m_latency_profiler.is_enabled();
+    uint64_t call_start = profile_latency ? CycleClock::now() : 0;
+
     instance.m_call_frame->call(outputs, inputs);
 
+    if (profile_latency)
+    {
+        m_latency_profiler.record_call(CycleClock::now() - call_start);
+    }
     return rc;
 }
 
@@ -39,12 +39,15 @@ namespace ngraph
                 register_builders_cumsum_cpp();
                 register_builders_dot_cpp();
                 register_builders_dropout_cpp();
+                register_builders_dynamic_quantize_cpp();
+                register_builders_embedding_bag_cpp();
                 register_builders_embedding_lookup_cpp();
                 register_builders_erf_cpp();
                 register_builders_gather_cpp();
                 register_builders_gather_nd_cpp();
                 register_builders_gelu_cpp();
                 register_builders_get_output_element_cpp();
+                register_builders_layer_norm_cpp();
                 register_builders_leaky_relu_cpp();
                 register_builders_lrn_cpp();
                 register_builders_lstm_cpp();
@@ -52,6 +55,8 @@ namespace ngraph
                 register_builders_max_cpp();
                 register_builders_max_pool_cpp();
                 register_builders_min_cpp();
+                register_builders_mvn_cpp();
+                register_builders_normalize_l2_cpp();
                 register_builders_one_hot_cpp();
                 register_builders_pad_cpp();
                 register_builders_product_cpp();
@@ -74,6 +79,7 @@ namespace ngraph
                 register_builders_sigmoid_cpp();
                 register_builders_slice_cpp();
                 register_builders_softmax_cpp();
+                register_builders_sparse_matmul_cpp();
                 register_builders_sum_cpp();
                 register_builders_tile_cpp();
                 register_builders_topk_cpp();
@@ -38,12 +38,15 @@ namespace ngraph
             void register_builders_cumsum_cpp();
             void register_builders_dot_cpp();
             void register_builders_dropout_cpp();
+            void register_builders_dynamic_quantize_cpp();
+            void register_builders_embedding_bag_cpp();
             void register_builders_embedding_lookup_cpp();
             void register_builders_erf_cpp();
             void register_builders_gather_cpp();
             void register_builders_gather_nd_cpp();
             void register_builders_gelu_cpp();
             void register_builders_get_output_element_cpp();
+            void register_builders_layer_norm_cpp();
             void register_builders_leaky_relu_cpp();
             void register_builders_lrn_cpp();
             void register_builders_lstm_cpp();
@@ -51,6 +54,8 @@ namespace ngraph
             void register_builders_max_cpp();
             void register_builders_max_pool_cpp();
             void register_builders_min_cpp();
+            void register_builders_mvn_cpp();
+            void register_builders_normalize_l2_cpp();
             void register_builders_one_hot_cpp();
             void register_builders_pad_cpp();
             void register_builders_product_cpp();
@@ -73,6 +78,7 @@ namespace ngraph
             void register_builders_sigmoid_cpp();
             void register_builders_slice_cpp();
             void register_builders_softmax_cpp();
+            void register_builders_sparse_matmul_cpp();
             void register_builders_sum_cpp();
             void register_builders_tile_cpp();
             void register_builders_topk_cpp();
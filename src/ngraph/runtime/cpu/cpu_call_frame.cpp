@@ -15,11 +15,14 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cstring>
+#include <memory>
 #include <thread>
 
 #include "ngraph/env_util.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
@@ -49,6 +52,13 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
             std::to_string(std::thread::hardware_concurrency()) + "]");
     }
 
+    // With NUMA mode enabled every node gets at least one context of its own
+    const auto& numa_nodes = executor::GetCPUExecutor().get_numa_nodes();
+    if (m_external_function->is_direct_execution() && m_num_ctx < numa_nodes.size())
+    {
+        m_num_ctx = numa_nodes.size();
+    }
+
     setup_runtime_context(allocator);
     if (!m_external_function->is_direct_execution())
     {
@@ -129,14 +139,25 @@ void runtime::cpu::CPU_CallFrame::call(
             m_cv.wait(lck);
         }
 
+        // Prefer a context bound to the caller's NUMA node, so the caller's data and the
+        // context's memory and workers stay on one socket
+        id = m_num_ctx;
+        int numa_node = m_numa_allocators.empty() ? -1 : executor::get_current_numa_node();
         for (size_t i = 0; i < m_num_ctx; i++)
         {
-            if (m_id_pool[i])
+            if (m_id_pool[i] && m_ctx_vec[i]->numa_node == numa_node)
             {
                 id = i;
                 break;
             }
         }
+        for (size_t i = 0; i < m_num_ctx && id == m_num_ctx; i++)
+        {
+            if (m_id_pool[i])
+            {
+                id = i;
+            }
+        }
         NGRAPH_CHECK(id != m_num_ctx);
         m_id_pool[id] = false;
         if (id != m_prev_ctx)
@@ -151,7 +172,19 @@ void runtime::cpu::CPU_CallFrame::call(
 
     m_ctx_vec[id]->pc = 0;
     propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
-    inner_call(output_tvs, input_tvs, id, disable_caching);
+    {
+        // Kernels run on the calling thread and the OpenMP team it starts, so both are moved
+        // to the context's node for the duration of the call
+        std::unique_ptr<executor::AffinityScope> numa_scope;
+        if (m_ctx_vec[id]->numa_node >= 0)
+        {
+            auto& cpu_executor = executor::GetCPUExecutor();
+            numa_scope.reset(
+                new executor::AffinityScope(cpu_executor.get_arena_cpus(m_ctx_vec[id]->arena),
+                                            cpu_executor.get_num_openmp_threads()));
+        }
+        inner_call(output_tvs, input_tvs, id, disable_caching);
+    }
 
     m_mutex.lock();
     m_id_pool[id] = true;
@@ -180,8 +213,13 @@ void runtime::cpu::CPU_CallFrame::propagate_layouts(
     }
 }
 
-void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
+void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* default_allocator)
 {
+    auto& cpu_executor = executor::GetCPUExecutor();
+    const auto& numa_nodes = cpu_executor.get_numa_nodes();
+    bool numa_aware = m_external_function->is_direct_execution() && !numa_nodes.empty();
+    size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
+
     for (size_t i = 0; i < m_num_ctx; i++)
     {
         m_id_pool[i] = true;
@@ -189,6 +227,38 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
         m_ctx_vec.push_back(ctx);
 
         ctx->pc = 0;
+        ctx->numa_node = -1;
+        ctx->arena = 0;
+        ctx->pending_communication.resize(m_external_function->get_num_async_communication_ops());
+        Allocator* allocator = default_allocator;
+        if (numa_aware)
+        {
+            // Contexts are spread round-robin over the nodes. Intermediates, the scratchpad
+            // and the weights of a context all live on its node, and its kernels run on the
+            // thread pool pinned to that node.
+            int numa_node = numa_nodes[i % numa_nodes.size()];
+            ctx->numa_node = numa_node;
+            ctx->arena = cpu_executor.get_numa_arena(numa_node);
+
+            auto& numa_allocator = m_numa_allocators[numa_node];
+            if (!numa_allocator)
+            {
+                numa_allocator.reset(new NumaAllocator(numa_node));
+                auto& constant_buffers = m_numa_constant_buffers[numa_node];
+                for (auto& p : m_external_function->get_constant_tensor_data())
+                {
+                    auto size = get<2>(p);
+                    constant_buffers.emplace_back(
+                        new AlignedBuffer(size, alignment, numa_allocator.get()));
+                    memcpy(constant_buffers.back()->get_ptr(), get<1>(p), size);
+                }
+            }
+            allocator = numa_allocator.get();
+            for (auto& buffer : m_numa_constant_buffers[numa_node])
+            {
+                ctx->constant_buffers.push_back(buffer.get());
+            }
+        }
         ctx->op_durations = nullptr;
         if (runtime::cpu::IsTracingEnabled())
         {
@@ -201,7 +271,6 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
         ctx->buffer_data = std::vector<void*>(m_external_function->get_buffer_size());
 
         // Create temporary buffer pools
-        size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
         for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
         {
             auto buffer = new AlignedBuffer(buffer_size, alignment, allocator);
@@ -304,4 +373,6 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
         delete ctx;
     }
     m_num_ctx_available = 0;
+    m_numa_constant_buffers.clear();
+    m_numa_allocators.clear();
 }
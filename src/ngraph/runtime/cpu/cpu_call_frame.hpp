@@ -25,7 +25,9 @@
 
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/allocator.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_numa_allocator.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
 #include "ngraph/runtime/tensor.hpp"
 
@@ -97,6 +99,12 @@ namespace ngraph
                 std::unordered_map<size_t, bool> m_id_pool;
                 std::vector<CPURuntimeContext*> m_ctx_vec;
 
+                // NUMA mode: per-node allocators and the node-local copies of the constants
+                // shared by the contexts bound to a node
+                std::unordered_map<int, std::unique_ptr<NumaAllocator>> m_numa_allocators;
+                std::unordered_map<int, std::vector<std::unique_ptr<AlignedBuffer>>>
+                    m_numa_constant_buffers;
+
                 // Codegen specific
 
                 /// Function that initializes the context used in codegen mode.
@@ -14,46 +14,19 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <thread>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 #include "cpu_executor.hpp"
 
 #include "ngraph/env_util.hpp"
+#include "ngraph/check.hpp"
 #include "ngraph/except.hpp"
-
-#define MAX_PARALLELISM_THRESHOLD 2
-
-static int GetNumCores()
-{
-    const auto omp_num_threads = ngraph::getenv_int("OMP_NUM_THREADS");
-    const auto ngraph_intra_op_parallelism = ngraph::getenv_int("NGRAPH_INTRA_OP_PARALLELISM");
-    int count = 0;
-
-    if (omp_num_threads > 0)
-    {
-        count = omp_num_threads;
-    }
-    else if (ngraph_intra_op_parallelism > 0)
-    {
-        count = ngraph_intra_op_parallelism;
-    }
-    else
-    {
-        count = std::thread::hardware_concurrency() / 2;
-    }
-
-    int max_parallelism_allowed = MAX_PARALLELISM_THRESHOLD * std::thread::hardware_concurrency();
-    if (count > max_parallelism_allowed)
-    {
-        throw ngraph::ngraph_error(
-            "OMP_NUM_THREADS and/or NGRAPH_INTRA_OP_PARALLELISM is too high: "
-            "(" +
-            std::to_string(count) + "). Please specify a value in range [1-" +
-            std::to_string(max_parallelism_allowed) + "]");
-    }
-
-    return count < 1 ? 1 : count;
-}
+#include "ngraph/log.hpp"
 
 static int GetNumThreadPools()
 {
@@ -76,45 +49,227 @@ namespace ngraph
         {
             namespace executor
             {
-                CPUExecutor::CPUExecutor(int num_thread_pools)
-                    : m_num_thread_pools(num_thread_pools)
+                CommunicationQueue::~CommunicationQueue()
                 {
-                    m_num_cores = GetNumCores();
-                    for (int i = 0; i < num_thread_pools; i++)
+                    if (m_thread.joinable())
                     {
-                        int num_threads_per_pool;
+                        {
+                            std::lock_guard<std::mutex> lock(m_mutex);
+                            m_stop = true;
+                        }
+                        m_cv.notify_one();
+                        m_thread.join();
+                    }
+                }
 
-                        // Eigen threadpool will still be used for reductions
-                        // and other tensor operations that dont use a parallelFor
-                        num_threads_per_pool = GetNumCores();
+                std::future<void> CommunicationQueue::schedule(std::function<void()> fn)
+                {
+                    std::packaged_task<void()> task(std::move(fn));
+                    auto result = task.get_future();
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        // The thread is only started by the first asynchronous collective
+                        if (!m_thread.joinable())
+                        {
+                            m_thread = std::thread(&CommunicationQueue::run, this);
+                        }
+                        m_queue.push_back(std::move(task));
+                    }
+                    m_cv.notify_one();
+                    return result;
+                }
 
-                        // User override
-                        int32_t eigen_tp_count =
-                            ngraph::getenv_int("NGRAPH_CPU_EIGEN_THREAD_COUNT");
-                        if (eigen_tp_count > 0)
+                void CommunicationQueue::run()
+                {
+                    while (true)
+                    {
+                        std::packaged_task<void()> task;
                         {
-                            const int tp_count = eigen_tp_count;
-                            if (tp_count < 1 || tp_count > GetNumCores())
+                            std::unique_lock<std::mutex> lock(m_mutex);
+                            m_cv.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+                            if (m_queue.empty())
                             {
-                                throw ngraph_error(
-                                    "Unexpected value specified for NGRAPH_CPU_EIGEN_THREAD_COUNT "
-                                    "(" +
-                                    std::to_string(eigen_tp_count) +
-                                    "). Please specify a value in range [1-" +
-                                    std::to_string(GetNumCores()) + "]");
+                                return;
                             }
-                            num_threads_per_pool = tp_count;
+                            task = std::move(m_queue.front());
+                            m_queue.pop_front();
+                        }
+                        task();
+                    }
+                }
+
+                PartitionThreadPool::PartitionThreadPool(
+                    std::shared_ptr<ThreadingRuntime> runtime, int max_tasks)
+                    : m_runtime(std::move(runtime))
+                    , m_max_tasks(std::max(max_tasks, 0))
+                {
+                }
+
+                PartitionThreadPool::~PartitionThreadPool()
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_idle.wait(lock, [this]() { return m_running == 0; });
+                }
+
+                void PartitionThreadPool::Schedule(std::function<void()> fn)
+                {
+                    if (m_max_tasks == 0)
+                    {
+                        fn();
+                        return;
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_tasks.push_back(std::move(fn));
+                        // A runner already on a worker picks the task up
+                        if (m_running >= m_max_tasks)
+                        {
+                            return;
+                        }
+                        m_running++;
+                    }
+                    m_runtime->schedule([this]() { run_tasks(); });
+                }
+
+                void PartitionThreadPool::run_tasks()
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    while (!m_tasks.empty())
+                    {
+                        auto task = std::move(m_tasks.front());
+                        m_tasks.pop_front();
+                        lock.unlock();
+                        task();
+                        lock.lock();
+                    }
+                    if (--m_running == 0)
+                    {
+                        m_idle.notify_all();
+                    }
+                }
+
+                thread_local Eigen::ThreadPoolDevice* CPUExecutor::s_partition_device = nullptr;
+
+                PartitionScope::PartitionScope(int width)
+                    : m_pool(GetCPUExecutor().m_runtime, width - 1)
+                    , m_device(&m_pool, std::max(width, 1))
+                    , m_caller_device(CPUExecutor::s_partition_device)
+                {
+                    CPUExecutor::s_partition_device = &m_device;
+#if defined(_OPENMP)
+                    m_caller_openmp_threads = omp_get_max_threads();
+                    omp_set_num_threads(std::max(width, 1));
+#endif
+                }
+
+                PartitionScope::~PartitionScope()
+                {
+#if defined(_OPENMP)
+                    omp_set_num_threads(m_caller_openmp_threads);
+#endif
+                    CPUExecutor::s_partition_device = m_caller_device;
+                }
+
+                CPUExecutor::CPUExecutor(int num_thread_pools,
+                                         std::shared_ptr<ThreadingRuntime> runtime)
+                    : m_runtime(std::move(runtime))
+                    , m_num_thread_pools(num_thread_pools)
+                {
+                    // All pools share the runtime's workers. OpenMP keeps its own team next
+                    // to them; with a thread budget the runtime sizes it to what the workers
+                    // leave, so Eigen and the OpenMP kernels of MKLDNN and DEX stay within
+                    // the budget together. Otherwise the team keeps its size.
+                    m_num_cores = m_runtime->get_num_threads();
+                    m_num_openmp_threads = m_runtime->get_num_openmp_threads();
+                    m_runtime->configure_openmp();
+                    for (int i = 0; i < num_thread_pools; i++)
+                    {
+                        add_thread_pool(m_runtime);
+                    }
+                }
+
+                CPUExecutor::CPUExecutor(
+                    const std::vector<std::shared_ptr<ThreadingRuntime>>& runtimes,
+                    const std::vector<int>& numa_nodes)
+                    : m_runtime(runtimes.at(0))
+                    , m_numa_nodes(numa_nodes)
+                    , m_num_thread_pools(static_cast<int>(runtimes.size()))
+                {
+                    NGRAPH_CHECK(runtimes.size() == numa_nodes.size(),
+                                 "One threading runtime is needed per NUMA node");
+                    // Kernels size their work by get_num_cores(), which must not exceed the
+                    // workers of any one node. OpenMP teams are bound to a node per call, see
+                    // get_arena_cpus.
+                    m_num_cores = m_runtime->get_num_threads();
+                    m_num_openmp_threads = m_runtime->get_num_openmp_threads();
+                    for (auto& runtime : runtimes)
+                    {
+                        m_num_cores = std::min(m_num_cores, runtime->get_num_threads());
+                        m_num_openmp_threads =
+                            std::min(m_num_openmp_threads, runtime->get_num_openmp_threads());
+                    }
+                    for (int numa_node : numa_nodes)
+                    {
+                        m_arena_cpus.push_back(get_numa_node_cpus(numa_node));
+                    }
+                    for (auto& runtime : runtimes)
+                    {
+                        add_thread_pool(runtime);
+                    }
+                    // Sets the OpenMP width of a thread budget; the team is moved to a node
+                    // for each call
+                    m_runtime->configure_openmp();
+                }
+
+                void CPUExecutor::add_thread_pool(std::shared_ptr<ThreadingRuntime> runtime)
+                {
+                    // Eigen threadpool will still be used for reductions
+                    // and other tensor operations that dont use a parallelFor
+                    int num_threads_per_pool = std::min(m_num_cores, runtime->get_num_threads());
+
+                    // User override
+                    int32_t eigen_tp_count = ngraph::getenv_int("NGRAPH_CPU_EIGEN_THREAD_COUNT");
+                    if (eigen_tp_count > 0)
+                    {
+                        const int tp_count = eigen_tp_count;
+                        if (tp_count < 1 || tp_count > m_num_cores)
+                        {
+                            throw ngraph_error(
+                                "Unexpected value specified for NGRAPH_CPU_EIGEN_THREAD_COUNT "
+                                "(" +
+                                std::to_string(eigen_tp_count) +
+                                "). Please specify a value in range [1-" +
+                                std::to_string(m_num_cores) + "]");
                         }
+                        num_threads_per_pool = tp_count;
+                    }
 
-                        m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPool>(
-                            new Eigen::ThreadPool(num_threads_per_pool)));
-                        m_thread_pool_devices.push_back(
-                            std::unique_ptr<Eigen::ThreadPoolDevice>(new Eigen::ThreadPoolDevice(
-                                m_thread_pools[i].get(), num_threads_per_pool)));
+                    m_thread_pools.push_back(std::unique_ptr<EigenThreadPoolAdapter>(
+                        new EigenThreadPoolAdapter(std::move(runtime))));
+                    m_thread_pool_devices.push_back(
+                        std::unique_ptr<Eigen::ThreadPoolDevice>(new Eigen::ThreadPoolDevice(
+                            m_thread_pools.back().get(), num_threads_per_pool)));
 #if defined(NGRAPH_TBB_ENABLE)
-                        m_tbb_arenas.emplace_back(1);
+                    m_tbb_arenas.emplace_back(1);
 #endif
+                }
+
+                int CPUExecutor::get_numa_arena(int numa_node) const
+                {
+                    for (size_t i = 0; i < m_numa_nodes.size(); i++)
+                    {
+                        if (m_numa_nodes[i] == numa_node)
+                        {
+                            return static_cast<int>(i);
+                        }
                     }
+                    return 0;
+                }
+
+                const std::vector<int>& CPUExecutor::get_arena_cpus(int arena) const
+                {
+                    static const std::vector<int> s_no_cpus;
+                    return m_arena_cpus.empty() ? s_no_cpus : m_arena_cpus.at(arena);
                 }
 
 #if defined(NGRAPH_TBB_ENABLE)
@@ -142,11 +297,29 @@ namespace ngraph
                 }
 #endif
 
+                static CPUExecutor* create_cpu_executor()
+                {
+                    auto numa_nodes = get_numa_nodes();
+                    if (ngraph::getenv_bool("NGRAPH_CPU_NUMA_AWARE") && numa_nodes.size() > 1)
+                    {
+                        auto runtimes = get_numa_threading_runtimes(numa_nodes);
+                        if (!runtimes.empty())
+                        {
+                            return new CPUExecutor(runtimes, numa_nodes);
+                        }
+                        NGRAPH_WARN << "NGRAPH_CPU_NUMA_AWARE is ignored since the application "
+                                       "installed its own threading runtime";
+                    }
+
+                    int num_thread_pools = GetNumThreadPools();
+                    return new CPUExecutor(num_thread_pools < 1 ? 1 : num_thread_pools,
+                                           get_threading_runtime());
+                }
+
                 CPUExecutor& GetCPUExecutor()
                 {
-                    static int num_thread_pools = GetNumThreadPools();
-                    static CPUExecutor cpu_executor(num_thread_pools < 1 ? 1 : num_thread_pools);
-                    return cpu_executor;
+                    static std::unique_ptr<CPUExecutor> cpu_executor(create_cpu_executor());
+                    return *cpu_executor;
                 }
 #if MKLDNN_VERSION_MAJOR < 1
                 mkldnn::engine global_cpu_engine(mkldnn::engine::cpu, 0);
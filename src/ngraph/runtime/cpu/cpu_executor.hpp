@@ -16,12 +16,18 @@
 
 #pragma once
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <functional>
+#include <future>
+#include <mutex>
 #include <thread>
 
 #include <mkldnn.hpp>
 
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
+#include "ngraph/runtime/cpu/cpu_threading_runtime.hpp"
 
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
@@ -40,15 +46,98 @@ namespace ngraph
             {
                 extern mkldnn::engine global_cpu_engine;
 
+                // Presents a ThreadingRuntime to Eigen so that Eigen tensor expressions run on
+                // the same workers as the rest of the CPU backend.
+                class EigenThreadPoolAdapter : public Eigen::ThreadPoolInterface
+                {
+                public:
+                    explicit EigenThreadPoolAdapter(std::shared_ptr<ThreadingRuntime> runtime)
+                        : m_runtime(std::move(runtime))
+                    {
+                    }
+
+                    void Schedule(std::function<void()> fn) override
+                    {
+                        m_runtime->schedule(std::move(fn));
+                    }
+                    int NumThreads() const override { return m_runtime->get_num_threads(); }
+                    int CurrentThreadId() const override
+                    {
+                        return m_runtime->get_current_thread_id();
+                    }
+
+                private:
+                    std::shared_ptr<ThreadingRuntime> m_runtime;
+                };
+
+                // Runs the tasks Eigen schedules on the workers of a ThreadingRuntime, at most
+                // max_tasks of them at once. Further tasks wait in a queue of its own, so a
+                // partition of the machine cannot spread over all of the shared workers. With
+                // max_tasks <= 0 every task runs inline on the thread that schedules it.
+                class CPU_BACKEND_API PartitionThreadPool : public Eigen::ThreadPoolInterface
+                {
+                public:
+                    PartitionThreadPool(std::shared_ptr<ThreadingRuntime> runtime, int max_tasks);
+                    PartitionThreadPool(const PartitionThreadPool&) = delete;
+                    PartitionThreadPool& operator=(const PartitionThreadPool&) = delete;
+                    // Waits for the tasks still running
+                    ~PartitionThreadPool() override;
+
+                    void Schedule(std::function<void()> fn) override;
+                    int NumThreads() const override { return std::max(m_max_tasks, 1); }
+                    // Workers are shared with other partitions and have no index in this one
+                    int CurrentThreadId() const override { return -1; }
+
+                private:
+                    void run_tasks();
+
+                    std::shared_ptr<ThreadingRuntime> m_runtime;
+                    int m_max_tasks;
+                    std::mutex m_mutex;
+                    std::condition_variable m_idle;
+                    std::deque<std::function<void()>> m_tasks;
+                    int m_running = 0;
+                };
+
+                // Runs the asynchronous collectives of one executable on a thread of its own.
+                // Calls run one at a time in the order they were scheduled, so the collectives
+                // of an executable keep the same order on every rank.
+                class CommunicationQueue
+                {
+                public:
+                    CommunicationQueue() = default;
+                    CommunicationQueue(const CommunicationQueue&) = delete;
+                    CommunicationQueue& operator=(const CommunicationQueue&) = delete;
+                    // Waits for the collectives still queued
+                    ~CommunicationQueue();
+
+                    std::future<void> schedule(std::function<void()> fn);
+
+                private:
+                    void run();
+
+                    std::thread m_thread;
+                    std::mutex m_mutex;
+                    std::condition_variable m_cv;
+                    std::deque<std::packaged_task<void()>> m_queue;
+                    bool m_stop = false;
+                };
+
                 // CPUExecutor owns the resources for executing a graph.
                 class CPUExecutor
                 {
                 public:
-                    explicit CPUExecutor(int num_thread_pools);
+                    CPUExecutor(int num_thread_pools, std::shared_ptr<ThreadingRuntime> runtime);
+                    // NUMA mode: one thread pool per node, each served by a runtime whose
+                    // workers are confined to that node.
+                    CPUExecutor(const std::vector<std::shared_ptr<ThreadingRuntime>>& runtimes,
+                                const std::vector<int>& numa_nodes);
 
+                    // The device of the PartitionScope of the calling thread, if there is one
                     Eigen::ThreadPoolDevice& get_device(int id)
                     {
-                        return *m_thread_pool_devices[id].get();
+                        return s_partition_device ? *s_partition_device
+                                                  : *m_thread_pool_devices[id].get();
                     }
 
 #if defined(NGRAPH_TBB_ENABLE)
@@ -63,17 +152,63 @@ namespace ngraph
 #endif
                     int get_num_thread_pools() { return m_num_thread_pools; }
                     int get_num_cores() { return m_num_cores; }
+                    // Width of the OpenMP teams, taken from the thread budget of the runtimes
+                    int get_num_openmp_threads() const { return m_num_openmp_threads; }
+                    ThreadingRuntime& get_threading_runtime() { return *m_runtime; }
+                    // NUMA nodes served by the thread pools; empty unless NUMA mode is enabled.
+                    const std::vector<int>& get_numa_nodes() const { return m_numa_nodes; }
+                    // Thread pool (arena) whose workers run on numa_node, 0 if there is none.
+                    int get_numa_arena(int numa_node) const;
+                    // Cores of the NUMA node served by a thread pool; empty unless NUMA mode
+                    // is enabled.
+                    const std::vector<int>& get_arena_cpus(int arena) const;
+
                 private:
-                    std::vector<std::unique_ptr<Eigen::ThreadPool>> m_thread_pools;
+                    friend class PartitionScope;
+
+                    void add_thread_pool(std::shared_ptr<ThreadingRuntime> runtime);
+
+                    static thread_local Eigen::ThreadPoolDevice* s_partition_device;
+
+                    std::shared_ptr<ThreadingRuntime> m_runtime;
+                    std::vector<int> m_numa_nodes;
+                    std::vector<std::vector<int>> m_arena_cpus;
+                    std::vector<std::unique_ptr<EigenThreadPoolAdapter>> m_thread_pools;
                     std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> m_thread_pool_devices;
 #if defined(NGRAPH_TBB_ENABLE)
                     std::vector<tbb::task_arena> m_tbb_arenas;
 #endif
                     int m_num_thread_pools;
                     int m_num_cores;
+                    int m_num_openmp_threads;
                 };
 
                 extern CPUExecutor& GetCPUExecutor();
+
+                /// \brief Confines the kernels the calling thread runs to a partition of
+                ///        `width` cores while in scope.
+                ///
+                /// OpenMP regions started by the thread run `width` wide, and Eigen tensor
+                /// expressions run on a device of the same width whose tasks occupy at most
+                /// width - 1 of the shared workers next to the calling thread; a scope of width 1
+                /// runs them on the calling thread alone. Kernels that
+                /// other threads run for the same call are not confined. The caller's OpenMP
+                /// width and device are restored when the scope ends.
+                class CPU_BACKEND_API PartitionScope
+                {
+                public:
+                    explicit PartitionScope(int width);
+                    ~PartitionScope();
+
+                    PartitionScope(const PartitionScope&) = delete;
+                    PartitionScope& operator=(const PartitionScope&) = delete;
+
+                private:
+                    PartitionThreadPool m_pool;
+                    Eigen::ThreadPoolDevice m_device;
+                    Eigen::ThreadPoolDevice* m_caller_device;
+                    int m_caller_openmp_threads = 0;
+                };
             }
         }
     }
@@ -90,8 +90,11 @@
 #include "ngraph/op/fused/gelu.hpp"
 #include "ngraph/op/fused/gemm.hpp"
 #include "ngraph/op/fused/group_conv.hpp"
+#include "ngraph/op/fused/layer_norm.hpp"
 #include "ngraph/op/fused/lstm_cell.hpp"
 #include "ngraph/op/fused/matmul.hpp"
+#include "ngraph/op/fused/mvn.hpp"
+#include "ngraph/op/fused/normalize_l2.hpp"
 #include "ngraph/op/fused/softmax_crossentropy.hpp"
 #include "ngraph/op/gather.hpp"
 #include "ngraph/op/gather_nd.hpp"
@@ -121,6 +124,7 @@
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/op/quantized_convolution.hpp"
 #include "ngraph/op/quantized_dot.hpp"
+#include "ngraph/op/recv.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/replace_slice.hpp"
 #include "ngraph/op/reshape.hpp"
@@ -130,6 +134,7 @@
 #include "ngraph/op/scatter_add.hpp"
 #include "ngraph/op/scatter_nd_add.hpp"
 #include "ngraph/op/select.hpp"
+#include "ngraph/op/send.hpp"
 #include "ngraph/op/sigmoid.hpp"
 #include "ngraph/op/sign.hpp"
 #include "ngraph/op/sin.hpp"
@@ -144,6 +149,7 @@
 #include "ngraph/op/topk.hpp"
 #include "ngraph/op/xor.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
 #include "ngraph/pass/batch_fusion.hpp"
 #include "ngraph/pass/common_function_collection.hpp"
 #include "ngraph/pass/constant_folding.hpp"
@@ -197,6 +203,7 @@
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_assignment.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_collapse_dims.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_dynamic_quantization.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
@@ -206,6 +213,7 @@
 #include "ngraph/runtime/cpu/pass/cpu_mkldnn_primitive_build.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_sparsify.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_workspace_insertion.hpp"
 
 using namespace std;
@@ -253,6 +261,7 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
 #else
     , m_direct_execution(true)
 #endif
+    , m_async_communication(getenv_bool("NGRAPH_CPU_ASYNC_ALLREDUCE"))
     , m_compiled_function(nullptr)
     , m_function_name(function->get_name())
     , m_is_built(false)
@@ -1243,6 +1252,31 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
             return false;
 #endif
         }
+        else if (typeid(ngraph::op::LayerNorm) == typeid(node) ||
+                 typeid(ngraph::op::LayerNormBackprop) == typeid(node) ||
+                 typeid(ngraph::op::MVN) == typeid(node) ||
+                 typeid(ngraph::op::NormalizeL2) == typeid(node))
+        {
+            // The native normalization kernels need static f32/f64 inputs and constant
+            // NormalizeL2 axes; anything else is decomposed
+            auto et = node.get_input_element_type(0);
+            if (et != element::f32 && et != element::f64)
+            {
+                return false;
+            }
+            for (auto& input : node.inputs())
+            {
+                if (input.get_partial_shape().is_dynamic())
+                {
+                    return false;
+                }
+            }
+            if (typeid(ngraph::op::NormalizeL2) == typeid(node) &&
+                !is_type<ngraph::op::Constant>(node.get_argument(1)))
+            {
+                return false;
+            }
+        }
         // GroupConvolution is only supported with MKLDNN
         else if (auto conv = as_type<ngraph::op::GroupConvolution>(const_cast<Node*>(&node)))
         {
@@ -1292,6 +1326,13 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
         CoreFusion, true, ngraph::pass, ngraph::pass::FusionType::ALL_FUSIONS)
     REGISTER_KNOBBED_PASS_WITH_ARGS(FusedOpDecomposition, true, ngraph::pass, is_supported)
     REGISTER_KNOBBED_PASS(CPUPreFusion, true, runtime::cpu::pass)
+    // These run ahead of CPUFusion so Dots are not fused into MatmulBias first. The ops they
+    // create have no code generation emitters.
+    if (dex)
+    {
+        REGISTER_KNOBBED_PASS(CPUSparsify, false, runtime::cpu::pass)
+        REGISTER_KNOBBED_PASS(CPUDynamicQuantization, false, runtime::cpu::pass)
+    }
 
     // Disable CPUFusion if MLIR is enabled to preserve core ops.
     if (!getenv_bool("NGRAPH_MLIR"))
@@ -1309,6 +1350,8 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     }
 #endif
 
+    REGISTER_KNOBBED_PASS(AllReduceBucketing, true, ngraph::pass)
+
     NodeVector nv_cwi; // We dont need CPUWorkspaceInsertion to return list of indices
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUWorkspaceInsertion, true, runtime::cpu::pass, nv_cwi, false)
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUAssignment, true, runtime::cpu::pass, this)
@@ -1344,6 +1387,133 @@ bool runtime::cpu::CPU_ExternalFunction::computes_result(Node* node)
     return false;
 }
 
+size_t runtime::cpu::CPU_ExternalFunction::add_async_communication_op(const Node* node)
+{
+    auto slot = m_async_communication_ops.size();
+    m_async_communication_ops[node] = slot;
+    return slot;
+}
+
+runtime::cpu::executor::CommunicationQueue&
+    runtime::cpu::CPU_ExternalFunction::get_communication_queue()
+{
+    if (!m_communication_queue)
+    {
+        m_communication_queue.reset(new executor::CommunicationQueue());
+    }
+    return *m_communication_queue;
+}
+
+void runtime::cpu::CPU_ExternalFunction::schedule_communication_waits(
+    const vector<shared_ptr<Node>>& ops)
+{
+    // Memory a tensor occupies: the buffer it lives in and its byte range in that buffer.
+    // Intermediates all live in the temporary pool (-1); inputs, outputs and constants live in
+    // the buffer of their buffer set. A tensor with no known placement (-2) aliases everything.
+    struct Region
+    {
+        int64_t buffer;
+        size_t begin;
+        size_t end;
+    };
+    auto region_of = [this](descriptor::Tensor& tensor) -> Region {
+        auto role = m_tensor_roles.find(tensor.get_name());
+        auto buffer_id = tensor_to_bufferID.find(&tensor);
+        if (role == m_tensor_roles.end() || buffer_id == tensor_to_bufferID.end())
+        {
+            return Region{-2, 0, numeric_limits<size_t>::max()};
+        }
+        int64_t buffer = role->second == TensorRole::INTERMEDIATE
+                             ? -1
+                             : static_cast<int64_t>(buffer_id->second);
+        return Region{buffer, tensor.get_pool_offset(), tensor.get_pool_offset() + tensor.size()};
+    };
+    auto overlaps = [](const vector<Region>& a, const vector<Region>& b) {
+        for (auto& x : a)
+        {
+            for (auto& y : b)
+            {
+                if ((x.buffer == y.buffer || x.buffer == -2 || y.buffer == -2) &&
+                    x.begin < y.end && y.begin < x.end)
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    struct PendingCommunication
+    {
+        size_t slot;
+        vector<Region> reads;
+        vector<Region> writes;
+    };
+    list<PendingCommunication> pending;
+
+    m_communication_waits.assign(ops.size(), vector<size_t>());
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        Node* node = ops[i].get();
+        vector<Region> reads;
+        vector<Region> writes;
+        for (size_t j = 0; j < node->get_input_size(); j++)
+        {
+            reads.push_back(region_of(node->input(j).get_tensor()));
+        }
+        for (size_t j = 0; j < node->get_output_size(); j++)
+        {
+            writes.push_back(region_of(node->get_output_tensor(j)));
+        }
+
+        auto async_op = m_async_communication_ops.find(node);
+        // Collectives that run on the calling thread must not overtake the queued ones
+        bool communicates = async_op == m_async_communication_ops.end() &&
+                            (is_type<ngraph::op::AllReduce>(node) ||
+                             is_type<ngraph::op::BroadcastDistributed>(node) ||
+                             is_type<ngraph::op::Send>(node) || is_type<ngraph::op::Recv>(node));
+
+        // A collective is waited for by the first op that reads its result or overwrites
+        // memory it still reads or writes
+        for (auto it = pending.begin(); it != pending.end();)
+        {
+            if (communicates || overlaps(reads, it->writes) || overlaps(writes, it->reads) ||
+                overlaps(writes, it->writes))
+            {
+                m_communication_waits[i].push_back(it->slot);
+                it = pending.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        if (async_op != m_async_communication_ops.end())
+        {
+            pending.push_back(PendingCommunication{async_op->second, reads, writes});
+        }
+    }
+}
+
+void runtime::cpu::CPU_ExternalFunction::wait_for_communication(CPURuntimeContext* ctx,
+                                                                 size_t slot)
+{
+    auto& pending = ctx->pending_communication[slot];
+    if (pending.valid())
+    {
+        pending.get();
+    }
+}
+
+void runtime::cpu::CPU_ExternalFunction::wait_for_all_communication(CPURuntimeContext* ctx)
+{
+    for (size_t slot = 0; slot < ctx->pending_communication.size(); slot++)
+    {
+        wait_for_communication(ctx, slot);
+    }
+}
+
 static void dump_one_kernel_with_type(runtime::cpu::CPU_DebugTracer& debug_tracer,
                                       runtime::cpu::TensorTracerAttributes& t_attrs,
                                       const std::string& kernel_name,
@@ -1537,7 +1707,8 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
             m_buffer_indices[output_tensor->get_name()] = buffer_index;
             constant_tensor_data.emplace_back(
                 buffer_index,
-                const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr()));
+                const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr()),
+                output_tensor->size());
             auto tensor_set = get_tensor_set(output_tensor);
             // process all tensors in the set containing the output tensor of the constant
             for (auto& ele_t : tensor_set)
@@ -1599,12 +1770,23 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     // After processing inputs, outputs, constants, and intermediates, set the buffer size.
     m_buffer_size = buffer_index;
 
+#if defined(NGRAPH_TBB_ENABLE)
+    // The flow graph runs every functor as its own task, so there is no program order in
+    // which to place the waits
+    if (m_use_tbb)
+    {
+        m_async_communication = false;
+    }
+#endif
+
+    vector<shared_ptr<Node>> functor_ops;
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant())
         {
             continue;
         }
+        functor_ops.push_back(node);
         auto& n = *node; // Work around a compiler warning (*node inside typeid may have effects
         // with shared pointers, which is fine here but clang doesn't like it.)
         auto handler = GetGlobalBuildDispatcher().find(type_index(typeid(n)));
@@ -1717,6 +1899,11 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         m_perf_counters.emplace_back(node, 0, 0);
     }
 
+    if (!m_async_communication_ops.empty())
+    {
+        schedule_communication_waits(functor_ops);
+    }
+
     if (getenv_bool("NGRAPH_DEX_DEBUG"))
     {
         string filename = file_util::path_join(s_debug_dir, m_function_name + "_debug.txt");
@@ -1793,9 +1980,13 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                     static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
             }
 
+            size_t constant_index = 0;
             for (auto& p : constant_tensor_data)
             {
-                ctx->buffer_data[p.first] = p.second;
+                ctx->buffer_data[get<0>(p)] =
+                    ctx->constant_buffers.empty()
+                        ? get<1>(p)
+                        : ctx->constant_buffers[constant_index++]->get_ptr();
             }
         }
 
@@ -1836,7 +2027,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                                     {
                                         start_ts = cpu::Clock::now();
                                     }
-                                    CPUExecutionContext ectx{0};
+                                    CPUExecutionContext ectx{ctx->arena};
                                     executor::GetCPUExecutor().execute(*functor, ctx, &ectx, true);
                                     if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
                                     {
@@ -1951,9 +2142,33 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                 }
             }
 
+            // Collectives still running when an op throws must not outlive the buffers the
+            // caller releases
+            struct CommunicationGuard
+            {
+                ~CommunicationGuard()
+                {
+                    for (auto& pending : ctx->pending_communication)
+                    {
+                        if (pending.valid())
+                        {
+                            pending.wait();
+                        }
+                    }
+                }
+                CPURuntimeContext* ctx;
+            } communication_guard{ctx};
+
             for (; ctx->pc < functors.size(); ctx->pc++)
             {
                 auto index = profiler_count++;
+                if (!m_communication_waits.empty())
+                {
+                    for (auto slot : m_communication_waits[ctx->pc])
+                    {
+                        wait_for_communication(ctx, slot);
+                    }
+                }
                 if ((enables.at(ctx->pc))(ctx) || ctx->first_iteration)
                 {
                     // Each Op will have exactly one functor, start the clock before the exceution
@@ -1964,15 +2179,24 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                         start_ts = cpu::Clock::now();
                     }
 
-                    CPUExecutionContext ectx{0};
+                    CPUExecutionContext ectx{ctx->arena};
 
                     if (debug_tracer.tracing_is_enabled())
                     {
                         this->dump_one_kernel(debug_tracer, ctx, true);
                     }
 
+                    bool profile_latency =
+                        m_latency_profiler != nullptr && m_latency_profiler->is_enabled();
+                    uint64_t op_start = profile_latency ? CycleClock::now() : 0;
+
                     executor::GetCPUExecutor().execute(functors.at(ctx->pc), ctx, &ectx);
 
+                    if (profile_latency)
+                    {
+                        m_latency_profiler->record_op(ctx->pc, CycleClock::now() - op_start);
+                    }
+
                     if (debug_tracer.tracing_is_enabled())
                     {
                         this->dump_one_kernel(debug_tracer, ctx, false);
@@ -1980,6 +2204,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
 
                     if (ctx->breakpoints.count(ctx->pc + 1))
                     {
+                        wait_for_all_communication(ctx);
                         ctx->pc++;
                         break;
                     }
@@ -2016,6 +2241,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                     }
                 }
             }
+            wait_for_all_communication(ctx);
         }
         ctx->first_iteration = false;
         if (runtime::cpu::IsTracingEnabled())
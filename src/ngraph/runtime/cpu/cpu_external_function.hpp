@@ -44,6 +44,7 @@
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
+#include "ngraph/runtime/latency_profiler.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/state/state.hpp"
 #include "ngraph/util.hpp"
@@ -55,6 +56,10 @@ namespace ngraph
         namespace cpu
         {
             class CPU_ExternalFunction;
+            namespace executor
+            {
+                class CommunicationQueue;
+            }
             class CPU_Emitter;
             class CPU_CallFrame;
             class CPU_Debugger;
@@ -127,6 +132,10 @@ namespace ngraph
                 {
                     return m_memory_buffer_sizes;
                 }
+                const std::list<std::tuple<size_t, void*, size_t>>& get_constant_tensor_data() const
+                {
+                    return constant_tensor_data;
+                }
                 const std::vector<OpAttributes>& get_op_attrs() const { return m_op_attrs; }
                 const std::unique_ptr<MKLDNNEmitter>& get_mkldnn_emitter() const
                 {
@@ -174,6 +183,19 @@ namespace ngraph
                     return callees;
                 }
                 bool is_direct_execution() const { return m_direct_execution; }
+                // Whether collectives may run on the communication queue while the following
+                // ops execute (NGRAPH_CPU_ASYNC_ALLREDUCE, DEX without TBB only)
+                bool is_async_communication_enabled() const { return m_async_communication; }
+                // Reserves a CPURuntimeContext::pending_communication slot for an op whose
+                // functor starts an asynchronous collective
+                size_t add_async_communication_op(const Node* node);
+                // Queue that runs the asynchronous collectives of this function, created on
+                // first use
+                executor::CommunicationQueue& get_communication_queue();
+                size_t get_num_async_communication_ops() const
+                {
+                    return m_async_communication_ops.size();
+                }
                 void write_to_file(const std::string& code,
                                    const std::string& directory,
                                    const std::string& filename);
@@ -201,6 +223,11 @@ namespace ngraph
                                             ngraph::pass::PassConfig& pass_config);
 
                 bool computes_result(Node* node);
+                // Computes, for every functor, the asynchronous collectives it has to wait for
+                // before it runs
+                void schedule_communication_waits(const std::vector<std::shared_ptr<Node>>& ops);
+                void wait_for_communication(CPURuntimeContext* ctx, size_t slot);
+                void wait_for_all_communication(CPURuntimeContext* ctx);
                 void release_function() { m_function = nullptr; }
 #if !defined(NGRAPH_DEX_ONLY)
                 void emit_debug_function_entry(CodeWriter& writer,
@@ -249,6 +276,7 @@ namespace ngraph
                 bool m_is_compiled;
 #endif
                 bool m_direct_execution;
+                bool m_async_communication;
 
                 /// Function that initializes the context used in codegen mode.
                 InitContextFuncCG m_compiled_init_ctx_func;
@@ -277,6 +305,11 @@ namespace ngraph
                 std::vector<CPUKernelFunctor> functors;
                 std::vector<std::string> op_names;
                 std::vector<std::function<bool(CPURuntimeContext*)>> enables;
+                // pending_communication slot of each asynchronous collective
+                std::unordered_map<const Node*, size_t> m_async_communication_ops;
+                std::unique_ptr<executor::CommunicationQueue> m_communication_queue;
+                // slots each functor waits on before it runs, empty if nothing is asynchronous
+                std::vector<std::vector<size_t>> m_communication_waits;
                 std::list<std::pair<std::function<bool(CPURuntimeContext*)>, std::string>>
                     enable_nodename_list;
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>
@@ -303,9 +336,9 @@ namespace ngraph
                 // used to calculate the correct address at runtime
                 std::list<std::pair<size_t, size_t>> intermediates_offsets;
                 // index into the cpu_runtime_context's buffer_data vector to get a tensor,
-                // and the tensor pointer.
+                // the tensor pointer and its size in bytes.
                 // used to get the address at runtime
-                std::list<std::pair<size_t, void*>> constant_tensor_data;
+                std::list<std::tuple<size_t, void*, size_t>> constant_tensor_data;
                 // index into the cpu_runtime_context's buffer_data vector to get a tensor,
                 // input index, offset into the input, and if the input is stale
                 // used to calculate the correct address at runtime
@@ -320,6 +353,8 @@ namespace ngraph
                 std::unordered_map<std::string, std::shared_ptr<CPU_ExternalFunction>> callees;
                 bool m_is_built;
                 std::vector<runtime::PerformanceCounter> m_perf_counters;
+                // Per-op latency histograms of the executable, indexed like m_perf_counters
+                runtime::LatencyProfiler* m_latency_profiler = nullptr;
 
                 /// Map each node with mkldnn implementation to its mkldnn primitive creating
                 /// string, deps, mkldnn primitive index, and mkldnn scratchpad size.
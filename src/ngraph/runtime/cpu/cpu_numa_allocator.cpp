@@ -0,0 +1,109 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "cpu_numa_allocator.hpp"
+#include "ngraph/log.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#if defined(__linux__)
+// From <numaif.h>; spelled out here to avoid a dependency on libnuma.
+#define NGRAPH_MPOL_BIND 2
+#endif
+
+runtime::cpu::NumaAllocator::NumaAllocator(int numa_node)
+    : m_numa_node(numa_node)
+{
+}
+
+runtime::cpu::NumaAllocator::~NumaAllocator()
+{
+    for (auto& allocation : m_allocation_sizes)
+    {
+#if defined(__linux__)
+        munmap(allocation.first, allocation.second);
+#else
+        get_default_allocator()->free(allocation.first);
+#endif
+    }
+}
+
+void* runtime::cpu::NumaAllocator::malloc(size_t size, size_t alignment)
+{
+    size = std::max<size_t>(size, 1);
+#if defined(__linux__)
+    // mmap returns page aligned memory, which satisfies every alignment AlignedBuffer uses.
+    (void)alignment;
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED)
+    {
+        throw ngraph_error("mmap failed to allocate memory of size " + to_string(size));
+    }
+
+    const size_t bits_per_word = 8 * sizeof(unsigned long);
+    vector<unsigned long> node_mask(m_numa_node / bits_per_word + 1, 0);
+    node_mask[m_numa_node / bits_per_word] |= 1UL << (m_numa_node % bits_per_word);
+    if (syscall(SYS_mbind,
+                ptr,
+                size,
+                NGRAPH_MPOL_BIND,
+                node_mask.data(),
+                node_mask.size() * bits_per_word + 1,
+                0) != 0)
+    {
+        NGRAPH_DEBUG << "mbind to NUMA node " << m_numa_node
+                     << " failed, using first-touch placement";
+    }
+#else
+    void* ptr = get_default_allocator()->malloc(size, alignment);
+#endif
+
+    lock_guard<mutex> lock(m_mutex);
+    m_allocation_sizes[ptr] = size;
+    return ptr;
+}
+
+void runtime::cpu::NumaAllocator::free(void* ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    size_t size;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        auto it = m_allocation_sizes.find(ptr);
+        NGRAPH_CHECK(it != m_allocation_sizes.end(), "NumaAllocator: unknown pointer freed");
+        size = it->second;
+        m_allocation_sizes.erase(it);
+    }
+#if defined(__linux__)
+    munmap(ptr, size);
+#else
+    (void)size;
+    get_default_allocator()->free(ptr);
+#endif
+}
@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+
+#include "ngraph/runtime/allocator.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Allocator whose memory is bound to the pages of one NUMA node.
+            ///
+            /// Memory is mapped directly and bound with mbind(2); if binding is not permitted
+            /// the pages fall back to the kernel's default first-touch placement.
+            class CPU_BACKEND_API NumaAllocator : public runtime::Allocator
+            {
+            public:
+                explicit NumaAllocator(int numa_node);
+                ~NumaAllocator() override;
+
+                void* malloc(size_t size, size_t alignment) override;
+                void free(void* ptr) override;
+
+                int get_numa_node() const { return m_numa_node; }
+            private:
+                int m_numa_node;
+                std::mutex m_mutex;
+                std::unordered_map<void*, size_t> m_allocation_sizes;
+            };
+        }
+    }
+}
@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <future>
 #include <set>
 
 #if defined(NGRAPH_TBB_ENABLE)
@@ -79,6 +80,15 @@ namespace ngraph
                 State* const* states;
                 std::set<size_t> breakpoints;
                 size_t pc;
+                // NUMA node the context is bound to, or -1
+                int numa_node;
+                // thread pool used by the kernels of this context
+                int arena;
+                // node-local copies of the constants, empty if the shared copies are used
+                std::vector<AlignedBuffer*> constant_buffers;
+                // collectives still running on the communication queue, indexed by the
+                // asynchronous communication slot of the op that started them
+                std::vector<std::future<void>> pending_communication;
 #ifdef NGRAPH_MLIR_ENABLE
                 /// Maps CompiledKernel nodes to their MLIR compiler
                 /// The MLIR compiler caches the compiled code on the first invocation,
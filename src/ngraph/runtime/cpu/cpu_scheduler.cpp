@@ -0,0 +1,276 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_scheduler.hpp"
+#include "ngraph/runtime/cpu/cpu_threading_runtime.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::CPUScheduler::CPUScheduler(const SchedulerOptions& options)
+    : m_num_cores(options.num_cores)
+    , m_min_width(options.min_width)
+    , m_max_width(options.max_width)
+    , m_max_queued(options.max_queued)
+{
+    if (m_num_cores <= 0)
+    {
+        m_num_cores = executor::get_threading_runtime()->get_num_threads();
+    }
+    NGRAPH_CHECK(m_min_width >= 1 && m_min_width <= m_num_cores,
+                 "min_width must be in [1, ",
+                 m_num_cores,
+                 "], got ",
+                 m_min_width);
+    if (m_max_width <= 0 || m_max_width > m_num_cores)
+    {
+        m_max_width = m_num_cores;
+    }
+    NGRAPH_CHECK(m_max_width >= m_min_width, "max_width must not be less than min_width");
+    m_free_cores = m_num_cores;
+
+    int num_workers = m_num_cores / m_min_width;
+    for (int i = 0; i < num_workers; i++)
+    {
+        m_workers.emplace_back(&CPUScheduler::worker_loop, this);
+    }
+}
+
+runtime::cpu::CPUScheduler::~CPUScheduler()
+{
+    vector<Request> abandoned;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+        for (auto& model : m_models)
+        {
+            for (auto& request : model->queue)
+            {
+                abandoned.push_back(move(request));
+            }
+            model->queue.clear();
+        }
+    }
+    m_cv.notify_all();
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+    for (auto& request : abandoned)
+    {
+        request.promise.set_exception(
+            make_exception_ptr(ngraph_error("CPUScheduler destroyed before the request ran")));
+    }
+}
+
+runtime::cpu::CPUScheduler::ModelId
+    runtime::cpu::CPUScheduler::add_model(const shared_ptr<Executable>& executable,
+                                          const ModelOptions& options)
+{
+    NGRAPH_CHECK(executable, "add_model needs an executable");
+    NGRAPH_CHECK(options.weight > 0, "Model weight must be positive, got ", options.weight);
+    NGRAPH_CHECK(options.max_concurrency > 0, "Model max_concurrency must be positive");
+    unique_ptr<Model> model(new Model());
+    model->executable = executable;
+    model->options = options;
+    lock_guard<mutex> lock(m_mutex);
+    m_models.push_back(move(model));
+    return m_models.size() - 1;
+}
+
+future<void>
+    runtime::cpu::CPUScheduler::submit(ModelId model_id,
+                                       const vector<shared_ptr<Tensor>>& outputs,
+                                       const vector<shared_ptr<Tensor>>& inputs)
+{
+    Request request;
+    request.outputs = outputs;
+    request.inputs = inputs;
+    auto result = request.promise.get_future();
+    {
+        lock_guard<mutex> lock(m_mutex);
+        NGRAPH_CHECK(model_id < m_models.size(), "Unknown model ", model_id);
+        Model& model = *m_models[model_id];
+        if ((m_max_queued > 0 && m_queued >= m_max_queued) ||
+            (model.options.max_queued > 0 && model.queue.size() >= model.options.max_queued))
+        {
+            model.statistics.rejected++;
+            throw SchedulerRejected("CPUScheduler queue is full");
+        }
+
+        // A model that was idle starts from the least virtual time of the active models of
+        // its priority, so it cannot claim the cores for the time it did not use
+        if (model.queue.empty() && model.running == 0)
+        {
+            double least = numeric_limits<double>::max();
+            for (auto& other : m_models)
+            {
+                if (other.get() != &model && other->options.priority == model.options.priority &&
+                    (!other->queue.empty() || other->running > 0))
+                {
+                    least = min(least, other->virtual_time);
+                }
+            }
+            if (least != numeric_limits<double>::max())
+            {
+                model.virtual_time = max(model.virtual_time, least);
+            }
+        }
+        model.queue.push_back(move(request));
+        m_queued++;
+    }
+    m_cv.notify_one();
+    return result;
+}
+
+void runtime::cpu::CPUScheduler::pause()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_paused = true;
+}
+
+void runtime::cpu::CPUScheduler::resume()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_paused = false;
+    }
+    m_cv.notify_all();
+}
+
+size_t runtime::cpu::CPUScheduler::get_queued() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_queued;
+}
+
+size_t runtime::cpu::CPUScheduler::get_running() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_running;
+}
+
+runtime::cpu::ModelStatistics runtime::cpu::CPUScheduler::get_statistics(ModelId model) const
+{
+    lock_guard<mutex> lock(m_mutex);
+    NGRAPH_CHECK(model < m_models.size(), "Unknown model ", model);
+    return m_models[model]->statistics;
+}
+
+bool runtime::cpu::CPUScheduler::is_runnable(const Model& model) const
+{
+    return !model.queue.empty() && model.running < model.options.max_concurrency;
+}
+
+runtime::cpu::CPUScheduler::Model* runtime::cpu::CPUScheduler::select_model()
+{
+    Model* selected = nullptr;
+    for (auto& model : m_models)
+    {
+        if (!is_runnable(*model))
+        {
+            continue;
+        }
+        if (!selected || model->options.priority > selected->options.priority ||
+            (model->options.priority == selected->options.priority &&
+             model->virtual_time < selected->virtual_time))
+        {
+            selected = model.get();
+        }
+    }
+    return selected;
+}
+
+void runtime::cpu::CPUScheduler::worker_loop()
+{
+    unique_lock<mutex> lock(m_mutex);
+    while (true)
+    {
+        Model* model = nullptr;
+        while (!m_stop &&
+               (m_paused || m_free_cores < m_min_width || !(model = select_model())))
+        {
+            m_cv.wait(lock);
+        }
+        if (m_stop)
+        {
+            return;
+        }
+
+        // Share the free cores among everything that could start now
+        size_t runnable = 0;
+        for (auto& other : m_models)
+        {
+            if (is_runnable(*other))
+            {
+                runnable += min(other->queue.size(),
+                                other->options.max_concurrency - other->running);
+            }
+        }
+        int width = m_free_cores / static_cast<int>(max<size_t>(runnable, 1));
+        width = min(max(width, m_min_width), min(m_max_width, m_free_cores));
+
+        Request request = move(model->queue.front());
+        model->queue.pop_front();
+        model->running++;
+        m_queued--;
+        m_running++;
+        m_free_cores -= width;
+        lock.unlock();
+
+        exception_ptr error;
+        auto start = chrono::steady_clock::now();
+        try
+        {
+            // OpenMP and Eigen kernels of the call share the same width
+            executor::PartitionScope partition(width);
+            model->executable->call(request.outputs, request.inputs);
+        }
+        catch (...)
+        {
+            error = current_exception();
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        lock.lock();
+        model->running--;
+        m_running--;
+        m_free_cores += width;
+        model->virtual_time += seconds * width / model->options.weight;
+        if (!error)
+        {
+            model->statistics.completed++;
+            model->statistics.core_seconds += seconds * width;
+        }
+        lock.unlock();
+        m_cv.notify_all();
+        if (error)
+        {
+            request.promise.set_exception(error);
+        }
+        else
+        {
+            request.promise.set_value();
+        }
+        lock.lock();
+    }
+}
@@ -0,0 +1,168 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+#include "ngraph/runtime/executable.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            struct SchedulerOptions
+            {
+                /// Cores shared by all requests. 0 uses the threads of the CPU threading
+                /// runtime.
+                int num_cores = 0;
+                /// Smallest intra-op width a request is started with. At most
+                /// num_cores / min_width requests run at once.
+                int min_width = 1;
+                /// Largest intra-op width a request is started with, 0 for num_cores
+                int max_width = 0;
+                /// Queued requests of all models above which submit rejects new ones, 0 for
+                /// no limit
+                size_t max_queued = 0;
+            };
+
+            struct ModelOptions
+            {
+                /// Queued requests of a higher priority are always started first
+                int priority = 0;
+                /// Share of core time relative to the other models of the same priority
+                double weight = 1.0;
+                /// Requests of the model that may run at once. Should not exceed the
+                /// NGRAPH_CPU_CONCURRENCY the executable was compiled with, or the extra
+                /// requests wait inside the call while holding their cores.
+                size_t max_concurrency = 1;
+                /// Queued requests of the model above which submit rejects new ones, 0 for no
+                /// limit
+                size_t max_queued = 0;
+            };
+
+            struct ModelStatistics
+            {
+                size_t completed = 0;
+                size_t rejected = 0;
+                /// Wall time of the completed requests times their intra-op width
+                double core_seconds = 0;
+            };
+
+            /// \brief Thrown by CPUScheduler::submit when admission control rejects a request
+            class CPU_BACKEND_API SchedulerRejected : public ngraph_error
+            {
+            public:
+                explicit SchedulerRejected(const std::string& what_arg)
+                    : ngraph_error(what_arg)
+                {
+                }
+            };
+
+            /// \brief Runs requests for many CPU executables on a shared set of cores.
+            ///
+            /// Each model has its own queue. The next request comes from the highest priority
+            /// model with queued work and, among models of equal priority, from the one that
+            /// has used the least core time relative to its weight. Every request is started
+            /// with an intra-op width of the free cores divided by the number of runnable
+            /// requests, clamped to [min_width, max_width]: a lone request gets the whole
+            /// machine and a busy server runs many narrow requests instead of oversubscribing
+            /// the cores. The width is applied to the OpenMP parallel regions and the Eigen
+            /// kernels of the call, see executor::PartitionScope.
+            class CPU_BACKEND_API CPUScheduler
+            {
+            public:
+                using ModelId = size_t;
+
+                explicit CPUScheduler(const SchedulerOptions& options = SchedulerOptions());
+                /// \brief Waits for the running requests. Requests still queued fail with
+                ///        ngraph_error.
+                ~CPUScheduler();
+
+                ModelId add_model(const std::shared_ptr<Executable>& executable,
+                                  const ModelOptions& options = ModelOptions());
+
+                /// \brief Queues a call of the model's executable.
+                /// \returns A future that becomes ready when the call has completed and holds
+                ///          any exception the call threw
+                /// \throws SchedulerRejected if a queue limit is reached
+                std::future<void> submit(ModelId model,
+                                         const std::vector<std::shared_ptr<Tensor>>& outputs,
+                                         const std::vector<std::shared_ptr<Tensor>>& inputs);
+
+                /// \brief Stops starting queued requests. Running requests complete and new
+                ///        requests are still queued.
+                void pause();
+                void resume();
+
+                size_t get_queued() const;
+                size_t get_running() const;
+                int get_num_cores() const { return m_num_cores; }
+                ModelStatistics get_statistics(ModelId model) const;
+
+            private:
+                struct Request
+                {
+                    std::vector<std::shared_ptr<Tensor>> outputs;
+                    std::vector<std::shared_ptr<Tensor>> inputs;
+                    std::promise<void> promise;
+                };
+
+                struct Model
+                {
+                    std::shared_ptr<Executable> executable;
+                    ModelOptions options;
+                    std::deque<Request> queue;
+                    size_t running = 0;
+                    /// Core seconds divided by weight, compared between models of the same
+                    /// priority
+                    double virtual_time = 0;
+                    ModelStatistics statistics;
+                };
+
+                bool is_runnable(const Model& model) const;
+                /// Model of the next request to start, or nullptr if none can start now
+                Model* select_model();
+                void worker_loop();
+
+                int m_num_cores;
+                int m_min_width;
+                int m_max_width;
+                size_t m_max_queued;
+
+                mutable std::mutex m_mutex;
+                std::condition_variable m_cv;
+                std::vector<std::unique_ptr<Model>> m_models;
+                size_t m_queued = 0;
+                size_t m_running = 0;
+                int m_free_cores;
+                bool m_paused = false;
+                bool m_stop = false;
+                std::vector<std::thread> m_workers;
+            };
+        }
+    }
+}
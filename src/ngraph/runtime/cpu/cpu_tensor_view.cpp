@@ -36,8 +36,10 @@ using namespace std;
 
 runtime::cpu::CPUTensorView::CPUTensorView(const ngraph::element::Type& element_type,
                                            const Shape& shape,
-                                           void* memory_pointer)
+                                           void* memory_pointer,
+                                           Allocator* allocator)
     : runtime::Tensor(std::make_shared<ngraph::descriptor::Tensor>(element_type, shape, ""))
+    , m_allocator(allocator)
     , buffer(nullptr)
     , aligned_buffer(nullptr)
 {
@@ -56,7 +58,8 @@ runtime::cpu::CPUTensorView::CPUTensorView(const ngraph::element::Type& element_
     else if (buffer_size > 0)
     {
         size_t allocation_size = buffer_size + BufferAlignment;
-        auto ptr = ngraph_malloc(allocation_size);
+        auto ptr = m_allocator ? m_allocator->malloc(allocation_size, BufferAlignment)
+                               : ngraph_malloc(allocation_size);
         buffer = static_cast<char*>(ptr);
 
 // GCC major versions below 5 do not implement C++11 std::align
@@ -80,7 +83,14 @@ runtime::cpu::CPUTensorView::CPUTensorView(const ngraph::element::Type& element_
 
 runtime::cpu::CPUTensorView::~CPUTensorView()
 {
-    ngraph_free(buffer);
+    if (m_allocator)
+    {
+        m_allocator->free(buffer);
+    }
+    else
+    {
+        ngraph_free(buffer);
+    }
 }
 
 char* runtime::cpu::CPUTensorView::get_data_ptr()
@@ -18,6 +18,7 @@
 
 #include <string>
 
+#include "ngraph/runtime/allocator.hpp"
 #include "ngraph/runtime/cpu/cpu_backend_visibility.h"
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -38,7 +39,8 @@ namespace ngraph
                                               const Shape& shape);
                 CPU_BACKEND_API CPUTensorView(const ngraph::element::Type& element_type,
                                               const Shape& shape,
-                                              void* memory_pointer);
+                                              void* memory_pointer,
+                                              Allocator* allocator = nullptr);
                 CPU_BACKEND_API virtual ~CPUTensorView() override;
 
                 CPU_BACKEND_API char* get_data_ptr();
@@ -65,6 +67,7 @@ namespace ngraph
                 CPUTensorView(CPUTensorView&&) = delete;
                 CPUTensorView& operator=(const CPUTensorView&) = delete;
 
+                Allocator* m_allocator;
                 char* buffer;
                 char* aligned_buffer;
                 size_t buffer_size;
@@ -0,0 +1,445 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/ThreadPool>
+
+#include "cpu_threading_runtime.hpp"
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/util.hpp"
+
+#define MAX_PARALLELISM_THRESHOLD 2
+
+using namespace std;
+using namespace ngraph;
+
+static int GetNumCores()
+{
+    const auto omp_num_threads = ngraph::getenv_int("OMP_NUM_THREADS");
+    const auto ngraph_intra_op_parallelism = ngraph::getenv_int("NGRAPH_INTRA_OP_PARALLELISM");
+    int count = 0;
+
+    if (omp_num_threads > 0)
+    {
+        count = omp_num_threads;
+    }
+    else if (ngraph_intra_op_parallelism > 0)
+    {
+        count = ngraph_intra_op_parallelism;
+    }
+    else
+    {
+        count = std::thread::hardware_concurrency() / 2;
+    }
+
+    int max_parallelism_allowed = MAX_PARALLELISM_THRESHOLD * std::thread::hardware_concurrency();
+    if (count > max_parallelism_allowed)
+    {
+        throw ngraph::ngraph_error(
+            "OMP_NUM_THREADS and/or NGRAPH_INTRA_OP_PARALLELISM is too high: "
+            "(" +
+            std::to_string(count) + "). Please specify a value in range [1-" +
+            std::to_string(max_parallelism_allowed) + "]");
+    }
+
+    return count < 1 ? 1 : count;
+}
+
+namespace
+{
+    // Eigen thread environment that restricts every thread it creates to a set of cores
+    // before running the worker loop. With pin_each set, threads are pinned round-robin to a
+    // single core of the set instead.
+    struct PinningThreadEnvironment : public Eigen::StlThreadEnvironment
+    {
+        PinningThreadEnvironment() = default;
+        PinningThreadEnvironment(const vector<int>& cpus, bool pin_each)
+            : m_cpus(cpus)
+            , m_pin_each(pin_each)
+            , m_next(make_shared<atomic<size_t>>(0))
+        {
+        }
+
+        EnvThread* CreateThread(function<void()> f)
+        {
+            if (m_cpus.empty())
+            {
+                return new EnvThread(move(f));
+            }
+            vector<int> cpus = m_cpus;
+            if (m_pin_each)
+            {
+                cpus = vector<int>{m_cpus[(*m_next)++ % m_cpus.size()]};
+            }
+            return new EnvThread([f, cpus]() {
+                runtime::cpu::executor::set_current_thread_affinity(cpus);
+                f();
+            });
+        }
+
+        vector<int> m_cpus;
+        bool m_pin_each = false;
+        shared_ptr<atomic<size_t>> m_next;
+    };
+}
+
+class runtime::cpu::executor::DefaultThreadingRuntime::Impl
+{
+public:
+    Impl(int num_threads, const vector<int>& cpus, bool pin_each)
+        : m_pool(num_threads, PinningThreadEnvironment(cpus, pin_each))
+    {
+    }
+
+    Eigen::ThreadPoolTempl<PinningThreadEnvironment> m_pool;
+};
+
+runtime::cpu::executor::ThreadingOptions runtime::cpu::executor::get_threading_options_from_env()
+{
+    ThreadingOptions options;
+    options.pin_threads = getenv_bool("NGRAPH_CPU_PIN_THREADS");
+    options.numa_node = getenv_int("NGRAPH_CPU_NUMA_NODE", -1);
+    options.thread_budget = getenv_int("NGRAPH_CPU_THREAD_BUDGET", 0);
+    return options;
+}
+
+int runtime::cpu::executor::ThreadingRuntime::get_num_openmp_threads() const
+{
+#if defined(_OPENMP)
+    return omp_get_max_threads();
+#else
+    return get_num_threads();
+#endif
+}
+
+runtime::cpu::executor::DefaultThreadingRuntime::DefaultThreadingRuntime(
+    const ThreadingOptions& options)
+    : m_pin_threads(options.pin_threads)
+    , m_numa_node(options.numa_node)
+{
+    if (options.numa_node >= 0)
+    {
+        m_cpus = get_numa_node_cpus(options.numa_node);
+        if (m_cpus.empty())
+        {
+            throw ngraph_error("NUMA node " + to_string(options.numa_node) +
+                               " does not exist or has no cores");
+        }
+    }
+    else
+    {
+        for (unsigned i = 0; i < std::thread::hardware_concurrency(); i++)
+        {
+            m_cpus.push_back(static_cast<int>(i));
+        }
+    }
+
+    int num_threads = options.num_threads > 0 ? options.num_threads : GetNumCores();
+    if (options.numa_node >= 0 && options.num_threads <= 0)
+    {
+        num_threads = std::min(num_threads, static_cast<int>(m_cpus.size()));
+    }
+
+    // Threads are left to the OS scheduler unless they are pinned or confined to a node.
+    vector<int> affinity;
+    if (m_pin_threads || options.numa_node >= 0)
+    {
+        affinity = m_cpus;
+    }
+    m_impl.reset(new Impl(num_threads, affinity, m_pin_threads));
+
+    // The OpenMP team is only resized for an explicit budget; otherwise it keeps the size the
+    // application or OMP_NUM_THREADS gave it, within the cores of the NUMA node if there is one
+    m_resize_openmp = options.thread_budget > 0;
+    if (m_resize_openmp)
+    {
+        m_num_openmp_threads = std::max(options.thread_budget - num_threads, 1);
+    }
+    else
+    {
+        m_num_openmp_threads = ThreadingRuntime::get_num_openmp_threads();
+        if (options.numa_node >= 0)
+        {
+            m_num_openmp_threads =
+                std::min(m_num_openmp_threads, static_cast<int>(m_cpus.size()));
+        }
+    }
+}
+
+runtime::cpu::executor::DefaultThreadingRuntime::~DefaultThreadingRuntime()
+{
+}
+
+int runtime::cpu::executor::DefaultThreadingRuntime::get_num_threads() const
+{
+    return m_impl->m_pool.NumThreads();
+}
+
+void runtime::cpu::executor::DefaultThreadingRuntime::schedule(function<void()> fn)
+{
+    m_impl->m_pool.Schedule(move(fn));
+}
+
+int runtime::cpu::executor::DefaultThreadingRuntime::get_current_thread_id() const
+{
+    return m_impl->m_pool.CurrentThreadId();
+}
+
+int runtime::cpu::executor::DefaultThreadingRuntime::get_num_openmp_threads() const
+{
+    return m_num_openmp_threads;
+}
+
+void runtime::cpu::executor::DefaultThreadingRuntime::configure_openmp()
+{
+#if defined(_OPENMP)
+    if (m_resize_openmp)
+    {
+        omp_set_num_threads(m_num_openmp_threads);
+    }
+    if (m_pin_threads || m_numa_node >= 0)
+    {
+        // OpenMP runtimes keep their worker threads alive between parallel regions, so
+        // binding them once here holds for all later MKLDNN primitives. The calling thread
+        // is the master of the region and belongs to the application, so its own affinity is
+        // restored afterwards. Pinned OpenMP threads take the cores after the workers' ones.
+        const vector<int>& cpus = m_cpus;
+        bool pin_each = m_pin_threads;
+        int first = get_num_threads();
+        vector<int> caller_cpus = get_current_thread_affinity();
+#pragma omp parallel
+        {
+            if (pin_each)
+            {
+                set_current_thread_affinity(
+                    {cpus[(first + omp_get_thread_num()) % cpus.size()]});
+            }
+            else
+            {
+                set_current_thread_affinity(cpus);
+            }
+        }
+        if (!caller_cpus.empty())
+        {
+            set_current_thread_affinity(caller_cpus);
+        }
+    }
+#endif
+}
+
+runtime::cpu::executor::AffinityScope::AffinityScope(const vector<int>& cpus, int num_threads)
+    : m_caller_cpus(get_current_thread_affinity())
+{
+    set_current_thread_affinity(cpus);
+#if defined(_OPENMP)
+    m_caller_openmp_threads = omp_get_max_threads();
+    omp_set_num_threads(num_threads);
+    // The OpenMP team of a thread is kept alive between parallel regions, so it only has to
+    // be moved when this thread last bound it to other cores.
+    thread_local vector<int> t_team_cpus;
+    if (t_team_cpus != cpus)
+    {
+#pragma omp parallel
+        {
+            set_current_thread_affinity(cpus);
+        }
+        t_team_cpus = cpus;
+    }
+#else
+    (void)num_threads;
+#endif
+}
+
+runtime::cpu::executor::AffinityScope::~AffinityScope()
+{
+#if defined(_OPENMP)
+    omp_set_num_threads(m_caller_openmp_threads);
+#endif
+    if (!m_caller_cpus.empty())
+    {
+        set_current_thread_affinity(m_caller_cpus);
+    }
+}
+
+static mutex s_runtime_mutex;
+static shared_ptr<runtime::cpu::executor::ThreadingRuntime> s_runtime;
+static bool s_runtime_in_use = false;
+// Whether s_runtime came from set_threading_runtime rather than from the environment
+static bool s_runtime_installed = false;
+
+void runtime::cpu::executor::set_threading_runtime(const shared_ptr<ThreadingRuntime>& runtime)
+{
+    lock_guard<mutex> lock(s_runtime_mutex);
+    if (s_runtime_in_use)
+    {
+        throw ngraph_error(
+            "The CPU threading runtime must be set before the CPU backend starts executing");
+    }
+    s_runtime = runtime;
+    s_runtime_installed = runtime != nullptr;
+}
+
+shared_ptr<runtime::cpu::executor::ThreadingRuntime>
+    runtime::cpu::executor::get_threading_runtime()
+{
+    lock_guard<mutex> lock(s_runtime_mutex);
+    if (!s_runtime)
+    {
+        s_runtime = make_shared<DefaultThreadingRuntime>(get_threading_options_from_env());
+    }
+    s_runtime_in_use = true;
+    return s_runtime;
+}
+
+vector<shared_ptr<runtime::cpu::executor::ThreadingRuntime>>
+    runtime::cpu::executor::get_numa_threading_runtimes(const vector<int>& numa_nodes)
+{
+    lock_guard<mutex> lock(s_runtime_mutex);
+    vector<shared_ptr<ThreadingRuntime>> runtimes;
+    if (s_runtime_installed)
+    {
+        return runtimes;
+    }
+    for (int numa_node : numa_nodes)
+    {
+        auto options = get_threading_options_from_env();
+        options.numa_node = numa_node;
+        runtimes.push_back(make_shared<DefaultThreadingRuntime>(options));
+    }
+    if (!s_runtime && !runtimes.empty())
+    {
+        s_runtime = runtimes.front();
+    }
+    s_runtime_in_use = true;
+    return runtimes;
+}
+
+// Parses sysfs lists of the form "0-3,8-11"
+static vector<int> read_sysfs_list(const string& path)
+{
+    vector<int> values;
+    ifstream list_file(path);
+    string line;
+    if (!list_file || !getline(list_file, line))
+    {
+        return values;
+    }
+    for (const string& range : split(line, ',', false))
+    {
+        auto bounds = split(range, '-', false);
+        if (bounds.empty())
+        {
+            continue;
+        }
+        int first = stoi(bounds[0]);
+        int last = bounds.size() > 1 ? stoi(bounds[1]) : first;
+        for (int value = first; value <= last; value++)
+        {
+            values.push_back(value);
+        }
+    }
+    return values;
+}
+
+vector<int> runtime::cpu::executor::get_numa_nodes()
+{
+    return read_sysfs_list("/sys/devices/system/node/online");
+}
+
+vector<int> runtime::cpu::executor::get_numa_node_cpus(int numa_node)
+{
+    return read_sysfs_list("/sys/devices/system/node/node" + to_string(numa_node) + "/cpulist");
+}
+
+int runtime::cpu::executor::get_current_numa_node()
+{
+#if defined(__linux__)
+    static const vector<int> s_cpu_to_node = []() {
+        vector<int> cpu_to_node;
+        for (int node : get_numa_nodes())
+        {
+            for (int cpu : get_numa_node_cpus(node))
+            {
+                if (cpu >= static_cast<int>(cpu_to_node.size()))
+                {
+                    cpu_to_node.resize(cpu + 1, -1);
+                }
+                cpu_to_node[cpu] = node;
+            }
+        }
+        return cpu_to_node;
+    }();
+    int cpu = sched_getcpu();
+    if (cpu >= 0 && cpu < static_cast<int>(s_cpu_to_node.size()))
+    {
+        return s_cpu_to_node[cpu];
+    }
+#endif
+    return -1;
+}
+
+vector<int> runtime::cpu::executor::get_current_thread_affinity()
+{
+    vector<int> cpus;
+#if defined(__linux__)
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0)
+    {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        {
+            if (CPU_ISSET(cpu, &cpu_set))
+            {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    return cpus;
+}
+
+bool runtime::cpu::executor::set_current_thread_affinity(const vector<int>& cpus)
+{
+#if defined(__linux__)
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu : cpus)
+    {
+        CPU_SET(cpu, &cpu_set);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+#else
+    (void)cpus;
+    return false;
+#endif
+}
@@ -0,0 +1,172 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace executor
+            {
+                /// \brief Options for the default threading runtime.
+                struct ThreadingOptions
+                {
+                    /// Number of intra-op worker threads. 0 selects the value derived from
+                    /// OMP_NUM_THREADS or NGRAPH_INTRA_OP_PARALLELISM.
+                    int num_threads = 0;
+                    /// Pin every worker thread (including OpenMP threads used by MKLDNN) to a
+                    /// single core.
+                    bool pin_threads = false;
+                    /// Restrict worker threads to the cores of this NUMA node; -1 places no
+                    /// restriction.
+                    int numa_node = -1;
+                    /// Threads the workers and the OpenMP team may run together. OpenMP gets
+                    /// what the workers leave of it, and at least one thread. 0 leaves the
+                    /// OpenMP team at the size the application or OMP_NUM_THREADS gave it.
+                    int thread_budget = 0;
+                };
+
+                /// \brief Reads ThreadingOptions from NGRAPH_CPU_PIN_THREADS,
+                ///        NGRAPH_CPU_NUMA_NODE and NGRAPH_CPU_THREAD_BUDGET.
+                CPU_BACKEND_API ThreadingOptions get_threading_options_from_env();
+
+                /// \brief Intra-op threading runtime shared by the CPU kernels, the Eigen
+                ///        thread pool devices and MKLDNN.
+                ///
+                /// An embedding application may implement this interface on top of its own
+                /// thread pool and install it with \sa set_threading_runtime so that nGraph
+                /// does not create any worker threads of its own.
+                class CPU_BACKEND_API ThreadingRuntime
+                {
+                public:
+                    virtual ~ThreadingRuntime() {}
+                    /// \brief Number of worker threads intra-op kernels may use.
+                    virtual int get_num_threads() const = 0;
+                    /// \brief Runs fn asynchronously on one of the worker threads.
+                    virtual void schedule(std::function<void()> fn) = 0;
+                    /// \brief Index in [0, get_num_threads()) of the calling worker thread, or
+                    ///        -1 if called from a thread that is not owned by the runtime.
+                    virtual int get_current_thread_id() const = 0;
+                    /// \brief Width of the OpenMP team used by MKLDNN and the OpenMP kernels.
+                    ///
+                    /// OpenMP threads are distinct from the runtime's workers. The default
+                    /// returns the current size of the OpenMP team; a runtime that knows how
+                    /// many cores it shares may return what its workers leave of them, so both
+                    /// never run more threads than there are cores.
+                    virtual int get_num_openmp_threads() const;
+                    /// \brief Configures the OpenMP runtime used by MKLDNN and Eigen's
+                    ///        OpenMP-parallel kernels. The default leaves it alone.
+                    virtual void configure_openmp() {}
+                };
+
+                /// \brief Threading runtime backed by an Eigen thread pool, optionally pinned
+                ///        to the cores of one NUMA node.
+                class CPU_BACKEND_API DefaultThreadingRuntime : public ThreadingRuntime
+                {
+                public:
+                    explicit DefaultThreadingRuntime(const ThreadingOptions& options);
+                    ~DefaultThreadingRuntime() override;
+
+                    int get_num_threads() const override;
+                    void schedule(std::function<void()> fn) override;
+                    int get_current_thread_id() const override;
+                    /// \brief The thread budget minus the workers, at least one. Without a
+                    ///        budget, the OpenMP team size found at construction.
+                    int get_num_openmp_threads() const override;
+                    void configure_openmp() override;
+
+                    /// \brief Cores the worker threads may run on.
+                    const std::vector<int>& get_cpus() const { return m_cpus; }
+                private:
+                    class Impl;
+                    std::unique_ptr<Impl> m_impl;
+                    std::vector<int> m_cpus;
+                    bool m_pin_threads;
+                    int m_numa_node;
+                    int m_num_openmp_threads;
+                    // Whether configure_openmp resizes the OpenMP team to the thread budget
+                    bool m_resize_openmp;
+                };
+
+                /// \brief Confines the calling thread to a set of cores while in scope.
+                ///
+                /// OpenMP regions started by the thread in the meantime run num_threads wide
+                /// on the same cores. The caller's affinity and OpenMP width are restored
+                /// when the scope ends.
+                class CPU_BACKEND_API AffinityScope
+                {
+                public:
+                    AffinityScope(const std::vector<int>& cpus, int num_threads);
+                    ~AffinityScope();
+
+                    AffinityScope(const AffinityScope&) = delete;
+                    AffinityScope& operator=(const AffinityScope&) = delete;
+
+                private:
+                    std::vector<int> m_caller_cpus;
+                    int m_caller_openmp_threads = 0;
+                };
+
+                /// \brief Installs the threading runtime used by the CPU backend. Must be
+                ///        called before the first CPU executable is compiled.
+                CPU_BACKEND_API void
+                    set_threading_runtime(const std::shared_ptr<ThreadingRuntime>& runtime);
+
+                /// \brief Returns the installed threading runtime, creating a
+                ///        DefaultThreadingRuntime from the environment if none was installed.
+                CPU_BACKEND_API std::shared_ptr<ThreadingRuntime> get_threading_runtime();
+
+                /// \brief Creates one DefaultThreadingRuntime per NUMA node, confined to that
+                ///        node, for the NUMA-aware executor.
+                ///
+                /// Like get_threading_runtime, this locks the runtime in. It returns an empty
+                /// vector if the application installed its own runtime, which then has to be
+                /// used instead.
+                CPU_BACKEND_API std::vector<std::shared_ptr<ThreadingRuntime>>
+                    get_numa_threading_runtimes(const std::vector<int>& numa_nodes);
+
+                /// \brief Online NUMA nodes, read from sysfs. Empty if the topology cannot be
+                ///        read.
+                CPU_BACKEND_API std::vector<int> get_numa_nodes();
+
+                /// \brief Cores belonging to a NUMA node, read from sysfs. Empty if the node
+                ///        does not exist or the topology cannot be read.
+                CPU_BACKEND_API std::vector<int> get_numa_node_cpus(int numa_node);
+
+                /// \brief NUMA node of the core the calling thread is running on, or -1 if it
+                ///        cannot be determined.
+                CPU_BACKEND_API int get_current_numa_node();
+
+                /// \brief Cores the calling thread may run on. Empty if the platform does not
+                ///        support affinity or the call failed.
+                CPU_BACKEND_API std::vector<int> get_current_thread_affinity();
+
+                /// \brief Restricts the calling thread to the given cores. Returns false if the
+                ///        platform does not support it or the call failed.
+                CPU_BACKEND_API bool set_current_thread_affinity(const std::vector<int>& cpus);
+            }
+        }
+    }
+}
@@ -0,0 +1,102 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// Activations keep 7 bits. Without AVX512-VNNI the u8 x s8 kernels of MKLDNN
+                /// add pairs of products in saturating int16 (vpmaddubsw), which 2 * 127 * 127
+                /// fits but 2 * 255 * 127 does not.
+                constexpr int32_t dynamic_quantize_max = 63;
+                /// Zero point of the u8 values written by dynamic_quantize
+                constexpr int32_t dynamic_quantize_zero_point = 64;
+
+                /// Finds max |x| of the input and quantizes it symmetrically in the same call:
+                /// q = round(x / scale) + 64 with scale = max |x| / 63, so q is in [1, 127].
+                /// The scale is written to *scale.
+                inline void dynamic_quantize(const float* input,
+                                             uint8_t* output,
+                                             float* scale,
+                                             size_t count)
+                {
+                    const float q_max = static_cast<float>(dynamic_quantize_max);
+                    float max_abs = 0;
+#ifdef _OPENMP
+#pragma omp parallel for simd reduction(max : max_abs)
+#endif
+                    for (int64_t i = 0; i < static_cast<int64_t>(count); i++)
+                    {
+                        max_abs = std::max(max_abs, std::fabs(input[i]));
+                    }
+                    float s = max_abs > 0 ? max_abs / q_max : 1.0f;
+                    float inverse = 1.0f / s;
+#ifdef _OPENMP
+#pragma omp parallel for simd
+#endif
+                    for (int64_t i = 0; i < static_cast<int64_t>(count); i++)
+                    {
+                        float q = std::min(q_max, std::max(-q_max, input[i] * inverse));
+                        output[i] = static_cast<uint8_t>(static_cast<int32_t>(std::nearbyint(q)) +
+                                                         dynamic_quantize_zero_point);
+                    }
+                    *scale = s;
+                }
+
+                /// Converts the i32 result of a u8 x i8 matmul of dynamic_quantize output back
+                /// to f32: out[r, c] = (acc[r, c] - compensation[c]) * input_scale *
+                /// weight_scales[c], where compensation[c] is 64 times the sum of the quantized
+                /// weights of output channel c.
+                inline void dynamic_dequantize(const int32_t* acc,
+                                               const float* input_scale,
+                                               const int32_t* compensation,
+                                               const float* weight_scales,
+                                               float* out,
+                                               size_t rows,
+                                               size_t cols)
+                {
+                    const float s = *input_scale;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                    for (int64_t r = 0; r < static_cast<int64_t>(rows); r++)
+                    {
+                        const int32_t* acc_row = acc + r * cols;
+                        float* out_row = out + r * cols;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                        for (size_t c = 0; c < cols; c++)
+                        {
+                            out_row[c] = static_cast<float>(acc_row[c] - compensation[c]) *
+                                         (s * weight_scales[c]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
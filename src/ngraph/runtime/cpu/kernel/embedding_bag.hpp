@@ -0,0 +1,203 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "ngraph/op/embedding_bag.hpp"
+#include "ngraph/runtime/reference/embedding_bag.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Embedding rows are scattered across a table much larger than the caches;
+                // fetching the next row while the current one is accumulated hides most of the
+                // miss latency
+                template <typename T>
+                inline void prefetch_embedding_row(const T* row, size_t embedding_dim)
+                {
+#if defined(__GNUC__)
+                    const size_t line = 64 / sizeof(T);
+                    for (size_t d = 0; d < embedding_dim; d += line)
+                    {
+                        __builtin_prefetch(row + d);
+                    }
+#else
+                    (void)row;
+                    (void)embedding_dim;
+#endif
+                }
+
+                /// Pools every bag straight into its output row, in parallel over bags.
+                template <typename T, typename U>
+                void embedding_bag(const T* weights,
+                                   const U* indices,
+                                   const U* offsets,
+                                   const T* per_sample_weights,
+                                   T* out,
+                                   size_t num_embeddings,
+                                   size_t embedding_dim,
+                                   size_t indices_count,
+                                   size_t bags,
+                                   op::EmbeddingBag::Reduction reduction)
+                {
+                    // Checked up front, since exceptions must not leave the parallel region
+                    reference::check_embedding_bag_indices(indices, indices_count, num_embeddings);
+                    reference::check_embedding_bag_offsets(offsets, bags);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+                    for (int64_t b = 0; b < static_cast<int64_t>(bags); b++)
+                    {
+                        size_t begin, end;
+                        reference::embedding_bag_range(offsets, b, bags, indices_count, begin, end);
+                        T* y = out + b * embedding_dim;
+                        if (begin == end)
+                        {
+                            std::fill(y, y + embedding_dim, T(0));
+                            continue;
+                        }
+
+                        const T* first =
+                            weights + static_cast<size_t>(indices[begin]) * embedding_dim;
+                        T first_scale = per_sample_weights ? per_sample_weights[begin] : T(1);
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                        for (size_t d = 0; d < embedding_dim; d++)
+                        {
+                            y[d] = reduction == op::EmbeddingBag::Reduction::MAX
+                                       ? first[d]
+                                       : first_scale * first[d];
+                        }
+
+                        for (size_t i = begin + 1; i < end; i++)
+                        {
+                            if (i + 1 < end)
+                            {
+                                prefetch_embedding_row(
+                                    weights + static_cast<size_t>(indices[i + 1]) * embedding_dim,
+                                    embedding_dim);
+                            }
+                            const T* x = weights + static_cast<size_t>(indices[i]) * embedding_dim;
+                            if (reduction == op::EmbeddingBag::Reduction::MAX)
+                            {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                                for (size_t d = 0; d < embedding_dim; d++)
+                                {
+                                    y[d] = std::max(y[d], x[d]);
+                                }
+                            }
+                            else
+                            {
+                                T scale = per_sample_weights ? per_sample_weights[i] : T(1);
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                                for (size_t d = 0; d < embedding_dim; d++)
+                                {
+                                    y[d] += scale * x[d];
+                                }
+                            }
+                        }
+
+                        if (reduction == op::EmbeddingBag::Reduction::MEAN)
+                        {
+                            T scale = T(1) / static_cast<T>(end - begin);
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                            for (size_t d = 0; d < embedding_dim; d++)
+                            {
+                                y[d] *= scale;
+                            }
+                        }
+                    }
+                }
+
+                /// Parallel version of reference::embedding_bag_backprop. Every bag writes only
+                /// the gradient rows of its own indices, which the offsets check keeps apart, so
+                /// bags are independent.
+                template <typename T, typename U>
+                void embedding_bag_backprop(const T* weights,
+                                            const U* indices,
+                                            const U* offsets,
+                                            const T* delta,
+                                            const T* per_sample_weights,
+                                            T* d_rows,
+                                            T* d_per_sample_weights,
+                                            size_t num_embeddings,
+                                            size_t embedding_dim,
+                                            size_t indices_count,
+                                            size_t bags,
+                                            op::EmbeddingBag::Reduction reduction)
+                {
+                    // Checked up front, since exceptions must not leave the parallel region
+                    reference::check_embedding_bag_indices(indices, indices_count, num_embeddings);
+                    reference::check_embedding_bag_offsets(offsets, bags);
+                    if (bags == 0)
+                    {
+                        std::fill(d_rows, d_rows + indices_count * embedding_dim, T(0));
+                        return;
+                    }
+                    // Indices before the first bag get no gradient
+                    size_t first_begin, first_end;
+                    reference::embedding_bag_range(
+                        offsets, 0, bags, indices_count, first_begin, first_end);
+                    std::fill(d_rows, d_rows + first_begin * embedding_dim, T(0));
+                    if (d_per_sample_weights)
+                    {
+                        std::fill(d_per_sample_weights, d_per_sample_weights + first_begin, T(0));
+                    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+                    for (int64_t b = 0; b < static_cast<int64_t>(bags); b++)
+                    {
+                        size_t begin, end;
+                        reference::embedding_bag_range(offsets, b, bags, indices_count, begin, end);
+                        // Each bag goes through the reference on its own slice of indices, which
+                        // keeps the MAX tie rule in one place
+                        U bag_offset = 0;
+                        reference::embedding_bag_backprop<T, U>(
+                            weights,
+                            indices + begin,
+                            &bag_offset,
+                            delta + b * embedding_dim,
+                            per_sample_weights ? per_sample_weights + begin : nullptr,
+                            d_rows + begin * embedding_dim,
+                            d_per_sample_weights ? d_per_sample_weights + begin : nullptr,
+                            num_embeddings,
+                            embedding_dim,
+                            end - begin,
+                            1,
+                            reduction);
+                    }
+                }
+            }
+        }
+    }
+}
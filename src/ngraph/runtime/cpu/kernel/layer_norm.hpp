@@ -0,0 +1,230 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Mean and variance of a contiguous row in a single pass. The sums are taken
+                // relative to the first element so that rows with a large mean do not lose the
+                // variance to cancellation.
+                template <typename T>
+                void layer_norm_row_stats(const T* row, size_t cols, T& mean, T& variance)
+                {
+                    const T shift = row[0];
+                    T sum = 0;
+                    T sum_sq = 0;
+#ifdef _OPENMP
+#pragma omp simd reduction(+ : sum, sum_sq)
+#endif
+                    for (size_t c = 0; c < cols; c++)
+                    {
+                        T d = row[c] - shift;
+                        sum += d;
+                        sum_sq += d * d;
+                    }
+                    T m = sum / static_cast<T>(cols);
+                    mean = shift + m;
+                    variance = std::max(sum_sq / static_cast<T>(cols) - m * m, static_cast<T>(0));
+                }
+
+                /// Normalizes each of the `rows` contiguous rows of `data` to zero mean and unit
+                /// variance and applies the optional per-column `scale` and `bias`. `mean` and
+                /// `variance`, when not null, receive the statistics of every row.
+                template <typename T>
+                void layer_norm(const T* data,
+                                const T* scale,
+                                const T* bias,
+                                T* out,
+                                T* mean,
+                                T* variance,
+                                size_t rows,
+                                size_t cols,
+                                double epsilon)
+                {
+                    if (cols == 0)
+                    {
+                        return;
+                    }
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                    for (int64_t r = 0; r < static_cast<int64_t>(rows); r++)
+                    {
+                        const T* x = data + r * cols;
+                        T* y = out + r * cols;
+
+                        T row_mean;
+                        T row_var;
+                        layer_norm_row_stats(x, cols, row_mean, row_var);
+                        T rstd = static_cast<T>(1) / std::sqrt(row_var + static_cast<T>(epsilon));
+
+                        if (scale != nullptr)
+                        {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                            for (size_t c = 0; c < cols; c++)
+                            {
+                                y[c] = (x[c] - row_mean) * rstd * scale[c] + bias[c];
+                            }
+                        }
+                        else
+                        {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                            for (size_t c = 0; c < cols; c++)
+                            {
+                                y[c] = (x[c] - row_mean) * rstd;
+                            }
+                        }
+
+                        if (mean != nullptr)
+                        {
+                            mean[r] = row_mean;
+                        }
+                        if (variance != nullptr)
+                        {
+                            variance[r] = row_var;
+                        }
+                    }
+                }
+
+                /// Gradients of layer_norm. `mean` and `variance` may be null, in which case the
+                /// statistics are recomputed from `data`. `d_scale` and `d_bias` are only
+                /// written when `scale` is not null.
+                template <typename T>
+                void layer_norm_backprop(const T* data,
+                                         const T* delta,
+                                         const T* mean,
+                                         const T* variance,
+                                         const T* scale,
+                                         T* d_data,
+                                         T* d_scale,
+                                         T* d_bias,
+                                         size_t rows,
+                                         size_t cols,
+                                         double epsilon)
+                {
+                    if (cols == 0)
+                    {
+                        return;
+                    }
+                    std::vector<T> row_mean(rows);
+                    std::vector<T> row_rstd(rows);
+                    const T inv_cols = static_cast<T>(1) / static_cast<T>(cols);
+
+                    // d_data = rstd * (g - mean(g) - xhat * mean(g * xhat)), g = delta * scale
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                    for (int64_t r = 0; r < static_cast<int64_t>(rows); r++)
+                    {
+                        const T* x = data + r * cols;
+                        const T* dy = delta + r * cols;
+                        T* dx = d_data + r * cols;
+
+                        T m;
+                        T var;
+                        if (mean != nullptr)
+                        {
+                            m = mean[r];
+                            var = variance[r];
+                        }
+                        else
+                        {
+                            layer_norm_row_stats(x, cols, m, var);
+                        }
+                        T rstd = static_cast<T>(1) / std::sqrt(var + static_cast<T>(epsilon));
+                        row_mean[r] = m;
+                        row_rstd[r] = rstd;
+
+                        T sum_g = 0;
+                        T sum_g_xhat = 0;
+#ifdef _OPENMP
+#pragma omp simd reduction(+ : sum_g, sum_g_xhat)
+#endif
+                        for (size_t c = 0; c < cols; c++)
+                        {
+                            T g = scale != nullptr ? dy[c] * scale[c] : dy[c];
+                            sum_g += g;
+                            sum_g_xhat += g * (x[c] - m) * rstd;
+                        }
+                        T mean_g = sum_g * inv_cols;
+                        T mean_g_xhat = sum_g_xhat * inv_cols;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                        for (size_t c = 0; c < cols; c++)
+                        {
+                            T g = scale != nullptr ? dy[c] * scale[c] : dy[c];
+                            T xhat = (x[c] - m) * rstd;
+                            dx[c] = rstd * (g - mean_g - xhat * mean_g_xhat);
+                        }
+                    }
+
+                    if (scale == nullptr)
+                    {
+                        return;
+                    }
+
+                    // The affine gradients reduce over rows. Splitting the columns into blocks
+                    // lets every thread own its slice of d_scale and d_bias without atomics.
+                    const size_t block = 64;
+                    const int64_t blocks = static_cast<int64_t>((cols + block - 1) / block);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                    for (int64_t b = 0; b < blocks; b++)
+                    {
+                        size_t begin = b * block;
+                        size_t end = std::min(begin + block, cols);
+                        std::fill(d_scale + begin, d_scale + end, static_cast<T>(0));
+                        std::fill(d_bias + begin, d_bias + end, static_cast<T>(0));
+                        for (size_t r = 0; r < rows; r++)
+                        {
+                            const T* x = data + r * cols;
+                            const T* dy = delta + r * cols;
+                            T m = row_mean[r];
+                            T rstd = row_rstd[r];
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                            for (size_t c = begin; c < end; c++)
+                            {
+                                d_scale[c] += dy[c] * (x[c] - m) * rstd;
+                                d_bias[c] += dy[c];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,104 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "ngraph/runtime/cpu/kernel/reduction_groups.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// Subtracts the mean of every reduction group and, with normalize_variance,
+                /// divides by its standard deviation plus eps. Groups are processed in parallel;
+                /// the statistics take one pass over the group and the output a second one.
+                template <typename T>
+                void mvn(const T* data,
+                         T* out,
+                         const ReductionGroups& groups,
+                         bool normalize_variance,
+                         double eps)
+                {
+                    const size_t group_size = groups.get_group_size();
+                    const size_t run_length = groups.run_length;
+                    const size_t runs = groups.run_offsets.size();
+                    if (group_size == 0)
+                    {
+                        return;
+                    }
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                    for (int64_t g = 0; g < static_cast<int64_t>(groups.group_offsets.size());
+                         g++)
+                    {
+                        const T* x = data + groups.group_offsets[g];
+                        T* y = out + groups.group_offsets[g];
+
+                        // Shifted sums, see layer_norm_row_stats
+                        const T shift = x[groups.run_offsets[0]];
+                        T sum = 0;
+                        T sum_sq = 0;
+                        for (size_t run = 0; run < runs; run++)
+                        {
+                            const T* xr = x + groups.run_offsets[run];
+#ifdef _OPENMP
+#pragma omp simd reduction(+ : sum, sum_sq)
+#endif
+                            for (size_t i = 0; i < run_length; i++)
+                            {
+                                T d = xr[i] - shift;
+                                sum += d;
+                                sum_sq += d * d;
+                            }
+                        }
+                        T m = sum / static_cast<T>(group_size);
+                        T mean = shift + m;
+                        T scale = 1;
+                        if (normalize_variance)
+                        {
+                            T variance = std::max(sum_sq / static_cast<T>(group_size) - m * m,
+                                                  static_cast<T>(0));
+                            scale = static_cast<T>(1) /
+                                    (std::sqrt(variance) + static_cast<T>(eps));
+                        }
+
+                        for (size_t run = 0; run < runs; run++)
+                        {
+                            const T* xr = x + groups.run_offsets[run];
+                            T* yr = y + groups.run_offsets[run];
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                            for (size_t i = 0; i < run_length; i++)
+                            {
+                                yr[i] = (xr[i] - mean) * scale;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,86 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "ngraph/runtime/cpu/kernel/reduction_groups.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// Divides every reduction group by its L2 norm. With eps_max the squared norm is
+                /// clamped from below by eps, otherwise eps is added to it.
+                template <typename T>
+                void normalize_l2(const T* data,
+                                  T* out,
+                                  const ReductionGroups& groups,
+                                  bool eps_max,
+                                  double eps)
+                {
+                    const size_t run_length = groups.run_length;
+                    const size_t runs = groups.run_offsets.size();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                    for (int64_t g = 0; g < static_cast<int64_t>(groups.group_offsets.size());
+                         g++)
+                    {
+                        const T* x = data + groups.group_offsets[g];
+                        T* y = out + groups.group_offsets[g];
+
+                        T sum_sq = 0;
+                        for (size_t run = 0; run < runs; run++)
+                        {
+                            const T* xr = x + groups.run_offsets[run];
+#ifdef _OPENMP
+#pragma omp simd reduction(+ : sum_sq)
+#endif
+                            for (size_t i = 0; i < run_length; i++)
+                            {
+                                sum_sq += xr[i] * xr[i];
+                            }
+                        }
+                        T norm = eps_max ? std::max(sum_sq, static_cast<T>(eps))
+                                         : sum_sq + static_cast<T>(eps);
+                        T scale = static_cast<T>(1) / std::sqrt(norm);
+
+                        for (size_t run = 0; run < runs; run++)
+                        {
+                            const T* xr = x + groups.run_offsets[run];
+                            T* yr = y + groups.run_offsets[run];
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                            for (size_t i = 0; i < run_length; i++)
+                            {
+                                yr[i] = xr[i] * scale;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
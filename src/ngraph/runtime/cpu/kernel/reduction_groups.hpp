@@ -0,0 +1,99 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Element offsets of the groups a reduction over arbitrary axes of a
+                ///        row-major tensor combines.
+                ///
+                /// Each group starts at one of group_offsets. Its elements are
+                /// run_offsets.size() contiguous runs of run_length elements, placed at
+                /// run_offsets from the group start. Trailing reduction axes fold into
+                /// run_length, so the common case of reducing the innermost axes is a single
+                /// contiguous run per group.
+                struct ReductionGroups
+                {
+                    ReductionGroups(const Shape& shape, const AxisSet& reduction_axes)
+                        : run_length(1)
+                    {
+                        size_t rank = shape.size();
+                        size_t run_begin = rank;
+                        while (run_begin > 0 && reduction_axes.count(run_begin - 1) != 0)
+                        {
+                            run_length *= shape[--run_begin];
+                        }
+
+                        std::vector<size_t> kept_axes;
+                        std::vector<size_t> reduced_axes;
+                        for (size_t i = 0; i < run_begin; i++)
+                        {
+                            (reduction_axes.count(i) != 0 ? reduced_axes : kept_axes).push_back(i);
+                        }
+
+                        std::vector<size_t> strides = row_major_strides(shape);
+                        group_offsets = enumerate_offsets(shape, strides, kept_axes);
+                        run_offsets = enumerate_offsets(shape, strides, reduced_axes);
+                        if (run_length == 0)
+                        {
+                            run_offsets.clear();
+                        }
+                    }
+
+                    size_t get_group_size() const { return run_offsets.size() * run_length; }
+                    std::vector<size_t> group_offsets;
+                    std::vector<size_t> run_offsets;
+                    size_t run_length;
+
+                private:
+                    static std::vector<size_t> enumerate_offsets(const Shape& shape,
+                                                                 const std::vector<size_t>& strides,
+                                                                 const std::vector<size_t>& axes)
+                    {
+                        std::vector<size_t> offsets{0};
+                        for (size_t axis : axes)
+                        {
+                            std::vector<size_t> next;
+                            next.reserve(offsets.size() * shape[axis]);
+                            for (size_t base : offsets)
+                            {
+                                for (size_t i = 0; i < shape[axis]; i++)
+                                {
+                                    next.push_back(base + i * strides[axis]);
+                                }
+                            }
+                            offsets.swap(next);
+                        }
+                        return offsets;
+                    }
+                };
+            }
+        }
+    }
+}
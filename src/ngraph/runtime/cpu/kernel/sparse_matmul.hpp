@@ -0,0 +1,121 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Sparse matrices are stored in CSR: the non-zeros of row r are
+                // values[row_offsets[r]:row_offsets[r + 1]] in columns
+                // column_indices[row_offsets[r]:row_offsets[r + 1]].
+                //
+                // The kernels only multiply stored entries, so they do not keep the IEEE
+                // special-value propagation of a dense product: a NaN or Inf activation times a
+                // pruned weight gives 0 instead of NaN, and neither does a stored NaN or Inf
+                // weight reach the outputs of zero activations.
+
+                /// out[rows, n] = dense[rows, k] x sparse[k, n]
+                ///
+                /// Each output row accumulates the sparse rows scaled by the entries of its dense
+                /// row. Zero activations are skipped, like the zero weights that CSR drops.
+                inline void dense_sparse_matmul(const float* dense,
+                                                const float* values,
+                                                const int32_t* column_indices,
+                                                const int32_t* row_offsets,
+                                                float* out,
+                                                size_t rows,
+                                                size_t k,
+                                                size_t n)
+                {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                    for (int64_t r = 0; r < static_cast<int64_t>(rows); r++)
+                    {
+                        const float* dense_row = dense + r * k;
+                        float* out_row = out + r * n;
+                        std::memset(out_row, 0, n * sizeof(float));
+                        for (size_t i = 0; i < k; i++)
+                        {
+                            const float a = dense_row[i];
+                            if (a == 0)
+                            {
+                                continue;
+                            }
+                            // Column indices are unique within a row, so the scatter can be
+                            // vectorized
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                            for (int32_t j = row_offsets[i]; j < row_offsets[i + 1]; j++)
+                            {
+                                out_row[column_indices[j]] += a * values[j];
+                            }
+                        }
+                    }
+                }
+
+                /// out[batch, m, n] = sparse[m, k] x dense[batch, k, n]
+                ///
+                /// Used for pointwise convolutions, where n is the spatial size. The inner loop
+                /// runs over contiguous rows of the dense input.
+                inline void sparse_dense_matmul(const float* values,
+                                                const int32_t* column_indices,
+                                                const int32_t* row_offsets,
+                                                const float* dense,
+                                                float* out,
+                                                size_t batch,
+                                                size_t m,
+                                                size_t k,
+                                                size_t n)
+                {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                    for (int64_t task = 0; task < static_cast<int64_t>(batch * m); task++)
+                    {
+                        const size_t b = task / m;
+                        const size_t r = task % m;
+                        const float* dense_batch = dense + b * k * n;
+                        float* out_row = out + task * n;
+                        std::memset(out_row, 0, n * sizeof(float));
+                        for (int32_t j = row_offsets[r]; j < row_offsets[r + 1]; j++)
+                        {
+                            const float value = values[j];
+                            const float* dense_row = dense_batch + column_indices[j] * n;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                            for (size_t c = 0; c < n; c++)
+                            {
+                                out_row[c] += value * dense_row[c];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,223 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "ngraph/op/topk.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Orders TopK candidates best first: larger (or smaller) values first and the
+                // lower index first among equal values, as runtime::reference::topk does
+                template <typename T, typename U>
+                struct TopKBetter
+                {
+                    bool compute_max;
+                    bool operator()(const std::pair<T, U>& a, const std::pair<T, U>& b) const
+                    {
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+#endif
+                        if (a.first == b.first)
+                        {
+                            return a.second < b.second;
+                        }
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+                        return compute_max ? a.first > b.first : a.first < b.first;
+                    }
+                };
+
+                // Number of values that beat the threshold in x[0, count). Branch free so the
+                // compiler vectorizes it.
+                template <typename T>
+                size_t topk_count_better(const T* x, size_t count, T threshold, bool compute_max)
+                {
+                    size_t hits = 0;
+                    if (compute_max)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            hits += x[i] > threshold;
+                        }
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            hits += x[i] < threshold;
+                        }
+                    }
+                    return hits;
+                }
+
+                // Keeps the k best elements of the contiguous row x[0, n) in a heap whose front
+                // is the worst of them. Blocks that cannot beat it are skipped after a SIMD scan.
+                template <typename T, typename U>
+                void topk_heap_select(const T* x,
+                                      size_t n,
+                                      size_t k,
+                                      const TopKBetter<T, U>& better,
+                                      std::pair<T, U>* heap)
+                {
+                    for (size_t j = 0; j < k; j++)
+                    {
+                        heap[j] = std::make_pair(x[j], static_cast<U>(j));
+                    }
+                    std::make_heap(heap, heap + k, better);
+                    T threshold = heap[0].first;
+
+                    auto consider = [&](size_t j) {
+                        // Later indices lose ties, so only strictly better values enter
+                        if (better.compute_max ? x[j] > threshold : x[j] < threshold)
+                        {
+                            std::pop_heap(heap, heap + k, better);
+                            heap[k - 1] = std::make_pair(x[j], static_cast<U>(j));
+                            std::push_heap(heap, heap + k, better);
+                            threshold = heap[0].first;
+                        }
+                    };
+
+                    const size_t block = 64;
+                    size_t j = k;
+                    for (; j + block <= n; j += block)
+                    {
+                        if (topk_count_better(x + j, block, threshold, better.compute_max) != 0)
+                        {
+                            for (size_t b = j; b < j + block; b++)
+                            {
+                                consider(b);
+                            }
+                        }
+                    }
+                    for (; j < n; j++)
+                    {
+                        consider(j);
+                    }
+                }
+
+                /// TopK along `axis`, parallel over the independent slices. Small k keeps a heap
+                /// of the best candidates while scanning; large k partitions the slice with
+                /// nth_element. Each thread reuses one workspace for all of its slices.
+                template <typename T, typename U>
+                void topk(const T* arg,
+                          U* out_indices,
+                          T* out_values,
+                          const Shape& in_shape,
+                          size_t axis,
+                          size_t k,
+                          bool compute_max,
+                          op::TopK::SortType sort)
+                {
+                    const size_t n = in_shape[axis];
+                    const size_t outer =
+                        shape_size(Shape(in_shape.begin(), in_shape.begin() + axis));
+                    const size_t inner =
+                        shape_size(Shape(in_shape.begin() + axis + 1, in_shape.end()));
+                    const int64_t slices = static_cast<int64_t>(outer * inner);
+                    if (k == 0 || n == 0)
+                    {
+                        return;
+                    }
+                    // Heap selection wins while few elements are expected to enter the heap
+                    const bool use_heap = k * 16 <= n;
+                    const TopKBetter<T, U> better{compute_max};
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+                    {
+                        std::vector<std::pair<T, U>> candidates(use_heap ? k : n);
+                        std::vector<T> gathered(inner > 1 && use_heap ? n : 0);
+
+#ifdef _OPENMP
+#pragma omp for
+#endif
+                        for (int64_t s = 0; s < slices; s++)
+                        {
+                            size_t o = static_cast<size_t>(s) / inner;
+                            size_t i = static_cast<size_t>(s) % inner;
+                            const T* x = arg + o * n * inner + i;
+
+                            if (use_heap)
+                            {
+                                const T* row = x;
+                                if (inner > 1)
+                                {
+                                    for (size_t j = 0; j < n; j++)
+                                    {
+                                        gathered[j] = x[j * inner];
+                                    }
+                                    row = gathered.data();
+                                }
+                                topk_heap_select(row, n, k, better, candidates.data());
+                            }
+                            else
+                            {
+                                for (size_t j = 0; j < n; j++)
+                                {
+                                    candidates[j] = std::make_pair(x[j * inner], static_cast<U>(j));
+                                }
+                                std::nth_element(candidates.begin(),
+                                                 candidates.begin() + k - 1,
+                                                 candidates.end(),
+                                                 better);
+                            }
+
+                            switch (sort)
+                            {
+                            case op::TopK::SortType::NONE: break;
+                            case op::TopK::SortType::SORT_INDICES:
+                                std::sort(candidates.begin(),
+                                          candidates.begin() + k,
+                                          [compute_max](const std::pair<T, U>& a,
+                                                        const std::pair<T, U>& b) {
+                                              return compute_max ? a.second < b.second
+                                                                 : a.second > b.second;
+                                          });
+                                break;
+                            case op::TopK::SortType::SORT_VALUES:
+                                std::sort(candidates.begin(), candidates.begin() + k, better);
+                                break;
+                            }
+
+                            size_t out_offset = o * k * inner + i;
+                            for (size_t j = 0; j < k; j++)
+                            {
+                                out_values[out_offset + j * inner] = candidates[j].first;
+                                out_indices[out_offset + j * inner] = candidates[j].second;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,86 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/dynamic_quantize.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::DynamicQuantize::type_info;
+constexpr NodeTypeInfo op::DynamicDequantize::type_info;
+
+op::DynamicQuantize::DynamicQuantize(const Output<Node>& data)
+    : Op({data})
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::DynamicQuantize::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(0) == element::f32,
+                          "Data element type must be f32, got ",
+                          get_input_element_type(0));
+    set_output_size(2);
+    set_output_type(0, element::u8, get_input_partial_shape(0));
+    set_output_type(1, element::f32, Shape{});
+}
+
+shared_ptr<Node> op::DynamicQuantize::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<DynamicQuantize>(new_args.at(0));
+}
+
+op::DynamicDequantize::DynamicDequantize(const Output<Node>& acc,
+                                         const Output<Node>& input_scale,
+                                         const Output<Node>& compensation,
+                                         const Output<Node>& weight_scales)
+    : Op({acc, input_scale, compensation, weight_scales})
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::DynamicDequantize::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(0) == element::i32 &&
+                              get_input_element_type(1) == element::f32 &&
+                              get_input_element_type(2) == element::i32 &&
+                              get_input_element_type(3) == element::f32,
+                          "Expected i32 accumulator and compensation and f32 scales");
+
+    const PartialShape& acc_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(
+        this, acc_shape.rank().compatible(2), "Accumulator must have rank 2, got ", acc_shape);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_partial_shape(1).compatible(PartialShape{}),
+                          "Input scale must be a scalar");
+    Dimension channels = acc_shape.rank().is_static() ? acc_shape[1] : Dimension::dynamic();
+    NODE_VALIDATION_CHECK(this,
+                          get_input_partial_shape(2).compatible(PartialShape{channels}) &&
+                              get_input_partial_shape(3).compatible(PartialShape{channels}),
+                          "Compensation and weight scales must have one entry per channel");
+
+    set_output_type(0, element::f32, acc_shape);
+}
+
+shared_ptr<Node> op::DynamicDequantize::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<DynamicDequantize>(
+        new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3));
+}
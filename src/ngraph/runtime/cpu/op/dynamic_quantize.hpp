@@ -0,0 +1,70 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Quantizes f32 data to u8 with a scale computed from the data itself.
+        ///
+        /// Output 0 is round(data / scale) + 64 and output 1 is the f32 scalar scale,
+        /// max |data| / 63. Only 7 bits are used so that QuantizedMatmul cannot saturate on
+        /// CPUs without VNNI. Used by CPUDynamicQuantization ahead of QuantizedMatmul.
+        class DynamicQuantize : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"DynamicQuantize", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API DynamicQuantize(const Output<Node>& data);
+
+            void validate_and_infer_types() override;
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+        };
+
+        /// \brief Converts the i32 [rows, channels] result of a QuantizedMatmul on
+        ///        DynamicQuantize output back to f32.
+        ///
+        /// out[r, c] = (acc[r, c] - compensation[c]) * input_scale * weight_scales[c], where
+        /// compensation removes the zero point of the quantized data.
+        class DynamicDequantize : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"DynamicDequantize", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            /// \param acc i32 [rows, channels] matmul result
+            /// \param input_scale f32 scalar scale output of DynamicQuantize
+            /// \param compensation i32 [channels] zero point times the sum of the quantized
+            ///        weights of each channel
+            /// \param weight_scales f32 [channels] scale of the quantized weights of each channel
+            CPU_BACKEND_API DynamicDequantize(const Output<Node>& acc,
+                                              const Output<Node>& input_scale,
+                                              const Output<Node>& compensation,
+                                              const Output<Node>& weight_scales);
+
+            void validate_and_infer_types() override;
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+        };
+    }
+}
@@ -0,0 +1,143 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/sparse_matmul.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::SparseDot::type_info;
+constexpr NodeTypeInfo op::SparseConvolution::type_info;
+
+namespace
+{
+    // Checks the CSR inputs 1-3 of node and returns the number of rows of the sparse matrix
+    Dimension validate_csr(const Node* node)
+    {
+        NODE_VALIDATION_CHECK(node,
+                              node->get_input_element_type(0) == element::f32 &&
+                                  node->get_input_element_type(1) == element::f32,
+                              "Data and values must be f32");
+        NODE_VALIDATION_CHECK(node,
+                              node->get_input_element_type(2) == element::i32 &&
+                                  node->get_input_element_type(3) == element::i32,
+                              "Column indices and row offsets must be i32");
+
+        const PartialShape& values_shape = node->get_input_partial_shape(1);
+        const PartialShape& indices_shape = node->get_input_partial_shape(2);
+        const PartialShape& offsets_shape = node->get_input_partial_shape(3);
+        NODE_VALIDATION_CHECK(node,
+                              values_shape.rank().compatible(1) &&
+                                  indices_shape.compatible(values_shape) &&
+                                  offsets_shape.rank().compatible(1),
+                              "Expected values and column indices of the same rank 1 shape and "
+                              "rank 1 row offsets, got ",
+                              values_shape,
+                              ", ",
+                              indices_shape,
+                              " and ",
+                              offsets_shape);
+
+        if (offsets_shape.is_static())
+        {
+            NODE_VALIDATION_CHECK(
+                node, offsets_shape[0].get_length() > 0, "Row offsets must not be empty");
+            return Dimension(offsets_shape[0].get_length() - 1);
+        }
+        return Dimension::dynamic();
+    }
+}
+
+op::SparseDot::SparseDot(const Output<Node>& data,
+                         const Output<Node>& values,
+                         const Output<Node>& column_indices,
+                         const Output<Node>& row_offsets,
+                         size_t columns)
+    : Op({data, values, column_indices, row_offsets})
+    , m_columns(columns)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::SparseDot::validate_and_infer_types()
+{
+    Dimension rows = validate_csr(this);
+    const PartialShape& data_shape = get_input_partial_shape(0);
+    if (data_shape.rank().is_dynamic())
+    {
+        set_output_type(0, element::f32, PartialShape::dynamic());
+        return;
+    }
+
+    size_t rank = data_shape.rank().get_length();
+    NODE_VALIDATION_CHECK(this, rank > 0, "Data must not be a scalar");
+    NODE_VALIDATION_CHECK(this,
+                          data_shape[rank - 1].compatible(rows),
+                          "Last axis of data (",
+                          data_shape[rank - 1],
+                          ") does not match the rows of the sparse matrix (",
+                          rows,
+                          ")");
+    vector<Dimension> output_shape(rank);
+    for (size_t i = 0; i < rank - 1; i++)
+    {
+        output_shape[i] = data_shape[i];
+    }
+    output_shape[rank - 1] = m_columns;
+    set_output_type(0, element::f32, output_shape);
+}
+
+shared_ptr<Node> op::SparseDot::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<SparseDot>(
+        new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), m_columns);
+}
+
+op::SparseConvolution::SparseConvolution(const Output<Node>& data,
+                                         const Output<Node>& values,
+                                         const Output<Node>& column_indices,
+                                         const Output<Node>& row_offsets)
+    : Op({data, values, column_indices, row_offsets})
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::SparseConvolution::validate_and_infer_types()
+{
+    Dimension output_channels = validate_csr(this);
+    const PartialShape& data_shape = get_input_partial_shape(0);
+    if (data_shape.rank().is_dynamic())
+    {
+        set_output_type(0, element::f32, PartialShape::dynamic());
+        return;
+    }
+
+    NODE_VALIDATION_CHECK(this,
+                          data_shape.rank().get_length() >= 2,
+                          "Data must have batch and channel axes, got ",
+                          data_shape);
+    vector<Dimension> output_shape(data_shape);
+    output_shape[1] = output_channels;
+    set_output_type(0, element::f32, output_shape);
+}
+
+shared_ptr<Node> op::SparseConvolution::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<SparseConvolution>(
+        new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3));
+}
@@ -0,0 +1,84 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Dot of dense data with a sparse [k, columns] matrix held in CSR.
+        ///
+        /// The sparse matrix is given by its non-zero values, their column indices and
+        /// k + 1 row offsets. The output has the shape of data with the last axis replaced by
+        /// columns. Created by CPUSparsify from Dots with sparse constant weights.
+        class SparseDot : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"SparseDot", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            /// \param data f32 [..., k]
+            /// \param values f32 [nnz] non-zero values of the sparse matrix
+            /// \param column_indices i32 [nnz] column of each value
+            /// \param row_offsets i32 [k + 1] offset of the first value of each row
+            /// \param columns Number of columns of the sparse matrix
+            CPU_BACKEND_API SparseDot(const Output<Node>& data,
+                                      const Output<Node>& values,
+                                      const Output<Node>& column_indices,
+                                      const Output<Node>& row_offsets,
+                                      size_t columns);
+
+            void validate_and_infer_types() override;
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            size_t get_columns() const { return m_columns; }
+
+        private:
+            size_t m_columns;
+        };
+
+        /// \brief Pointwise (1x1, unit stride, unpadded) convolution with sparse filters held
+        ///        in CSR.
+        ///
+        /// The filters form a [output channels, input channels] matrix. Data is
+        /// [N, input channels, ...] and the output is [N, output channels, ...].
+        class SparseConvolution : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"SparseConvolution", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            /// \param data f32 [N, input channels, ...]
+            /// \param values f32 [nnz] non-zero filter values
+            /// \param column_indices i32 [nnz] input channel of each value
+            /// \param row_offsets i32 [output channels + 1] offset of the first value of each
+            ///        output channel
+            CPU_BACKEND_API SparseConvolution(const Output<Node>& data,
+                                              const Output<Node>& values,
+                                              const Output<Node>& column_indices,
+                                              const Output<Node>& row_offsets);
+
+            void validate_and_infer_types() override;
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+        };
+    }
+}
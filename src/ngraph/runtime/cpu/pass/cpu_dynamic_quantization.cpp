@@ -0,0 +1,106 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/runtime/cpu/kernel/dynamic_quantize.hpp"
+#include "ngraph/runtime/cpu/op/dynamic_quantize.hpp"
+#include "ngraph/runtime/cpu/op/quantized_matmul.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_dynamic_quantization.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+bool runtime::cpu::pass::CPUDynamicQuantization::run_on_function(shared_ptr<Function> function)
+{
+    bool modified = false;
+    for (auto& node : function->get_ordered_ops())
+    {
+        auto dot = as_type_ptr<op::Dot>(node);
+        if (!dot || dot->get_reduction_axes_count() != 1 ||
+            dot->get_output_element_type(0) != element::f32)
+        {
+            continue;
+        }
+        auto weights = as_type_ptr<op::Constant>(dot->get_argument(1));
+        if (!weights || weights->get_shape().size() != 2)
+        {
+            continue;
+        }
+        // Matrix-vector products are memory bound and gain nothing from INT8
+        const Shape& data_shape = dot->get_input_shape(0);
+        if (data_shape.size() < 2)
+        {
+            continue;
+        }
+
+        // QuantizedMatmul takes the weights as [channels, k]
+        size_t k = weights->get_shape()[0];
+        size_t channels = weights->get_shape()[1];
+        size_t rows = shape_size(data_shape) / k;
+        vector<float> values = weights->get_vector<float>();
+        vector<int8_t> quantized(channels * k);
+        vector<float> scales(channels);
+        vector<int32_t> compensation(channels);
+        for (size_t c = 0; c < channels; c++)
+        {
+            float max_abs = 0;
+            for (size_t i = 0; i < k; i++)
+            {
+                max_abs = max(max_abs, fabs(values[i * channels + c]));
+            }
+            scales[c] = max_abs > 0 ? max_abs / 127 : 1.0f;
+            int32_t sum = 0;
+            for (size_t i = 0; i < k; i++)
+            {
+                float q = nearbyint(values[i * channels + c] / scales[c]);
+                quantized[c * k + i] = static_cast<int8_t>(max(-127.0f, min(127.0f, q)));
+                sum += quantized[c * k + i];
+            }
+            compensation[c] = kernel::dynamic_quantize_zero_point * sum;
+        }
+
+        Output<Node> data = dot->input_value(0);
+        if (data_shape.size() != 2)
+        {
+            data = make_shared<op::Reshape>(data, get_default_order(data_shape), Shape{rows, k});
+        }
+        auto quantize = make_shared<op::DynamicQuantize>(data);
+        auto matmul = make_shared<op::QuantizedMatmul>(
+            quantize->output(0),
+            make_shared<op::Constant>(element::i8, Shape{channels, k}, quantized),
+            op::Constant::create(element::f32, Shape{}, {1.0f}),
+            element::i32);
+        shared_ptr<Node> result = make_shared<op::DynamicDequantize>(
+            matmul,
+            quantize->output(1),
+            make_shared<op::Constant>(element::i32, Shape{channels}, compensation),
+            make_shared<op::Constant>(element::f32, Shape{channels}, scales));
+        if (data_shape.size() != 2)
+        {
+            result = make_shared<op::Reshape>(result, AxisVector{0, 1}, dot->get_shape());
+        }
+        replace_node(dot, result);
+        modified = true;
+    }
+    return modified;
+}
@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Runs f32 Dot ops with constant weights in INT8 without calibration.
+                ///
+                /// Weights are quantized once, per output channel, when the pass runs.
+                /// Activations are quantized on every call by DynamicQuantize, which computes
+                /// their range and quantizes them in one kernel. The product runs on the MKLDNN
+                /// QuantizedMatmul kernel with an i32 result, and DynamicDequantize converts that
+                /// back to f32. Activations get 7 bits and weights 8, which keeps the int16 pair
+                /// sums of the kernels without VNNI from saturating at some cost in accuracy.
+                /// Disabled by default; enable with
+                /// NGRAPH_PASS_ENABLES="CPUDynamicQuantization:1".
+                class CPU_BACKEND_API CPUDynamicQuantization : public ngraph::pass::FunctionPass
+                {
+                public:
+                    CPUDynamicQuantization()
+                    {
+                        set_property(ngraph::pass::PassProperty::REQUIRE_STATIC_SHAPE, true);
+                    }
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+                };
+            }
+        }
+    }
+}
@@ -23,6 +23,7 @@
 #include <mkldnn.hpp>
 
 #include "cpu_layout.hpp"
+#include "cpu_layout_cost_model.hpp"
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/env_util.hpp"
@@ -288,6 +289,86 @@ static void set_native_layouts(runtime::cpu::CPU_ExternalFunction* external_func
     }
 }
 
+static bool has_layout_handler(const Node* node);
+
+// Appends the row-major layout of the output of node to mds, if MKLDNN can describe it
+static bool append_native_md(const Node* node, vector<memory::desc>& mds)
+{
+    const Shape& shape = node->get_output_shape(0);
+    const element::Type& et = node->get_output_element_type(0);
+    Strides strides = row_major_strides(shape);
+    if (!mkldnn_utils::can_create_mkldnn_md(shape, strides, et))
+    {
+        return false;
+    }
+    mds.push_back(mkldnn_utils::create_blocked_mkldnn_md(shape, strides, et));
+    return true;
+}
+
+// Estimated cost of the conversions the users of the output of node will need if the output is
+// given layout md. Elementwise users take on the layout of their inputs, MKLDNN kernels are
+// assumed to want a blocked layout, and users without a layout handler the native one.
+static double get_users_layout_cost(const Node* node,
+                                    const memory::desc& md,
+                                    const memory::desc& native_md)
+{
+    auto& cost_model = runtime::cpu::pass::LayoutCostModel::get();
+    double cost = 0;
+    for (descriptor::Input* input : node->get_output_inputs(0))
+    {
+        const Node* user = input->get_raw_pointer_node();
+        if (user->is_unary_elementwise_arithmetic() || user->is_binary_elementwise_arithmetic())
+        {
+            continue;
+        }
+        if (mkldnn_utils::use_mkldnn_kernel(user))
+        {
+            if (!runtime::cpu::pass::LayoutCostModel::is_blocked(md))
+            {
+                cost += cost_model.get_blocking_cost(md);
+            }
+        }
+        else if (!has_layout_handler(user))
+        {
+            cost += cost_model.get_reorder_cost(md, native_md);
+        }
+    }
+    return cost;
+}
+
+// Chooses the layout of an elementwise op among the layouts of its arguments and the native
+// layout, minimising the cost of converting the arguments plus the estimated cost to its users.
+// Ties keep the earliest candidate, i.e. the layout of the first argument.
+static memory::desc select_eltwise_layout(const Node* node, const vector<memory::desc>& arg_mds)
+{
+    auto& cost_model = runtime::cpu::pass::LayoutCostModel::get();
+    vector<memory::desc> candidates = arg_mds;
+    bool has_native = append_native_md(node, candidates);
+
+    size_t selected = 0;
+    double selected_cost = 0;
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        double cost = 0;
+        for (auto& arg_md : arg_mds)
+        {
+            cost += cost_model.get_reorder_cost(arg_md, candidates[i]);
+        }
+        if (has_native)
+        {
+            cost += get_users_layout_cost(node, candidates[i], candidates.back());
+        }
+        if (i == 0 || cost < selected_cost)
+        {
+            selected = i;
+            selected_cost = cost;
+        }
+    }
+    NGRAPH_DEBUG << "Selected layout candidate " << selected << " of " << candidates.size()
+                 << " for " << node->get_name() << ", estimated cost " << selected_cost << " ns";
+    return candidates[selected];
+}
+
 static void set_layouts_unaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
                                      std::shared_ptr<ngraph::Node> node)
 {
@@ -306,8 +387,10 @@ static void set_layouts_unaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction*
 #endif
     if (mkldnn_utils::use_mkldnn_kernel(node.get()) || md_check)
     {
-        vector<memory::desc> o_mds;
-        o_mds.push_back(input_md);
+        auto md = select_eltwise_layout(node.get(), {input_md});
+        vector<memory::desc> i_mds{md};
+        vector<memory::desc> o_mds{md};
+        node = insert_input_conversions(external_function, node, i_mds);
         set_output_layouts(node, o_mds);
     }
     else
@@ -343,11 +426,14 @@ void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* exter
     {
         vector<memory::desc> i_mds;
         vector<memory::desc> o_mds;
+        // Selecting an argument explicitly overrides the cost model
         const int32_t user_select = getenv_int("NGRAPH_PASS_CPU_LAYOUT_ELTWISE");
-        int select = (user_select == 0 || user_select == 1) ? user_select : 0;
-        i_mds.push_back(arg_mds[select]);
-        i_mds.push_back(arg_mds[select]);
-        o_mds.push_back(arg_mds[select]);
+        auto md = (user_select == 0 || user_select == 1)
+                      ? arg_mds[user_select]
+                      : select_eltwise_layout(node.get(), arg_mds);
+        i_mds.push_back(md);
+        i_mds.push_back(md);
+        o_mds.push_back(md);
         node = insert_input_conversions(external_function, node, i_mds);
         set_output_layouts(node, o_mds);
     }
@@ -2669,6 +2755,11 @@ static const runtime::cpu::pass::LayoutOpMap s_dispatcher{
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::QuantizedMatmul>},
 };
 
+static bool has_layout_handler(const Node* node)
+{
+    return s_dispatcher.find(TI(*node)) != s_dispatcher.end();
+}
+
 bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::shared_ptr<Node>>& nodes)
 {
     for (const auto& node : nodes)
@@ -0,0 +1,182 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <chrono>
+#include <sstream>
+
+#include "cpu_layout_cost_model.hpp"
+#include "ngraph/env_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+
+using namespace std;
+using namespace mkldnn;
+using namespace ngraph;
+
+// Copy bandwidth assumed for reorders that are not measured, in bytes per nanosecond
+static const double s_reorder_bytes_per_ns = 8.0;
+
+// Blocked <-> plain reorders gather with strided accesses on one side
+static const double s_blocking_penalty = 2.0;
+
+static string get_md_key(const memory::desc& md)
+{
+    const auto& data = md.data;
+    ostringstream key;
+    key << static_cast<int>(data.data_type) << ":";
+    for (int i = 0; i < data.ndims; i++)
+    {
+        key << data.dims[i] << ",";
+    }
+#if MKLDNN_VERSION_MAJOR < 1
+    key << ":" << static_cast<int>(data.format) << ":";
+    const auto& blk = data.layout_desc.blocking;
+    for (int i = 0; i < data.ndims; i++)
+    {
+        key << blk.strides[0][i] << "/" << blk.block_dims[i] << ",";
+    }
+#else
+    key << ":" << static_cast<int>(data.format_kind) << ":";
+    const auto& blk = data.format_desc.blocking;
+    for (int i = 0; i < data.ndims; i++)
+    {
+        key << blk.strides[i] << ",";
+    }
+    for (int i = 0; i < blk.inner_nblks; i++)
+    {
+        key << blk.inner_blks[i] << "@" << blk.inner_idxs[i] << ",";
+    }
+#endif
+    return key.str();
+}
+
+static size_t get_md_bytes(const memory::desc& md)
+{
+#if MKLDNN_VERSION_MAJOR < 1
+    size_t elements = 1;
+    for (int i = 0; i < md.data.ndims; i++)
+    {
+        elements *= static_cast<size_t>(md.data.dims[i]);
+    }
+    // Several element types share a data type, but always one of the same size
+    for (auto& entry : runtime::cpu::mkldnn_utils::get_mkldnn_data_type_map())
+    {
+        if (entry.second != memory::data_type::DATA_UNDEF &&
+            static_cast<mkldnn_data_type_t>(entry.second) == md.data.data_type)
+        {
+            return elements * entry.first.size();
+        }
+    }
+    throw ngraph_error("No element type exists for MKLDNN data type " +
+                       to_string(static_cast<int>(md.data.data_type)));
+#else
+    return md.get_size();
+#endif
+}
+
+runtime::cpu::pass::LayoutCostModel& runtime::cpu::pass::LayoutCostModel::get()
+{
+    static LayoutCostModel s_cost_model;
+    return s_cost_model;
+}
+
+runtime::cpu::pass::LayoutCostModel::LayoutCostModel()
+    : m_autotune(getenv_bool("NGRAPH_CPU_LAYOUT_AUTOTUNE"))
+{
+}
+
+bool runtime::cpu::pass::LayoutCostModel::is_blocked(const memory::desc& md)
+{
+#if MKLDNN_VERSION_MAJOR < 1
+    return md.data.format == mkldnn_blocked ||
+           mkldnn_utils::is_mkldnn_blocked_data_format(
+               static_cast<memory::FORMAT>(md.data.format));
+#else
+    return mkldnn_utils::is_mkldnn_desc_blocked_data_format(md);
+#endif
+}
+
+double runtime::cpu::pass::LayoutCostModel::get_reorder_cost(const memory::desc& from,
+                                                             const memory::desc& to)
+{
+    if (mkldnn_utils::compare_mkldnn_mds(from, to))
+    {
+        return 0;
+    }
+
+    string key = get_md_key(from) + "->" + get_md_key(to);
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_reorder_costs.find(key);
+    if (it != m_reorder_costs.end())
+    {
+        return it->second;
+    }
+    double cost = m_autotune ? measure_reorder_cost(from, to) : estimate_reorder_cost(from, to);
+    m_reorder_costs[key] = cost;
+    return cost;
+}
+
+double runtime::cpu::pass::LayoutCostModel::get_blocking_cost(const memory::desc& md)
+{
+    return s_blocking_penalty * 2 * get_md_bytes(md) / s_reorder_bytes_per_ns;
+}
+
+double runtime::cpu::pass::LayoutCostModel::estimate_reorder_cost(const memory::desc& from,
+                                                                  const memory::desc& to) const
+{
+    // A reorder reads and writes every element once
+    double cost = (get_md_bytes(from) + get_md_bytes(to)) / s_reorder_bytes_per_ns;
+    if (is_blocked(from) != is_blocked(to))
+    {
+        cost *= s_blocking_penalty;
+    }
+    return cost;
+}
+
+double runtime::cpu::pass::LayoutCostModel::measure_reorder_cost(const memory::desc& from,
+                                                                 const memory::desc& to) const
+{
+#if MKLDNN_VERSION_MAJOR >= 1
+    try
+    {
+        memory src(from, executor::global_cpu_engine);
+        memory dst(to, executor::global_cpu_engine);
+        reorder primitive(src, dst);
+        stream s(executor::global_cpu_engine);
+
+        // The first run pages in both buffers
+        primitive.execute(s, src, dst);
+        s.wait();
+
+        const size_t iterations = 5;
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            primitive.execute(s, src, dst);
+        }
+        s.wait();
+        auto elapsed = chrono::steady_clock::now() - start;
+        return static_cast<double>(chrono::duration_cast<chrono::nanoseconds>(elapsed).count()) /
+               iterations;
+    }
+    catch (const mkldnn::error& e)
+    {
+        NGRAPH_DEBUG << "Could not time reorder, using the estimated cost: " << e.message;
+    }
+#endif
+    return estimate_reorder_cost(from, to);
+}
@@ -0,0 +1,76 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <mkldnn.hpp>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                class LayoutCostModel;
+            }
+        }
+    }
+}
+
+/// \brief Estimates the cost of the layout conversions CPULayout inserts, so that it can choose
+///        between candidate layouts.
+///
+/// Costs are in nanoseconds. By default they are derived from the number of bytes a reorder
+/// reads and writes. With NGRAPH_CPU_LAYOUT_AUTOTUNE set, each distinct reorder is instead
+/// timed with MKLDNN the first time it is queried. Costs are cached per shape, element type and
+/// pair of layouts for the lifetime of the process.
+class CPU_BACKEND_API ngraph::runtime::cpu::pass::LayoutCostModel
+{
+public:
+    static LayoutCostModel& get();
+
+    /// \brief Cost of converting a tensor from layout `from` to layout `to`; 0 if they are
+    ///        the same.
+    double get_reorder_cost(const mkldnn::memory::desc& from, const mkldnn::memory::desc& to);
+
+    /// \brief Cost of converting a tensor with layout md between a blocked and a plain layout,
+    ///        used when the exact layout on the other side is not known yet.
+    double get_blocking_cost(const mkldnn::memory::desc& md);
+
+    /// \brief True if md is one of the MKLDNN blocked layouts.
+    static bool is_blocked(const mkldnn::memory::desc& md);
+
+    bool is_autotuning() const { return m_autotune; }
+private:
+    LayoutCostModel();
+
+    double estimate_reorder_cost(const mkldnn::memory::desc& from,
+                                 const mkldnn::memory::desc& to) const;
+    double measure_reorder_cost(const mkldnn::memory::desc& from,
+                                const mkldnn::memory::desc& to) const;
+
+    bool m_autotune;
+    std::mutex m_mutex;
+    std::unordered_map<std::string, double> m_reorder_costs;
+};
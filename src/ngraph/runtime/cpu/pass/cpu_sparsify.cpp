@@ -0,0 +1,183 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/runtime/cpu/op/sparse_matmul.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_sparsify.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    struct CSRMatrix
+    {
+        vector<float> values;
+        vector<int32_t> column_indices;
+        vector<int32_t> row_offsets;
+    };
+
+    // Row-major values of a rank 2 constant, looking through a Reshape of a rank 2 constant
+    bool get_matrix(const Output<Node>& output, vector<float>& matrix)
+    {
+        auto node = output.get_node_shared_ptr();
+        if (auto constant = as_type_ptr<op::Constant>(node))
+        {
+            matrix = constant->get_vector<float>();
+            return true;
+        }
+        auto reshape = as_type_ptr<op::Reshape>(node);
+        auto constant =
+            reshape ? as_type_ptr<op::Constant>(reshape->get_argument(0)) : nullptr;
+        if (!constant || constant->get_shape().size() != 2)
+        {
+            return false;
+        }
+        matrix = constant->get_vector<float>();
+        if (reshape->get_input_order() == AxisVector{1, 0})
+        {
+            size_t rows = constant->get_shape()[0];
+            size_t cols = constant->get_shape()[1];
+            vector<float> transposed(matrix.size());
+            for (size_t r = 0; r < rows; r++)
+            {
+                for (size_t c = 0; c < cols; c++)
+                {
+                    transposed[c * rows + r] = matrix[r * cols + c];
+                }
+            }
+            matrix.swap(transposed);
+        }
+        return true;
+    }
+
+    CSRMatrix make_csr(const vector<float>& matrix, size_t rows, size_t cols)
+    {
+        CSRMatrix csr;
+        csr.row_offsets.reserve(rows + 1);
+        csr.row_offsets.push_back(0);
+        for (size_t r = 0; r < rows; r++)
+        {
+            for (size_t c = 0; c < cols; c++)
+            {
+                float value = matrix[r * cols + c];
+                if (value != 0)
+                {
+                    csr.values.push_back(value);
+                    csr.column_indices.push_back(static_cast<int32_t>(c));
+                }
+            }
+            csr.row_offsets.push_back(static_cast<int32_t>(csr.values.size()));
+        }
+        return csr;
+    }
+
+    OutputVector make_csr_constants(const CSRMatrix& csr)
+    {
+        Shape nnz_shape{csr.values.size()};
+        return {make_shared<op::Constant>(element::f32, nnz_shape, csr.values),
+                make_shared<op::Constant>(element::i32, nnz_shape, csr.column_indices),
+                make_shared<op::Constant>(
+                    element::i32, Shape{csr.row_offsets.size()}, csr.row_offsets)};
+    }
+
+    bool is_pointwise(const op::Convolution& conv)
+    {
+        auto is_one = [](size_t value) { return value == 1; };
+        auto is_zero = [](ptrdiff_t value) { return value == 0; };
+        const Shape& filters_shape = conv.get_input_shape(1);
+        return all_of(filters_shape.begin() + 2, filters_shape.end(), is_one) &&
+               all_of(conv.get_window_movement_strides().begin(),
+                      conv.get_window_movement_strides().end(),
+                      is_one) &&
+               all_of(conv.get_window_dilation_strides().begin(),
+                      conv.get_window_dilation_strides().end(),
+                      is_one) &&
+               all_of(conv.get_data_dilation_strides().begin(),
+                      conv.get_data_dilation_strides().end(),
+                      is_one) &&
+               all_of(conv.get_padding_below().begin(), conv.get_padding_below().end(), is_zero) &&
+               all_of(conv.get_padding_above().begin(), conv.get_padding_above().end(), is_zero);
+    }
+}
+
+bool runtime::cpu::pass::CPUSparsify::run_on_function(shared_ptr<Function> function)
+{
+    bool modified = false;
+    for (auto& node : function->get_ordered_ops())
+    {
+        if (node->get_output_element_type(0) != element::f32)
+        {
+            continue;
+        }
+        auto dot = as_type_ptr<op::Dot>(node);
+        auto conv = as_type_ptr<op::Convolution>(node);
+        // The sparse matrix has the shape [rows, cols]
+        size_t rows;
+        size_t cols;
+        if (dot && dot->get_reduction_axes_count() == 1 && dot->get_input_shape(0).size() > 0 &&
+            dot->get_input_shape(1).size() == 2)
+        {
+            rows = dot->get_input_shape(1)[0];
+            cols = dot->get_input_shape(1)[1];
+        }
+        else if (conv && is_pointwise(*conv))
+        {
+            rows = conv->get_input_shape(1)[0];
+            cols = conv->get_input_shape(1)[1];
+        }
+        else
+        {
+            continue;
+        }
+
+        vector<float> matrix;
+        if (rows * cols == 0 || !get_matrix(node->input_value(1), matrix))
+        {
+            continue;
+        }
+        size_t zeros = count(matrix.begin(), matrix.end(), 0.0f);
+        if (zeros < m_min_sparsity * matrix.size())
+        {
+            continue;
+        }
+        NGRAPH_DEBUG << "CPUSparsify: " << node->get_name() << " weights are "
+                     << 100 * zeros / matrix.size() << "% zero";
+
+        OutputVector csr = make_csr_constants(make_csr(matrix, rows, cols));
+        shared_ptr<Node> sparse;
+        if (dot)
+        {
+            sparse =
+                make_shared<op::SparseDot>(dot->input_value(0), csr[0], csr[1], csr[2], cols);
+        }
+        else
+        {
+            sparse = make_shared<op::SparseConvolution>(
+                conv->input_value(0), csr[0], csr[1], csr[2]);
+        }
+        replace_node(node, sparse);
+        modified = true;
+    }
+    return modified;
+}
@@ -0,0 +1,56 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Stores sparse constant weights in CSR and runs their products on
+                ///        sparse kernels.
+                ///
+                /// f32 Dots with rank 2 constant weights become SparseDot and pointwise
+                /// Convolutions with constant filters become SparseConvolution when at least
+                /// min_sparsity of the weights are zero. Dot weights may also be a Reshape of
+                /// a constant, which covers rank 2 MatMuls after fused op decomposition.
+                /// Pruned weights and zero activations are skipped, so NaN and Inf do not
+                /// propagate through them as they would in the dense product.
+                /// Disabled by default; enable with NGRAPH_PASS_ENABLES="CPUSparsify:1".
+                class CPU_BACKEND_API CPUSparsify : public ngraph::pass::FunctionPass
+                {
+                public:
+                    CPUSparsify(float min_sparsity = 0.7f)
+                        : m_min_sparsity(min_sparsity)
+                    {
+                        set_property(ngraph::pass::PassProperty::REQUIRE_STATIC_SHAPE, true);
+                    }
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+                private:
+                    float m_min_sparsity;
+                };
+            }
+        }
+    }
+}
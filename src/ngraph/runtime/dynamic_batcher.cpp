@@ -0,0 +1,310 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/dynamic_batcher.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/specialize_function.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Bytes of one sample of a tensor whose axis 0 is the batch axis
+    size_t sample_bytes(const element::Type& type, const Shape& shape)
+    {
+        return shape_size(Shape(shape.begin() + 1, shape.end())) * type.size();
+    }
+}
+
+runtime::DynamicBatcher::DynamicBatcher(const shared_ptr<Function>& function,
+                                        const shared_ptr<Backend>& backend,
+                                        const BatcherOptions& options)
+    : m_function(function)
+    , m_backend(backend)
+    , m_options(options)
+    , m_buckets(options.buckets)
+{
+    NGRAPH_CHECK(m_options.max_batch_size > 0, "max_batch_size must be positive");
+    if (m_buckets.empty())
+    {
+        for (size_t size = 1; size < m_options.max_batch_size; size *= 2)
+        {
+            m_buckets.push_back(size);
+        }
+    }
+    m_buckets.push_back(m_options.max_batch_size);
+    sort(m_buckets.begin(), m_buckets.end());
+    m_buckets.erase(unique(m_buckets.begin(), m_buckets.end()), m_buckets.end());
+    m_buckets.erase(
+        remove_if(m_buckets.begin(),
+                  m_buckets.end(),
+                  [this](size_t size) { return size == 0 || size > m_options.max_batch_size; }),
+        m_buckets.end());
+
+    // The batch size of a request is taken from its first input
+    NGRAPH_CHECK(!m_function->get_parameters().empty(), "The function needs a parameter");
+    for (auto& parameter : m_function->get_parameters())
+    {
+        const PartialShape& shape = parameter->get_partial_shape();
+        NGRAPH_CHECK(shape.rank().is_static() && shape.rank().get_length() > 0 &&
+                         shape[0].is_dynamic(),
+                     "Parameters need a dynamic batch axis, got ",
+                     shape);
+        vector<Dimension> dimensions(shape);
+        dimensions[0] = 1;
+        NGRAPH_CHECK(PartialShape(dimensions).is_static() &&
+                         parameter->get_element_type().is_static(),
+                     "Only the batch axis of a parameter may be dynamic, got ",
+                     shape);
+        m_input_sample_bytes.push_back(
+            sample_bytes(parameter->get_element_type(), PartialShape(dimensions).to_shape()));
+    }
+    for (auto& result : m_function->get_results())
+    {
+        const PartialShape& shape = result->get_output_partial_shape(0);
+        NGRAPH_CHECK(shape.rank().is_static() && shape.rank().get_length() > 0,
+                     "Results need a batch axis, got ",
+                     shape);
+        vector<Dimension> dimensions(shape);
+        dimensions[0] = 1;
+        NGRAPH_CHECK(PartialShape(dimensions).is_static() &&
+                         result->get_element_type().is_static(),
+                     "Only the batch axis of a result may be dynamic, got ",
+                     shape);
+        m_output_sample_bytes.push_back(
+            sample_bytes(result->get_element_type(), PartialShape(dimensions).to_shape()));
+    }
+
+    m_dispatcher = thread(&DynamicBatcher::dispatch_loop, this);
+}
+
+runtime::DynamicBatcher::~DynamicBatcher()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_one();
+    m_dispatcher.join();
+}
+
+future<void> runtime::DynamicBatcher::submit(const vector<shared_ptr<Tensor>>& outputs,
+                                             const vector<shared_ptr<Tensor>>& inputs)
+{
+    NGRAPH_CHECK(inputs.size() == m_input_sample_bytes.size(),
+                 "Expected ",
+                 m_input_sample_bytes.size(),
+                 " inputs, got ",
+                 inputs.size());
+    NGRAPH_CHECK(outputs.size() == m_function->get_results().size(),
+                 "Expected ",
+                 m_function->get_results().size(),
+                 " outputs, got ",
+                 outputs.size());
+    NGRAPH_CHECK(inputs[0]->get_shape().size() > 0, "Inputs need a batch axis");
+    size_t samples = inputs[0]->get_shape()[0];
+    NGRAPH_CHECK(samples > 0 && samples <= m_options.max_batch_size,
+                 "A request must have between 1 and ",
+                 m_options.max_batch_size,
+                 " samples, got ",
+                 samples);
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        NGRAPH_CHECK(inputs[i]->get_element_type() ==
+                             m_function->get_parameters()[i]->get_element_type() &&
+                         inputs[i]->get_size_in_bytes() == samples * m_input_sample_bytes[i],
+                     "Input ",
+                     i,
+                     " does not hold ",
+                     samples,
+                     " samples of the parameter");
+    }
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        NGRAPH_CHECK(outputs[i]->get_element_type() ==
+                             m_function->get_results()[i]->get_element_type() &&
+                         outputs[i]->get_size_in_bytes() == samples * m_output_sample_bytes[i],
+                     "Output ",
+                     i,
+                     " does not hold ",
+                     samples,
+                     " samples of the result");
+    }
+
+    Request request;
+    request.outputs = outputs;
+    request.inputs = inputs;
+    request.samples = samples;
+    request.arrival = chrono::steady_clock::now();
+    auto result = request.promise.get_future();
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_queue.push_back(move(request));
+        m_queued_samples += samples;
+    }
+    m_cv.notify_one();
+    return result;
+}
+
+size_t runtime::DynamicBatcher::get_batch_count() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_batch_count;
+}
+
+runtime::DynamicBatcher::Bucket& runtime::DynamicBatcher::get_bucket(size_t batch_size)
+{
+    auto it = m_compiled.find(batch_size);
+    if (it != m_compiled.end())
+    {
+        return it->second;
+    }
+
+    vector<element::Type> types;
+    vector<PartialShape> shapes;
+    for (auto& parameter : m_function->get_parameters())
+    {
+        vector<Dimension> dimensions(parameter->get_partial_shape());
+        dimensions[0] = batch_size;
+        types.push_back(parameter->get_element_type());
+        shapes.push_back(PartialShape(dimensions));
+    }
+    auto specialized = specialize_function(
+        m_function, types, shapes, vector<void*>(types.size(), nullptr), false, true);
+
+    Bucket bucket;
+    bucket.executable = m_backend->compile(specialized);
+    bool executable_tensors = m_backend->executable_can_create_tensors();
+    // Requests are gathered into a host buffer that is written to the staging tensor at once,
+    // since tensors only support whole reads and writes
+    auto make_staging = [&](const element::Type& type, const Shape& shape, bool input, size_t i) {
+        bucket.buffers.emplace_back(new AlignedBuffer(shape_size(shape) * type.size()));
+        if (!executable_tensors)
+        {
+            return m_backend->create_tensor(type, shape);
+        }
+        return input ? bucket.executable->create_input_tensor(i)
+                     : bucket.executable->create_output_tensor(i);
+    };
+    for (size_t i = 0; i < shapes.size(); i++)
+    {
+        bucket.inputs.push_back(make_staging(types[i], shapes[i].to_shape(), true, i));
+    }
+    for (size_t i = 0; i < specialized->get_results().size(); i++)
+    {
+        auto& result = specialized->get_results()[i];
+        NGRAPH_CHECK(result->get_output_partial_shape(0).is_static() &&
+                         result->get_shape().size() > 0 && result->get_shape()[0] == batch_size &&
+                         sample_bytes(result->get_element_type(), result->get_shape()) ==
+                             m_output_sample_bytes[i],
+                     "Result ",
+                     i,
+                     " does not have the batch size on axis 0");
+        bucket.outputs.push_back(
+            make_staging(result->get_element_type(), result->get_shape(), false, i));
+    }
+    return m_compiled.emplace(batch_size, move(bucket)).first->second;
+}
+
+void runtime::DynamicBatcher::run_batch(vector<Request>& requests, size_t samples)
+{
+    size_t batch_size = *lower_bound(m_buckets.begin(), m_buckets.end(), samples);
+    try
+    {
+        Bucket& bucket = get_bucket(batch_size);
+        for (size_t i = 0; i < bucket.inputs.size(); i++)
+        {
+            AlignedBuffer& buffer = *bucket.buffers[i];
+            char* data = buffer.get_ptr<char>();
+            for (auto& request : requests)
+            {
+                size_t bytes = request.samples * m_input_sample_bytes[i];
+                request.inputs[i]->read(data, bytes);
+                data += bytes;
+            }
+            // Padding samples are zero rather than what an earlier batch left, which could be
+            // invalid for the function (e.g. indices out of range)
+            fill(data, buffer.get_ptr<char>() + buffer.size(), 0);
+            bucket.inputs[i]->write(buffer.get_ptr(), bucket.inputs[i]->get_size_in_bytes());
+        }
+        bucket.executable->call(bucket.outputs, bucket.inputs);
+        for (size_t i = 0; i < bucket.outputs.size(); i++)
+        {
+            AlignedBuffer& buffer = *bucket.buffers[bucket.inputs.size() + i];
+            bucket.outputs[i]->read(buffer.get_ptr(), bucket.outputs[i]->get_size_in_bytes());
+            const char* data = buffer.get_ptr<char>();
+            for (auto& request : requests)
+            {
+                size_t bytes = request.samples * m_output_sample_bytes[i];
+                request.outputs[i]->write(data, bytes);
+                data += bytes;
+            }
+        }
+    }
+    catch (...)
+    {
+        for (auto& request : requests)
+        {
+            request.promise.set_exception(current_exception());
+        }
+        return;
+    }
+    for (auto& request : requests)
+    {
+        request.promise.set_value();
+    }
+}
+
+void runtime::DynamicBatcher::dispatch_loop()
+{
+    unique_lock<mutex> lock(m_mutex);
+    while (true)
+    {
+        m_cv.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+        if (m_queue.empty())
+        {
+            return;
+        }
+        // Wait for a full batch until the oldest request reaches its deadline. Requests left
+        // at shutdown run without waiting.
+        auto deadline = m_queue.front().arrival + m_options.max_latency;
+        m_cv.wait_until(lock, deadline, [this]() {
+            return m_stop || m_queued_samples >= m_options.max_batch_size;
+        });
+
+        vector<Request> batch;
+        size_t samples = 0;
+        while (!m_queue.empty() &&
+               samples + m_queue.front().samples <= m_options.max_batch_size)
+        {
+            samples += m_queue.front().samples;
+            batch.push_back(move(m_queue.front()));
+            m_queue.pop_front();
+        }
+        m_queued_samples -= samples;
+        m_batch_count++;
+        lock.unlock();
+        run_batch(batch, samples);
+        lock.lock();
+    }
+}
@@ -0,0 +1,128 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class AlignedBuffer;
+        class Backend;
+        class Executable;
+        class Tensor;
+
+        struct BatcherOptions
+        {
+            /// Largest number of samples run in one batch
+            size_t max_batch_size = 16;
+            /// Longest time the first request of a batch waits for more requests
+            std::chrono::microseconds max_latency{2000};
+            /// Batch sizes an executable is compiled for. A batch runs on the smallest bucket
+            /// that holds it, with the remaining rows left unused. Empty selects the powers of
+            /// two up to max_batch_size and max_batch_size itself.
+            std::vector<size_t> buckets;
+        };
+
+        /// \brief Coalesces small requests into batches for one Function.
+        ///
+        /// Axis 0 of every parameter and result is the batch axis, and the Function must
+        /// compute each sample independently of the others. Its parameters may have a
+        /// dynamic batch axis; the Function is specialized and compiled for a bucket the
+        /// first time a batch of that size runs.
+        ///
+        /// Requests queue until max_batch_size samples are waiting or the oldest has waited
+        /// max_latency. Their inputs are then concatenated into staging tensors created by
+        /// the bucket's executable, the batch runs, and each request's slice of the outputs is
+        /// copied back to its own output tensors.
+        class NGRAPH_API DynamicBatcher
+        {
+        public:
+            DynamicBatcher(const std::shared_ptr<Function>& function,
+                           const std::shared_ptr<Backend>& backend,
+                           const BatcherOptions& options = BatcherOptions());
+            /// \brief Runs the requests still queued, then stops.
+            ~DynamicBatcher();
+
+            /// \brief Queues a request of one or more samples.
+            /// \param outputs One tensor per result, with the request's samples on axis 0
+            /// \param inputs One tensor per parameter, with the request's samples on axis 0
+            /// \returns A future that becomes ready when the outputs have been written and
+            ///          holds any exception raised while running the batch
+            std::future<void> submit(const std::vector<std::shared_ptr<Tensor>>& outputs,
+                                     const std::vector<std::shared_ptr<Tensor>>& inputs);
+
+            const std::vector<size_t>& get_buckets() const { return m_buckets; }
+            /// \brief Number of batches run so far
+            size_t get_batch_count() const;
+
+        private:
+            struct Request
+            {
+                std::vector<std::shared_ptr<Tensor>> outputs;
+                std::vector<std::shared_ptr<Tensor>> inputs;
+                size_t samples;
+                std::chrono::steady_clock::time_point arrival;
+                std::promise<void> promise;
+            };
+
+            /// Executable compiled for one batch size and its staging tensors
+            struct Bucket
+            {
+                std::shared_ptr<Executable> executable;
+                /// Host copies of the inputs followed by the outputs
+                std::vector<std::unique_ptr<AlignedBuffer>> buffers;
+                std::vector<std::shared_ptr<Tensor>> inputs;
+                std::vector<std::shared_ptr<Tensor>> outputs;
+            };
+
+            Bucket& get_bucket(size_t batch_size);
+            void run_batch(std::vector<Request>& requests, size_t samples);
+            void dispatch_loop();
+
+            std::shared_ptr<Function> m_function;
+            std::shared_ptr<Backend> m_backend;
+            BatcherOptions m_options;
+            std::vector<size_t> m_buckets;
+            /// Bytes of one sample of each parameter
+            std::vector<size_t> m_input_sample_bytes;
+            /// Bytes of one sample of each result
+            std::vector<size_t> m_output_sample_bytes;
+            std::map<size_t, Bucket> m_compiled;
+
+            mutable std::mutex m_mutex;
+            std::condition_variable m_cv;
+            std::deque<Request> m_queue;
+            size_t m_queued_samples = 0;
+            size_t m_batch_count = 0;
+            bool m_stop = false;
+            std::thread m_dispatcher;
+        };
+    }
+}
@@ -39,6 +39,36 @@ bool runtime::Executable::call_with_validate(const vector<shared_ptr<runtime::Te
     return call(outputs, inputs);
 }
 
+void runtime::Executable::set_latency_profiling_enabled(bool enabled)
+{
+    m_latency_profiler.set_enabled(enabled);
+}
+
+bool runtime::Executable::is_latency_profiling_enabled() const
+{
+    return m_latency_profiler.is_enabled();
+}
+
+runtime::LatencyStatistics runtime::Executable::get_call_latency_statistics() const
+{
+    return m_latency_profiler.get_call_statistics();
+}
+
+vector<runtime::LatencyStatistics> runtime::Executable::get_op_latency_statistics() const
+{
+    return m_latency_profiler.get_op_statistics();
+}
+
+void runtime::Executable::reset_latency_statistics()
+{
+    m_latency_profiler.reset();
+}
+
+void runtime::Executable::write_latency_metrics(ostream& out, const string& name) const
+{
+    m_latency_profiler.write_prometheus(out, name);
+}
+
 void runtime::Executable::validate(const vector<std::shared_ptr<runtime::Tensor>>& outputs,
                                    const vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "ngraph/function.hpp"
+#include "ngraph/runtime/latency_profiler.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -55,6 +56,26 @@ public:
     /// \returns Vector of PerformanceCounter information.
     virtual std::vector<PerformanceCounter> get_performance_data() const;
 
+    /// \brief Turns the per-call and per-op latency histograms on or off. Off by default
+    ///        unless NGRAPH_LATENCY_PROFILING is set; may be toggled between or during calls.
+    ///        Backends that do not time individual ops only record whole calls.
+    void set_latency_profiling_enabled(bool enabled);
+    bool is_latency_profiling_enabled() const;
+
+    /// \brief Latency percentiles of whole calls recorded while profiling was enabled
+    LatencyStatistics get_call_latency_statistics() const;
+
+    /// \brief Latency percentiles of every op timed while profiling was enabled
+    std::vector<LatencyStatistics> get_op_latency_statistics() const;
+
+    /// \brief Clears the recorded latencies
+    void reset_latency_statistics();
+
+    /// \brief Writes the recorded latencies in the Prometheus text exposition format
+    /// \param out Stream to write to
+    /// \param name Value of the `executable` label of every sample
+    void write_latency_metrics(std::ostream& out, const std::string& name) const;
+
     /// \brief Validates a Function.
     /// \param outputs vector of runtime::Tensor used as outputs
     /// \param inputs vector of runtime::Tensor used as inputs
@@ -159,4 +180,5 @@ protected:
 
     ngraph::ParameterVector m_parameters;
     ngraph::ResultVector m_results;
+    LatencyProfiler m_latency_profiler;
 };
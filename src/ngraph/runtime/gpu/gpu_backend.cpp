@@ -147,6 +147,8 @@ bool runtime::gpu::GPUBackend::is_supported(const Node& op) const
                                    "DynPad"
                                    "SelectAndScatter",
                                    "StopGradient",
+                                   "EmbeddingBag",
+                                   "EmbeddingBagBackprop",
                                    "EmbeddingLookup",
                                    "GenerateMask",
                                    "DynBroadcast",
@@ -1296,6 +1296,16 @@ std::string runtime::gpu::GPU_Emitter::emit_v0_DynSlice(EMIT_ARGS)
     throw unsupported_op("Unsupported op '" + node->description() + "'");
 }
 
+std::string runtime::gpu::GPU_Emitter::emit_v0_EmbeddingBag(EMIT_ARGS)
+{
+    throw unsupported_op("Unsupported op '" + node->description() + "'");
+}
+
+std::string runtime::gpu::GPU_Emitter::emit_v0_EmbeddingBagBackprop(EMIT_ARGS)
+{
+    throw unsupported_op("Unsupported op '" + node->description() + "'");
+}
+
 std::string runtime::gpu::GPU_Emitter::emit_v0_EmbeddingLookup(EMIT_ARGS)
 {
     throw unsupported_op("Unsupported op '" + node->description() + "'");
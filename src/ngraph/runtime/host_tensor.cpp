@@ -30,8 +30,10 @@ static const size_t alignment = 64;
 runtime::HostTensor::HostTensor(const ngraph::element::Type& element_type,
                                 const Shape& shape,
                                 void* memory_pointer,
+                                Allocator* allocator,
                                 const string& name)
     : runtime::Tensor(std::make_shared<ngraph::descriptor::Tensor>(element_type, shape, name))
+    , m_allocator(allocator)
     , m_allocated_buffer_pool(nullptr)
     , m_aligned_buffer_pool(nullptr)
 
@@ -48,7 +50,9 @@ runtime::HostTensor::HostTensor(const ngraph::element::Type& element_type,
     else if (m_buffer_size > 0)
     {
         size_t allocation_size = m_buffer_size + alignment;
-        m_allocated_buffer_pool = static_cast<char*>(ngraph_malloc(allocation_size));
+        m_allocated_buffer_pool =
+            static_cast<char*>(m_allocator ? m_allocator->malloc(allocation_size, alignment)
+                                           : ngraph_malloc(allocation_size));
         m_aligned_buffer_pool = m_allocated_buffer_pool;
         size_t mod = size_t(m_aligned_buffer_pool) % alignment;
         if (mod != 0)
@@ -58,22 +62,38 @@ runtime::HostTensor::HostTensor(const ngraph::element::Type& element_type,
     }
 }
 
+runtime::HostTensor::HostTensor(const ngraph::element::Type& element_type,
+                                const Shape& shape,
+                                void* memory_pointer,
+                                const string& name)
+    : HostTensor(element_type, shape, memory_pointer, nullptr, name)
+{
+}
+
 runtime::HostTensor::HostTensor(const ngraph::element::Type& element_type,
                                 const Shape& shape,
                                 const string& name)
-    : HostTensor(element_type, shape, nullptr, name)
+    : HostTensor(element_type, shape, nullptr, nullptr, name)
 {
 }
 
 runtime::HostTensor::HostTensor(const ngraph::element::Type& element_type, const Shape& shape)
-    : HostTensor(element_type, shape, nullptr, "")
+    : HostTensor(element_type, shape, nullptr, nullptr, "")
 {
 }
 
 runtime::HostTensor::HostTensor(const ngraph::element::Type& element_type,
                                 const Shape& shape,
                                 void* memory_pointer)
-    : HostTensor(element_type, shape, memory_pointer, "")
+    : HostTensor(element_type, shape, memory_pointer, nullptr, "")
+{
+}
+
+runtime::HostTensor::HostTensor(const ngraph::element::Type& element_type,
+                                const Shape& shape,
+                                const string& name,
+                                Allocator* allocator)
+    : HostTensor(element_type, shape, nullptr, allocator, name)
 {
 }
 
@@ -81,7 +101,14 @@ runtime::HostTensor::~HostTensor()
 {
     if (m_allocated_buffer_pool != nullptr)
     {
-        ngraph_free(m_allocated_buffer_pool);
+        if (m_allocator)
+        {
+            m_allocator->free(m_allocated_buffer_pool);
+        }
+        else
+        {
+            ngraph_free(m_allocated_buffer_pool);
+        }
     }
 }
 
@@ -42,6 +42,12 @@ public:
                const std::string& name);
     HostTensor(const ngraph::element::Type& element_type, const Shape& shape);
     HostTensor(const ngraph::element::Type& element_type, const Shape& shape, void* memory_pointer);
+    /// \brief Creates a tensor whose buffer is obtained from allocator. The allocator must
+    ///        outlive the tensor.
+    HostTensor(const ngraph::element::Type& element_type,
+               const Shape& shape,
+               const std::string& name,
+               Allocator* allocator);
     virtual ~HostTensor() override;
 
     char* get_data_ptr();
@@ -73,7 +79,13 @@ private:
     HostTensor(const HostTensor&) = delete;
     HostTensor(HostTensor&&) = delete;
     HostTensor& operator=(const HostTensor&) = delete;
+    HostTensor(const ngraph::element::Type& element_type,
+               const Shape& shape,
+               void* memory_pointer,
+               Allocator* allocator,
+               const std::string& name);
 
+    Allocator* m_allocator;
     char* m_allocated_buffer_pool;
     char* m_aligned_buffer_pool;
     size_t m_buffer_size;
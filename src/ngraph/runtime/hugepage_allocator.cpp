@@ -0,0 +1,169 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "ngraph/check.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/hugepage_allocator.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr size_t runtime::HugePageAllocator::s_huge_page_size;
+
+runtime::HugePageAllocator::HugePageAllocator(size_t min_size)
+    : m_min_size(min_size)
+{
+}
+
+runtime::HugePageAllocator::~HugePageAllocator()
+{
+    for (auto& mapping : m_mappings)
+    {
+#if defined(__linux__)
+        munmap(mapping.first, mapping.second.mapped_size);
+#endif
+    }
+    for (auto& allocation : m_small_allocations)
+    {
+        std::free(allocation.first);
+    }
+}
+
+void* runtime::HugePageAllocator::malloc(size_t size, size_t alignment)
+{
+    size = std::max<size_t>(size, 1);
+#if defined(__linux__)
+    if (size >= m_min_size)
+    {
+        size_t mapped_size = ((size + s_huge_page_size - 1) / s_huge_page_size) * s_huge_page_size;
+        bool huge_tlb = true;
+        void* ptr = mmap(nullptr,
+                         mapped_size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                         -1,
+                         0);
+        if (ptr == MAP_FAILED)
+        {
+            // No explicitly reserved huge pages are available; ask for transparent ones.
+            // Those only back 2MB-aligned ranges, so map an extra huge page and trim the
+            // mapping to an aligned start.
+            huge_tlb = false;
+            size_t padded_size = mapped_size + s_huge_page_size;
+            void* base = mmap(nullptr,
+                              padded_size,
+                              PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS,
+                              -1,
+                              0);
+            if (base == MAP_FAILED)
+            {
+                throw ngraph_error("mmap failed to allocate memory of size " + to_string(size));
+            }
+            char* start = static_cast<char*>(base);
+            char* aligned = reinterpret_cast<char*>(
+                ((reinterpret_cast<uintptr_t>(start) + s_huge_page_size - 1) / s_huge_page_size) *
+                s_huge_page_size);
+            if (aligned > start)
+            {
+                munmap(start, aligned - start);
+            }
+            size_t tail = (start + padded_size) - (aligned + mapped_size);
+            if (tail > 0)
+            {
+                munmap(aligned + mapped_size, tail);
+            }
+            ptr = aligned;
+            if (madvise(ptr, mapped_size, MADV_HUGEPAGE) != 0)
+            {
+                NGRAPH_DEBUG << "madvise(MADV_HUGEPAGE) failed, using regular pages";
+            }
+        }
+
+        lock_guard<mutex> lock(m_mutex);
+        m_mappings[ptr] = Mapping{size, mapped_size, huge_tlb};
+        m_stats.num_allocations++;
+        m_stats.bytes_in_use += size;
+        m_stats.peak_bytes_in_use = std::max(m_stats.peak_bytes_in_use, m_stats.bytes_in_use);
+        m_stats.bytes_reserved += mapped_size;
+        if (huge_tlb)
+        {
+            m_stats.bytes_in_huge_pages += mapped_size;
+        }
+        return ptr;
+    }
+#endif
+    void* ptr = get_default_allocator()->malloc(size, alignment);
+
+    lock_guard<mutex> lock(m_mutex);
+    m_small_allocations[ptr] = size;
+    m_stats.num_allocations++;
+    m_stats.bytes_in_use += size;
+    m_stats.peak_bytes_in_use = std::max(m_stats.peak_bytes_in_use, m_stats.bytes_in_use);
+    m_stats.bytes_reserved += size;
+    return ptr;
+}
+
+void runtime::HugePageAllocator::free(void* ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    unique_lock<mutex> lock(m_mutex);
+    m_stats.num_frees++;
+    auto small = m_small_allocations.find(ptr);
+    if (small != m_small_allocations.end())
+    {
+        m_stats.bytes_in_use -= small->second;
+        m_stats.bytes_reserved -= small->second;
+        m_small_allocations.erase(small);
+        lock.unlock();
+        get_default_allocator()->free(ptr);
+        return;
+    }
+
+    auto it = m_mappings.find(ptr);
+    NGRAPH_CHECK(it != m_mappings.end(), "HugePageAllocator: unknown pointer freed");
+    Mapping mapping = it->second;
+    m_mappings.erase(it);
+    m_stats.bytes_in_use -= mapping.requested_size;
+    m_stats.bytes_reserved -= mapping.mapped_size;
+    if (mapping.huge_tlb)
+    {
+        m_stats.bytes_in_huge_pages -= mapping.mapped_size;
+    }
+    lock.unlock();
+#if defined(__linux__)
+    munmap(ptr, mapping.mapped_size);
+#endif
+}
+
+runtime::AllocatorStats runtime::HugePageAllocator::get_stats() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_stats;
+}
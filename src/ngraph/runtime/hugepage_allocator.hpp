@@ -0,0 +1,68 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+
+#include "ngraph/runtime/allocator.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class HugePageAllocator;
+    }
+}
+
+/// \brief Allocator that backs large allocations with huge pages to cut TLB misses on big
+///        memory pools and weights.
+///
+/// Allocations of at least min_size bytes are mapped with MAP_HUGETLB when the system has
+/// huge pages reserved, and otherwise mapped normally and marked with MADV_HUGEPAGE so that
+/// transparent huge pages can back them. Smaller allocations go to the default allocator.
+/// On platforms without mmap every allocation goes to the default allocator.
+class NGRAPH_API ngraph::runtime::HugePageAllocator : public ngraph::runtime::Allocator
+{
+public:
+    static constexpr size_t s_huge_page_size = 2 * 1024 * 1024;
+
+    explicit HugePageAllocator(size_t min_size = s_huge_page_size);
+    ~HugePageAllocator() override;
+
+    void* malloc(size_t size, size_t alignment) override;
+    void free(void* ptr) override;
+
+    AllocatorStats get_stats() const;
+
+private:
+    struct Mapping
+    {
+        size_t requested_size;
+        size_t mapped_size;
+        bool huge_tlb;
+    };
+
+    HugePageAllocator(const HugePageAllocator&) = delete;
+    HugePageAllocator& operator=(const HugePageAllocator&) = delete;
+
+    size_t m_min_size;
+    mutable std::mutex m_mutex;
+    std::unordered_map<void*, Mapping> m_mappings;
+    std::unordered_map<void*, size_t> m_small_allocations;
+    AllocatorStats m_stats;
+};
@@ -48,7 +48,7 @@ runtime::interpreter::INTBackend::INTBackend(const vector<string>& unsupported_o
 shared_ptr<runtime::Tensor>
     runtime::interpreter::INTBackend::create_tensor(const element::Type& type, const Shape& shape)
 {
-    return make_shared<runtime::HostTensor>(type, shape);
+    return make_shared<runtime::HostTensor>(type, shape, "", m_allocator);
 }
 
 shared_ptr<runtime::Tensor> runtime::interpreter::INTBackend::create_tensor(
@@ -61,7 +61,9 @@ shared_ptr<runtime::Executable>
     runtime::interpreter::INTBackend::compile(shared_ptr<Function> function,
                                               bool enable_performance_collection)
 {
-    return make_shared<INTExecutable>(function, enable_performance_collection);
+    auto exec = make_shared<INTExecutable>(function, enable_performance_collection);
+    exec->m_allocator = m_allocator;
+    return exec;
 }
 
 bool runtime::interpreter::INTBackend::is_supported(const Node& node) const
@@ -92,7 +94,9 @@ std::shared_ptr<runtime::Executable> runtime::interpreter::INTBackend::load(istr
             {
                 vector<char> buffer = reader.read(info);
                 string model_string = string(buffer.data(), buffer.size());
-                exec = shared_ptr<INTExecutable>(new INTExecutable(model_string));
+                auto int_exec = shared_ptr<INTExecutable>(new INTExecutable(model_string));
+                int_exec->m_allocator = m_allocator;
+                exec = int_exec;
                 break;
             }
         }
@@ -112,3 +116,24 @@ bool runtime::interpreter::INTBackend::set_config(const map<string, string>& con
     }
     return rc;
 }
+
+runtime::Allocator* runtime::interpreter::INTBackend::get_host_memory_allocator()
+{
+    if (!m_allocator)
+    {
+        return runtime::get_default_allocator();
+    }
+    return m_allocator;
+}
+
+void runtime::interpreter::INTBackend::set_host_memory_allocator(Allocator* allocator)
+{
+    if (m_allocator)
+    {
+        // Tensors allocated with the existing allocator might still be around and expect it
+        // to be available for freeing. We cannot switch to the new allocator
+        throw ngraph_error(
+            "Allocator already exists. Changing allocators mid-execution is not permitted.");
+    }
+    m_allocator = allocator;
+}
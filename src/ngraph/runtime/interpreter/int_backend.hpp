@@ -62,6 +62,10 @@ public:
 
     bool set_config(const std::map<std::string, std::string>& config, std::string& error) override;
 
+    Allocator* get_host_memory_allocator() override;
+    void set_host_memory_allocator(Allocator* allocator) override;
+
 private:
     std::set<std::string> m_unsupported_op_name_list;
+    Allocator* m_allocator = nullptr;
 };
@@ -83,6 +83,7 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
     {
         m_nodes.push_back(node);
     }
+    m_latency_profiler.set_ops(vector<shared_ptr<const Node>>(m_nodes.begin(), m_nodes.end()));
     set_parameters_and_results(*m_function);
 }
 
@@ -95,6 +96,7 @@ runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_stri
     {
         m_nodes.push_back(node);
     }
+    m_latency_profiler.set_ops(vector<shared_ptr<const Node>>(m_nodes.begin(), m_nodes.end()));
     set_parameters_and_results(*m_function);
 }
 
@@ -102,6 +104,8 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
                                                const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
     runtime::event::Duration d1("call", "Interpreter");
+    bool profile_latency = m_latency_profiler.is_enabled();
+    uint64_t call_start = profile_latency ? CycleClock::now() : 0;
 
     // convert inputs to HostTensor
     vector<shared_ptr<HostTensor>> func_inputs;
@@ -148,8 +152,9 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
     }
 
     // for each ordered op in the graph
-    for (auto op : m_nodes)
+    for (size_t op_index = 0; op_index < m_nodes.size(); op_index++)
     {
+        auto& op = m_nodes[op_index];
         runtime::event::Duration d2(op->description(), "Interpreter");
         if (op->is_parameter())
         {
@@ -176,7 +181,7 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
                 const Shape& shape = op->get_output_shape(i);
                 const element::Type& type = op->get_output_element_type(i);
                 string name = op->output(i).get_tensor().get_name();
-                host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
+                host_tensor = make_shared<runtime::HostTensor>(type, shape, name, m_allocator);
                 tensor_map.insert({tensor, host_tensor});
             }
             else
@@ -214,7 +219,12 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         {
             m_timer_map[op].start();
         }
+        uint64_t op_start = profile_latency ? CycleClock::now() : 0;
         generate_calls(type, *op.get(), op_outputs, op_inputs);
+        if (profile_latency)
+        {
+            m_latency_profiler.record_op(op_index, CycleClock::now() - op_start);
+        }
         if (m_performance_counters_enabled)
         {
             m_timer_map[op].stop();
@@ -225,6 +235,10 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         }
     }
 
+    if (profile_latency)
+    {
+        m_latency_profiler.record_call(CycleClock::now() - call_start);
+    }
     return true;
 }
 
@@ -59,6 +59,7 @@
 #include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/divide.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/embedding_bag.hpp"
 #include "ngraph/runtime/reference/embedding_lookup.hpp"
 #include "ngraph/runtime/reference/equal.hpp"
 #include "ngraph/runtime/reference/erf.hpp"
@@ -185,6 +186,8 @@ protected:
     std::vector<std::shared_ptr<Node>> m_nodes;
     std::unordered_map<const Node*, std::shared_ptr<State>> m_states;
     std::set<std::string> m_unsupported_op_name_list;
+    // Allocator for intermediate tensors, set by INTBackend; system allocation if null
+    Allocator* m_allocator = nullptr;
 
     static OP_TYPEID get_typeid(const Node& node);
 
@@ -781,6 +784,100 @@ protected:
             throw unsupported_op("Unsupported op '" + node.description() + "'");
             break;
         }
+        case OP_TYPEID::EmbeddingBag:
+        {
+            const op::EmbeddingBag* bag = static_cast<const op::EmbeddingBag*>(&node);
+            size_t num_embeddings = node.get_input_shape(0).at(0);
+            size_t embedding_dim = node.get_input_shape(0).at(1);
+            size_t indices_count = shape_size(node.get_input_shape(1));
+            size_t bags = shape_size(node.get_input_shape(2));
+            const T* per_sample_weights =
+                bag->has_per_sample_weights() ? args[3]->get_data_ptr<const T>() : nullptr;
+            if (node.get_input_element_type(1) == element::i64)
+            {
+                reference::embedding_bag<T, int64_t>(args[0]->get_data_ptr<const T>(),
+                                                     args[1]->get_data_ptr<const int64_t>(),
+                                                     args[2]->get_data_ptr<const int64_t>(),
+                                                     per_sample_weights,
+                                                     out[0]->get_data_ptr<T>(),
+                                                     num_embeddings,
+                                                     embedding_dim,
+                                                     indices_count,
+                                                     bags,
+                                                     bag->get_reduction());
+            }
+            else if (node.get_input_element_type(1) == element::i32)
+            {
+                reference::embedding_bag<T, int32_t>(args[0]->get_data_ptr<const T>(),
+                                                     args[1]->get_data_ptr<const int32_t>(),
+                                                     args[2]->get_data_ptr<const int32_t>(),
+                                                     per_sample_weights,
+                                                     out[0]->get_data_ptr<T>(),
+                                                     num_embeddings,
+                                                     embedding_dim,
+                                                     indices_count,
+                                                     bags,
+                                                     bag->get_reduction());
+            }
+            else
+            {
+                throw ngraph_error("Unexpected index type in EmbeddingBag");
+            }
+            break;
+        }
+        case OP_TYPEID::EmbeddingBagBackprop:
+        {
+            const op::EmbeddingBagBackprop* bprop =
+                static_cast<const op::EmbeddingBagBackprop*>(&node);
+            size_t num_embeddings = node.get_input_shape(0).at(0);
+            size_t embedding_dim = node.get_input_shape(0).at(1);
+            size_t indices_count = shape_size(node.get_input_shape(1));
+            size_t bags = shape_size(node.get_input_shape(2));
+            const T* per_sample_weights = nullptr;
+            T* d_per_sample_weights = nullptr;
+            if (bprop->has_per_sample_weights())
+            {
+                per_sample_weights = args[4]->get_data_ptr<const T>();
+                d_per_sample_weights = out[1]->get_data_ptr<T>();
+            }
+            if (node.get_input_element_type(1) == element::i64)
+            {
+                reference::embedding_bag_backprop<T, int64_t>(
+                    args[0]->get_data_ptr<const T>(),
+                    args[1]->get_data_ptr<const int64_t>(),
+                    args[2]->get_data_ptr<const int64_t>(),
+                    args[3]->get_data_ptr<const T>(),
+                    per_sample_weights,
+                    out[0]->get_data_ptr<T>(),
+                    d_per_sample_weights,
+                    num_embeddings,
+                    embedding_dim,
+                    indices_count,
+                    bags,
+                    bprop->get_reduction());
+            }
+            else if (node.get_input_element_type(1) == element::i32)
+            {
+                reference::embedding_bag_backprop<T, int32_t>(
+                    args[0]->get_data_ptr<const T>(),
+                    args[1]->get_data_ptr<const int32_t>(),
+                    args[2]->get_data_ptr<const int32_t>(),
+                    args[3]->get_data_ptr<const T>(),
+                    per_sample_weights,
+                    out[0]->get_data_ptr<T>(),
+                    d_per_sample_weights,
+                    num_embeddings,
+                    embedding_dim,
+                    indices_count,
+                    bags,
+                    bprop->get_reduction());
+            }
+            else
+            {
+                throw ngraph_error("Unexpected index type in EmbeddingBagBackprop");
+            }
+            break;
+        }
         case OP_TYPEID::EmbeddingLookup:
         {
             const op::EmbeddingLookup* embed = static_cast<const op::EmbeddingLookup*>(&node);
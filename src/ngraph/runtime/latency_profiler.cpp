@@ -0,0 +1,287 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <thread>
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/runtime/latency_profiler.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr size_t runtime::LatencyHistogram::s_num_buckets;
+
+namespace
+{
+    struct ClockReference
+    {
+        ClockReference()
+            : ticks(runtime::CycleClock::now())
+            , time(chrono::steady_clock::now())
+        {
+        }
+        uint64_t ticks;
+        chrono::steady_clock::time_point time;
+    };
+
+    const ClockReference s_clock_reference;
+}
+
+static double calibrate_nanoseconds_per_tick()
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    // The longer the interval since the reference point, the more precise the ratio. Wait
+    // until at least 10ms have passed when asked right after start-up.
+    auto min_interval = chrono::milliseconds(10);
+    auto elapsed = chrono::steady_clock::now() - s_clock_reference.time;
+    if (elapsed < min_interval)
+    {
+        this_thread::sleep_for(min_interval - elapsed);
+    }
+    uint64_t ticks = runtime::CycleClock::now();
+    elapsed = chrono::steady_clock::now() - s_clock_reference.time;
+    return static_cast<double>(chrono::duration_cast<chrono::nanoseconds>(elapsed).count()) /
+           static_cast<double>(ticks - s_clock_reference.ticks);
+#else
+    return static_cast<double>(chrono::steady_clock::period::num) * 1e9 /
+           chrono::steady_clock::period::den;
+#endif
+}
+
+double runtime::CycleClock::nanoseconds_per_tick()
+{
+    static const double s_nanoseconds_per_tick = calibrate_nanoseconds_per_tick();
+    return s_nanoseconds_per_tick;
+}
+
+void runtime::LatencyHistogram::reset()
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket.store(0, memory_order_relaxed);
+    }
+    m_count.store(0, memory_order_relaxed);
+    m_sum.store(0, memory_order_relaxed);
+    m_max.store(0, memory_order_relaxed);
+}
+
+size_t runtime::LatencyHistogram::bucket_index(uint64_t ticks)
+{
+    if (ticks < s_sub_buckets)
+    {
+        return static_cast<size_t>(ticks);
+    }
+#if defined(__GNUC__)
+    size_t exponent = 63 - static_cast<size_t>(__builtin_clzll(ticks));
+#else
+    size_t exponent = 0;
+    while (ticks >> (exponent + 1))
+    {
+        exponent++;
+    }
+#endif
+    if (exponent >= s_max_exponent)
+    {
+        return s_num_buckets - 1;
+    }
+    size_t sub_bucket = (ticks >> (exponent - s_sub_bucket_bits)) & (s_sub_buckets - 1);
+    return s_sub_buckets + (exponent - s_sub_bucket_bits) * s_sub_buckets + sub_bucket;
+}
+
+uint64_t runtime::LatencyHistogram::bucket_lower_bound(size_t index)
+{
+    if (index < s_sub_buckets)
+    {
+        return index;
+    }
+    size_t exponent = (index - s_sub_buckets) / s_sub_buckets + s_sub_bucket_bits;
+    uint64_t sub_bucket = (index - s_sub_buckets) % s_sub_buckets;
+    return (uint64_t(1) << exponent) + (sub_bucket << (exponent - s_sub_bucket_bits));
+}
+
+uint64_t runtime::LatencyHistogram::percentile(double q) const
+{
+    uint64_t total = count();
+    if (total == 0)
+    {
+        return 0;
+    }
+    uint64_t rank = static_cast<uint64_t>(ceil(q * total));
+    if (rank >= total)
+    {
+        return max();
+    }
+    rank = std::max<uint64_t>(1, rank);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < s_num_buckets; i++)
+    {
+        seen += m_buckets[i].load(memory_order_relaxed);
+        if (seen >= rank)
+        {
+            // Report the middle of the bucket, but never more than the largest value seen
+            uint64_t lower = bucket_lower_bound(i);
+            uint64_t upper = i + 1 < s_num_buckets ? bucket_lower_bound(i + 1) : max() + 1;
+            return std::min(lower + (upper - lower) / 2, max());
+        }
+    }
+    return max();
+}
+
+runtime::LatencyProfiler::LatencyProfiler()
+{
+    set_enabled(getenv_bool("NGRAPH_LATENCY_PROFILING"));
+}
+
+void runtime::LatencyProfiler::set_enabled(bool enabled)
+{
+    if (enabled)
+    {
+        // Calibration may sleep, so it is done here rather than for every executable
+        CycleClock::nanoseconds_per_tick();
+    }
+    lock_guard<mutex> lock(m_mutex);
+    if (enabled)
+    {
+        allocate_histograms();
+    }
+    m_enabled.store(enabled, memory_order_release);
+}
+
+void runtime::LatencyProfiler::set_ops(const vector<shared_ptr<const Node>>& ops)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_ops = ops;
+    m_op_histograms.clear();
+    if (m_enabled)
+    {
+        allocate_histograms();
+    }
+}
+
+void runtime::LatencyProfiler::allocate_histograms()
+{
+    while (m_op_histograms.size() < m_ops.size())
+    {
+        m_op_histograms.emplace_back(new LatencyHistogram());
+    }
+}
+
+runtime::LatencyStatistics
+    runtime::LatencyProfiler::get_statistics(const LatencyHistogram& histogram,
+                                             const shared_ptr<const Node>& node) const
+{
+    double us_per_tick = CycleClock::nanoseconds_per_tick() / 1000;
+    LatencyStatistics statistics;
+    statistics.node = node;
+    statistics.count = histogram.count();
+    if (statistics.count > 0)
+    {
+        statistics.mean_us = histogram.sum() * us_per_tick / statistics.count;
+        statistics.p50_us = histogram.percentile(0.5) * us_per_tick;
+        statistics.p99_us = histogram.percentile(0.99) * us_per_tick;
+        statistics.max_us = histogram.max() * us_per_tick;
+    }
+    return statistics;
+}
+
+runtime::LatencyStatistics runtime::LatencyProfiler::get_call_statistics() const
+{
+    return get_statistics(m_call_histogram, nullptr);
+}
+
+vector<runtime::LatencyStatistics> runtime::LatencyProfiler::get_op_statistics() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    vector<LatencyStatistics> statistics;
+    for (size_t i = 0; i < m_op_histograms.size(); i++)
+    {
+        if (m_op_histograms[i]->count() > 0)
+        {
+            statistics.push_back(get_statistics(*m_op_histograms[i], m_ops[i]));
+        }
+    }
+    return statistics;
+}
+
+void runtime::LatencyProfiler::reset()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_call_histogram.reset();
+    for (auto& histogram : m_op_histograms)
+    {
+        histogram->reset();
+    }
+}
+
+static string escape_label(const string& value)
+{
+    string escaped;
+    for (char c : value)
+    {
+        if (c == '\\' || c == '"')
+        {
+            escaped += '\\';
+        }
+        if (c == '\n')
+        {
+            escaped += "\\n";
+            continue;
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+static void write_summary(ostream& out,
+                          const string& metric,
+                          const string& labels,
+                          const runtime::LatencyStatistics& statistics)
+{
+    out << metric << "{" << labels << R"(,quantile="0.5"} )" << statistics.p50_us * 1e-6 << "\n";
+    out << metric << "{" << labels << R"(,quantile="0.99"} )" << statistics.p99_us * 1e-6 << "\n";
+    out << metric << "{" << labels << R"(,quantile="1"} )" << statistics.max_us * 1e-6 << "\n";
+    out << metric << "_sum{" << labels << "} "
+        << statistics.mean_us * statistics.count * 1e-6 << "\n";
+    out << metric << "_count{" << labels << "} " << statistics.count << "\n";
+}
+
+void runtime::LatencyProfiler::write_prometheus(ostream& out, const string& executable) const
+{
+    // The caller's stream keeps its format
+    auto flags = out.flags();
+    auto precision = out.precision(9);
+    string executable_label = R"(executable=")" + escape_label(executable) + R"(")";
+
+    out << "# HELP ngraph_call_latency_seconds Latency of whole calls\n";
+    out << "# TYPE ngraph_call_latency_seconds summary\n";
+    write_summary(out, "ngraph_call_latency_seconds", executable_label, get_call_statistics());
+
+    out << "# HELP ngraph_op_latency_seconds Latency of individual ops\n";
+    out << "# TYPE ngraph_op_latency_seconds summary\n";
+    for (auto& statistics : get_op_statistics())
+    {
+        string labels = executable_label + R"(,op=")" +
+                        escape_label(statistics.node->get_friendly_name()) + R"(",type=")" +
+                        escape_label(statistics.node->description()) + R"(")";
+        write_summary(out, "ngraph_op_latency_seconds", labels, statistics);
+    }
+    out.flags(flags);
+    out.precision(precision);
+}
@@ -0,0 +1,166 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#endif
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    class Node;
+
+    namespace runtime
+    {
+        /// \brief Cheap monotonic timestamps for latency measurements. Reads the time stamp
+        ///        counter on x86 and steady_clock elsewhere. Ticks are only converted to time
+        ///        when statistics are read.
+        class NGRAPH_API CycleClock
+        {
+        public:
+            static uint64_t now()
+            {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+                return __rdtsc();
+#else
+                return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+            }
+
+            /// \brief Duration of one tick, measured against steady_clock since start-up.
+            ///
+            /// Measured on the first call, which waits until at least 10ms have passed since
+            /// start-up; later calls return the same value.
+            static double nanoseconds_per_tick();
+        };
+
+        /// \brief Latency histogram of fixed size that can be updated concurrently.
+        ///
+        /// Values below 8 ticks have a bucket each. Above that, every power of two is split
+        /// into 8 buckets, so percentiles are within 6.25% of the recorded value.
+        class NGRAPH_API LatencyHistogram
+        {
+        public:
+            LatencyHistogram() { reset(); }
+            void record(uint64_t ticks)
+            {
+                m_buckets[bucket_index(ticks)].fetch_add(1, std::memory_order_relaxed);
+                m_count.fetch_add(1, std::memory_order_relaxed);
+                m_sum.fetch_add(ticks, std::memory_order_relaxed);
+                uint64_t max = m_max.load(std::memory_order_relaxed);
+                while (ticks > max &&
+                       !m_max.compare_exchange_weak(max, ticks, std::memory_order_relaxed))
+                {
+                }
+            }
+            void reset();
+
+            uint64_t count() const { return m_count.load(std::memory_order_relaxed); }
+            uint64_t sum() const { return m_sum.load(std::memory_order_relaxed); }
+            uint64_t max() const { return m_max.load(std::memory_order_relaxed); }
+            /// \brief Smallest recorded value, in ticks, that at least fraction q of the
+            ///        recorded values do not exceed
+            uint64_t percentile(double q) const;
+
+        private:
+            static constexpr size_t s_sub_bucket_bits = 3;
+            static constexpr size_t s_sub_buckets = size_t(1) << s_sub_bucket_bits;
+            // Values of 2^48 ticks and above share the last bucket
+            static constexpr size_t s_max_exponent = 48;
+            static constexpr size_t s_num_buckets =
+                s_sub_buckets + (s_max_exponent - s_sub_bucket_bits) * s_sub_buckets;
+
+            static size_t bucket_index(uint64_t ticks);
+            static uint64_t bucket_lower_bound(size_t index);
+
+            std::array<std::atomic<uint64_t>, s_num_buckets> m_buckets;
+            std::atomic<uint64_t> m_count;
+            std::atomic<uint64_t> m_sum;
+            std::atomic<uint64_t> m_max;
+        };
+
+        /// \brief Latency summary of an op or of whole calls, in microseconds
+        struct LatencyStatistics
+        {
+            /// The op, or nullptr for whole calls
+            std::shared_ptr<const Node> node;
+            uint64_t count = 0;
+            double mean_us = 0;
+            double p50_us = 0;
+            double p99_us = 0;
+            double max_us = 0;
+        };
+
+        /// \brief Per-op and per-call latency histograms of an Executable
+        class NGRAPH_API LatencyProfiler
+        {
+        public:
+            /// \brief Enabled by default if NGRAPH_LATENCY_PROFILING is set. Calibrates
+            ///        CycleClock, so reading statistics later never has to wait.
+            LatencyProfiler();
+
+            /// \brief Turns recording on or off. May be called while calls are running.
+            void set_enabled(bool enabled);
+            bool is_enabled() const { return m_enabled.load(std::memory_order_acquire); }
+            /// \brief Sets the ops that record_op indexes into. Called by the backend before
+            ///        the first call.
+            void set_ops(const std::vector<std::shared_ptr<const Node>>& ops);
+
+            void record_call(uint64_t ticks) { m_call_histogram.record(ticks); }
+            void record_op(size_t op_index, uint64_t ticks)
+            {
+                m_op_histograms[op_index]->record(ticks);
+            }
+
+            LatencyStatistics get_call_statistics() const;
+            /// \brief Statistics of every op that has been timed at least once
+            std::vector<LatencyStatistics> get_op_statistics() const;
+            void reset();
+            /// \brief Writes the statistics as Prometheus summaries in the text exposition
+            ///        format, labelled with the executable name
+            void write_prometheus(std::ostream& out, const std::string& executable) const;
+
+        private:
+            void allocate_histograms();
+            LatencyStatistics get_statistics(const LatencyHistogram& histogram,
+                                             const std::shared_ptr<const Node>& node) const;
+
+            std::atomic<bool> m_enabled{false};
+            // Guards m_ops and m_op_histograms against set_ops and set_enabled
+            mutable std::mutex m_mutex;
+            LatencyHistogram m_call_histogram;
+            std::vector<std::shared_ptr<const Node>> m_ops;
+            // Allocated when profiling is first enabled, so an executable that is never
+            // profiled does not pay for them
+            std::vector<std::unique_ptr<LatencyHistogram>> m_op_histograms;
+        };
+    }
+}
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
 #include "ngraph/shape.hpp"
@@ -241,6 +243,59 @@ namespace ngraph
                 default: reference::reshape(in, out, in_shape, in_axis_order, out_shape); break;
                 }
             }
+
+            /// \brief Computes elements [begin, end) of the output of reshape, so disjoint
+            ///        ranges can be computed on different threads. out points at the start of
+            ///        the whole output.
+            template <typename T>
+            void reshape_range(const T* in,
+                               T* out,
+                               const Shape& in_shape,
+                               const AxisVector& in_axis_order,
+                               size_t begin,
+                               size_t end)
+            {
+                size_t rank = in_shape.size();
+                if (begin >= end)
+                {
+                    return;
+                }
+                if (rank == 0)
+                {
+                    *out = *in;
+                    return;
+                }
+                Strides in_strides = row_major_strides(in_shape);
+                std::vector<size_t> size(rank);
+                std::vector<size_t> stride(rank);
+                std::vector<size_t> index(rank);
+                for (size_t i = 0; i < rank; i++)
+                {
+                    size[i] = in_shape[in_axis_order[i]];
+                    stride[i] = in_strides[in_axis_order[i]];
+                }
+                size_t offset = 0;
+                for (size_t i = rank, rest = begin; i-- > 0;)
+                {
+                    index[i] = rest % size[i];
+                    rest /= size[i];
+                    offset += index[i] * stride[i];
+                }
+                for (size_t o = begin; o < end; o++)
+                {
+                    out[o] = in[offset];
+                    for (size_t i = rank; i-- > 0;)
+                    {
+                        offset += stride[i];
+                        if (++index[i] < size[i])
+                        {
+                            break;
+                        }
+                        offset -= size[i] * stride[i];
+                        index[i] = 0;
+                    }
+                }
+            }
         }
     }
 }
@@ -0,0 +1,165 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <iterator>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/pool_allocator.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr size_t runtime::PoolAllocator::s_min_block_size;
+constexpr size_t runtime::PoolAllocator::s_default_max_block_size;
+constexpr size_t runtime::PoolAllocator::s_default_max_cached_bytes;
+
+runtime::PoolAllocator::PoolAllocator(Allocator* upstream,
+                                      size_t max_block_size,
+                                      size_t max_cached_bytes)
+    : m_upstream(upstream ? upstream : get_default_allocator())
+    , m_max_block_size(max_block_size)
+    , m_max_cached_bytes(max_cached_bytes)
+    , m_free_blocks(get_size_class(max_block_size) + 1)
+{
+}
+
+runtime::PoolAllocator::~PoolAllocator()
+{
+    release_cached();
+}
+
+size_t runtime::PoolAllocator::get_size_class(size_t size)
+{
+    size_t size_class = 0;
+    while (get_class_size(size_class) < size)
+    {
+        size_class++;
+    }
+    return size_class;
+}
+
+size_t runtime::PoolAllocator::get_class_size(size_t size_class)
+{
+    return s_min_block_size << size_class;
+}
+
+void* runtime::PoolAllocator::malloc(size_t size, size_t alignment)
+{
+    size = std::max<size_t>(size, 1);
+    if (size > m_max_block_size)
+    {
+        void* ptr = m_upstream->malloc(size, alignment);
+        lock_guard<mutex> lock(m_mutex);
+        m_blocks[ptr] = Block{ptr, size, alignment};
+        m_stats.num_allocations++;
+        m_stats.bytes_in_use += size;
+        m_stats.peak_bytes_in_use = std::max(m_stats.peak_bytes_in_use, m_stats.bytes_in_use);
+        m_stats.bytes_reserved += size;
+        return ptr;
+    }
+
+    size_t size_class = get_size_class(size);
+    size_t block_size = get_class_size(size_class);
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stats.num_allocations++;
+        // A block is only guaranteed the alignment it was first allocated with, so free
+        // blocks are matched on size class and alignment, most recently freed first.
+        auto& free_blocks = m_free_blocks[size_class];
+        auto it = find_if(free_blocks.rbegin(), free_blocks.rend(), [alignment](const Block& b) {
+            return b.alignment == alignment;
+        });
+        if (it != free_blocks.rend())
+        {
+            void* ptr = it->ptr;
+            free_blocks.erase(std::next(it).base());
+            m_cached_bytes -= block_size;
+            m_blocks[ptr] = Block{ptr, block_size, alignment};
+            m_stats.num_reused++;
+            m_stats.bytes_in_use += block_size;
+            m_stats.peak_bytes_in_use =
+                std::max(m_stats.peak_bytes_in_use, m_stats.bytes_in_use);
+            return ptr;
+        }
+    }
+
+    // Nothing cached for this size class; the upstream call is made without holding the lock.
+    void* ptr = m_upstream->malloc(block_size, alignment);
+    lock_guard<mutex> lock(m_mutex);
+    m_blocks[ptr] = Block{ptr, block_size, alignment};
+    m_stats.bytes_in_use += block_size;
+    m_stats.peak_bytes_in_use = std::max(m_stats.peak_bytes_in_use, m_stats.bytes_in_use);
+    m_stats.bytes_reserved += block_size;
+    return ptr;
+}
+
+void runtime::PoolAllocator::free(void* ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        auto it = m_blocks.find(ptr);
+        NGRAPH_CHECK(it != m_blocks.end(), "PoolAllocator: unknown pointer freed");
+        Block block = it->second;
+        size_t block_size = block.size;
+        m_blocks.erase(it);
+        m_stats.num_frees++;
+        m_stats.bytes_in_use -= block_size;
+        size_t size_class = get_size_class(block_size);
+        if (size_class < m_free_blocks.size() && get_class_size(size_class) == block_size &&
+            m_cached_bytes + block_size <= m_max_cached_bytes)
+        {
+            m_free_blocks[size_class].push_back(block);
+            m_cached_bytes += block_size;
+            return;
+        }
+        m_stats.bytes_reserved -= block_size;
+    }
+    m_upstream->free(ptr);
+}
+
+void runtime::PoolAllocator::release_cached()
+{
+    vector<void*> released;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        for (auto& free_blocks : m_free_blocks)
+        {
+            for (auto& block : free_blocks)
+            {
+                released.push_back(block.ptr);
+            }
+            free_blocks.clear();
+        }
+        m_stats.bytes_reserved -= m_cached_bytes;
+        m_cached_bytes = 0;
+    }
+    for (void* ptr : released)
+    {
+        m_upstream->free(ptr);
+    }
+}
+
+runtime::AllocatorStats runtime::PoolAllocator::get_stats() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_stats;
+}
@@ -0,0 +1,88 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/runtime/allocator.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class PoolAllocator;
+    }
+}
+
+/// \brief Allocator that recycles freed blocks instead of returning them to the system.
+///
+/// Requests are rounded up to power-of-two size classes. Freed blocks are kept on a free list
+/// per size class and handed out again for later requests of the same class and alignment,
+/// which avoids repeated page faults for tensors and scratch buffers that are created on
+/// every call.
+/// Requests larger than max_block_size bypass the pool. At most max_cached_bytes of free
+/// blocks are kept; anything beyond that is returned to the upstream allocator.
+class NGRAPH_API ngraph::runtime::PoolAllocator : public ngraph::runtime::Allocator
+{
+public:
+    static constexpr size_t s_min_block_size = 256;
+    static constexpr size_t s_default_max_block_size = size_t(1) << 30;
+    static constexpr size_t s_default_max_cached_bytes = size_t(1) << 30;
+
+    /// \param upstream Allocator the blocks are obtained from; the default allocator if null.
+    ///                 Must outlive the pool.
+    PoolAllocator(Allocator* upstream = nullptr,
+                  size_t max_block_size = s_default_max_block_size,
+                  size_t max_cached_bytes = s_default_max_cached_bytes);
+    ~PoolAllocator() override;
+
+    void* malloc(size_t size, size_t alignment) override;
+    void free(void* ptr) override;
+
+    /// \brief Returns all cached free blocks to the upstream allocator
+    void release_cached();
+
+    AllocatorStats get_stats() const;
+
+private:
+    PoolAllocator(const PoolAllocator&) = delete;
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+    // Index of the smallest size class holding size bytes
+    static size_t get_size_class(size_t size);
+    static size_t get_class_size(size_t size_class);
+
+    Allocator* m_upstream;
+    size_t m_max_block_size;
+    size_t m_max_cached_bytes;
+    size_t m_cached_bytes = 0;
+    mutable std::mutex m_mutex;
+    struct Block
+    {
+        void* ptr;
+        size_t size;
+        size_t alignment;
+    };
+
+    // Every block handed out, pooled or not
+    std::unordered_map<void*, Block> m_blocks;
+    // Free blocks of each size class
+    std::vector<std::vector<Block>> m_free_blocks;
+    AllocatorStats m_stats;
+};
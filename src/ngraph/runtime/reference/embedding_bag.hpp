@@ -0,0 +1,208 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "ngraph/except.hpp"
+#include "ngraph/op/embedding_bag.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // Range [begin, end) of indices that make up bag b
+            template <typename U>
+            void embedding_bag_range(const U* offsets,
+                                     size_t b,
+                                     size_t bags,
+                                     size_t indices_count,
+                                     size_t& begin,
+                                     size_t& end)
+            {
+                begin = std::min(static_cast<size_t>(offsets[b]), indices_count);
+                end = b + 1 < bags ? static_cast<size_t>(offsets[b + 1]) : indices_count;
+                end = std::max(begin, std::min(end, indices_count));
+            }
+
+            // Throws unless every index selects one of the num_embeddings rows of weights
+            template <typename U>
+            void check_embedding_bag_indices(const U* indices,
+                                             size_t indices_count,
+                                             size_t num_embeddings)
+            {
+                for (size_t i = 0; i < indices_count; i++)
+                {
+                    if (indices[i] < 0 || static_cast<size_t>(indices[i]) >= num_embeddings)
+                    {
+                        throw ngraph_error("EmbeddingBag index " + std::to_string(indices[i]) +
+                                           " is out of range for " +
+                                           std::to_string(num_embeddings) + " embeddings");
+                    }
+                }
+            }
+
+            // Throws unless the bags start in order. Overlapping bags would share gradient rows.
+            template <typename U>
+            void check_embedding_bag_offsets(const U* offsets, size_t bags)
+            {
+                if (!std::is_sorted(offsets, offsets + bags))
+                {
+                    throw ngraph_error("EmbeddingBag offsets must be non-decreasing");
+                }
+            }
+
+            template <typename T, typename U>
+            void embedding_bag(const T* weights,
+                               const U* indices,
+                               const U* offsets,
+                               const T* per_sample_weights,
+                               T* out,
+                               size_t num_embeddings,
+                               size_t embedding_dim,
+                               size_t indices_count,
+                               size_t bags,
+                               op::EmbeddingBag::Reduction reduction)
+            {
+                check_embedding_bag_indices(indices, indices_count, num_embeddings);
+                check_embedding_bag_offsets(offsets, bags);
+                for (size_t b = 0; b < bags; b++)
+                {
+                    size_t begin, end;
+                    embedding_bag_range(offsets, b, bags, indices_count, begin, end);
+                    T* out_row = out + b * embedding_dim;
+                    std::fill(out_row, out_row + embedding_dim, T(0));
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        const T* row = weights + static_cast<size_t>(indices[i]) * embedding_dim;
+                        T scale = per_sample_weights ? per_sample_weights[i] : T(1);
+                        for (size_t d = 0; d < embedding_dim; d++)
+                        {
+                            if (reduction == op::EmbeddingBag::Reduction::MAX)
+                            {
+                                out_row[d] = i == begin ? row[d] : std::max(out_row[d], row[d]);
+                            }
+                            else
+                            {
+                                out_row[d] += scale * row[d];
+                            }
+                        }
+                    }
+                    if (reduction == op::EmbeddingBag::Reduction::MEAN && end > begin)
+                    {
+                        for (size_t d = 0; d < embedding_dim; d++)
+                        {
+                            out_row[d] /= static_cast<T>(end - begin);
+                        }
+                    }
+                }
+            }
+
+            /// Writes the gradient of every looked-up row to d_rows ([indices_count,
+            /// embedding_dim]) and, when per_sample_weights is given, the gradient of the
+            /// per-sample weights to d_per_sample_weights. With MAX only the first row that
+            /// attains the maximum of a column receives its gradient.
+            template <typename T, typename U>
+            void embedding_bag_backprop(const T* weights,
+                                        const U* indices,
+                                        const U* offsets,
+                                        const T* delta,
+                                        const T* per_sample_weights,
+                                        T* d_rows,
+                                        T* d_per_sample_weights,
+                                        size_t num_embeddings,
+                                        size_t embedding_dim,
+                                        size_t indices_count,
+                                        size_t bags,
+                                        op::EmbeddingBag::Reduction reduction)
+            {
+                check_embedding_bag_indices(indices, indices_count, num_embeddings);
+                check_embedding_bag_offsets(offsets, bags);
+                // Indices outside every bag get no gradient
+                std::fill(d_rows, d_rows + indices_count * embedding_dim, T(0));
+                if (d_per_sample_weights)
+                {
+                    std::fill(d_per_sample_weights, d_per_sample_weights + indices_count, T(0));
+                }
+                std::vector<size_t> argmax(
+                    reduction == op::EmbeddingBag::Reduction::MAX ? embedding_dim : 0);
+                for (size_t b = 0; b < bags; b++)
+                {
+                    size_t begin, end;
+                    embedding_bag_range(offsets, b, bags, indices_count, begin, end);
+                    const T* delta_row = delta + b * embedding_dim;
+
+                    if (reduction == op::EmbeddingBag::Reduction::MAX)
+                    {
+                        std::fill(argmax.begin(), argmax.end(), begin);
+                        for (size_t i = begin + 1; i < end; i++)
+                        {
+                            const T* row =
+                                weights + static_cast<size_t>(indices[i]) * embedding_dim;
+                            for (size_t d = 0; d < embedding_dim; d++)
+                            {
+                                const T* best = weights +
+                                                static_cast<size_t>(indices[argmax[d]]) *
+                                                    embedding_dim;
+                                if (row[d] > best[d])
+                                {
+                                    argmax[d] = i;
+                                }
+                            }
+                        }
+                    }
+
+                    T scale = reduction == op::EmbeddingBag::Reduction::MEAN && end > begin
+                                  ? T(1) / static_cast<T>(end - begin)
+                                  : T(1);
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        T* d_row = d_rows + i * embedding_dim;
+                        T row_scale = per_sample_weights ? per_sample_weights[i] : scale;
+                        for (size_t d = 0; d < embedding_dim; d++)
+                        {
+                            if (reduction == op::EmbeddingBag::Reduction::MAX)
+                            {
+                                d_row[d] = argmax[d] == i ? delta_row[d] : T(0);
+                            }
+                            else
+                            {
+                                d_row[d] = row_scale * delta_row[d];
+                            }
+                        }
+                        if (d_per_sample_weights)
+                        {
+                            const T* row =
+                                weights + static_cast<size_t>(indices[i]) * embedding_dim;
+                            T dot = 0;
+                            for (size_t d = 0; d < embedding_dim; d++)
+                            {
+                                dot += delta_row[d] * row[d];
+                            }
+                            d_per_sample_weights[i] = dot;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
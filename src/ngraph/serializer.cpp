@@ -360,6 +360,23 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
     return ::serialize(func, indent, false);
 }
 
+std::string ngraph::serialize_node_attributes(const Node& node)
+{
+    JSONSerializer serializer;
+    json j = serializer.serialize_node(node);
+    for (auto key : {"name",
+                     "friendly_name",
+                     "inputs",
+                     "outputs",
+                     "control_deps",
+                     "output_shapes",
+                     "provenance_tags"})
+    {
+        j.erase(key);
+    }
+    return j.dump();
+}
+
 shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
 {
     shared_ptr<Function> rc;
@@ -1548,6 +1565,34 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
             node = make_shared<op::Elu>(args[0], alpha);
             break;
         }
+        case OP_TYPEID::EmbeddingBag:
+        {
+            auto reduction = node_js.at("reduction").get<op::EmbeddingBag::Reduction>();
+            if (args.size() == 4)
+            {
+                node = make_shared<op::EmbeddingBag>(args[0], args[1], args[2], args[3], reduction);
+            }
+            else
+            {
+                node = make_shared<op::EmbeddingBag>(args[0], args[1], args[2], reduction);
+            }
+            break;
+        }
+        case OP_TYPEID::EmbeddingBagBackprop:
+        {
+            auto reduction = node_js.at("reduction").get<op::EmbeddingBag::Reduction>();
+            if (args.size() == 5)
+            {
+                node = make_shared<op::EmbeddingBagBackprop>(
+                    args[0], args[1], args[2], args[3], args[4], reduction);
+            }
+            else
+            {
+                node = make_shared<op::EmbeddingBagBackprop>(
+                    args[0], args[1], args[2], args[3], reduction);
+            }
+            break;
+        }
         case OP_TYPEID::EmbeddingLookup:
         {
             node = make_shared<op::EmbeddingLookup>(args[0], args[1]);
@@ -3664,6 +3709,18 @@ json JSONSerializer::serialize_node(const Node& n)
         node["alpha"] = tmp->get_alpha();
         break;
     }
+    case OP_TYPEID::EmbeddingBag:
+    {
+        auto tmp = static_cast<const op::EmbeddingBag*>(&n);
+        node["reduction"] = tmp->get_reduction();
+        break;
+    }
+    case OP_TYPEID::EmbeddingBagBackprop:
+    {
+        auto tmp = static_cast<const op::EmbeddingBagBackprop*>(&n);
+        node["reduction"] = tmp->get_reduction();
+        break;
+    }
     case OP_TYPEID::EmbeddingLookup: { break;
     }
     case OP_TYPEID::Equal:
@@ -48,6 +48,12 @@ namespace ngraph
     ///    indent level specified.
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    /// \brief Serialize the type and attributes of a node to a json string, leaving out its
+    ///        name, inputs, outputs and other per-instance data. Two nodes that compute the
+    ///        same function of their inputs serialize to the same string.
+    /// \param node The node to serialize
+    std::string serialize_node_attributes(const Node& node);
+
     /// \brief Deserialize a Function
     /// \param in An isteam to the input data
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
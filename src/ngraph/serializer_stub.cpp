@@ -33,6 +33,11 @@ void ngraph::serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func
     throw std::runtime_error("serializer disabled in build");
 }
 
+std::string ngraph::serialize_node_attributes(const Node& node)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
 std::shared_ptr<ngraph::Function> ngraph::deserialize(std::istream& in)
 {
     throw std::runtime_error("serializer disabled in build");
@@ -0,0 +1,404 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+#include <deque>
+#include <set>
+#include <sstream>
+
+#include "ngraph/attribute_visitor.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/serializer.hpp"
+#include "ngraph/structural_hash.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    uint64_t mix(uint64_t h)
+    {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    uint64_t combine(uint64_t seed, uint64_t value)
+    {
+        return mix(seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2)));
+    }
+
+    // Hashes eight bytes at a time, fast enough for the contents of large Constants
+    uint64_t hash_bytes(const void* data, size_t size, uint64_t seed = 0)
+    {
+        const char* bytes = static_cast<const char*>(data);
+        uint64_t h = seed ^ (size * 0x87c37b91114253d5ULL);
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+        {
+            uint64_t word;
+            memcpy(&word, bytes + i, sizeof(word));
+            h = (h ^ mix(word)) * 0x4cf5ad432745937fULL;
+        }
+        uint64_t tail = 0;
+        memcpy(&tail, bytes + i, size - i);
+        return mix(h ^ mix(tail));
+    }
+
+    void append(string& signature, const string& value)
+    {
+        signature += to_string(value.size());
+        signature += ':';
+        signature += value;
+    }
+
+    // Collects the attributes of a node into a string
+    class SignatureVisitor : public AttributeVisitor
+    {
+    public:
+        void on_attribute(const string& name, string& value) override
+        {
+            append(m_signature, name);
+            append(m_signature, value);
+        }
+        void on_attribute(const string& name, bool& value) override
+        {
+            append(m_signature, name);
+            append(m_signature, value ? "1" : "0");
+        }
+        void on_adapter(const string& /* name */, ValueAccessor<void>& /* adapter */) override
+        {
+            // The value cannot be read through the generic adapter
+            m_complete = false;
+        }
+        void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+        {
+            append(m_signature, name);
+            append(m_signature, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            append(m_signature, name);
+            append(m_signature, to_string(adapter.get()));
+        }
+        void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+        {
+            append(m_signature, name);
+            double value = adapter.get();
+            append(m_signature, string(reinterpret_cast<const char*>(&value), sizeof(value)));
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+        {
+            append(m_signature, name);
+            append_vector(adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<float>>& adapter) override
+        {
+            append(m_signature, name);
+            append_vector(adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<string>>& adapter) override
+        {
+            append(m_signature, name);
+            m_signature += to_string(adapter.get().size());
+            for (auto& value : adapter.get())
+            {
+                append(m_signature, value);
+            }
+        }
+
+        const string& get_signature() const { return m_signature; }
+        bool is_complete() const { return m_complete; }
+    private:
+        template <typename T>
+        void append_vector(const vector<T>& values)
+        {
+            append(m_signature,
+                   string(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T)));
+        }
+
+        string m_signature;
+        bool m_complete{true};
+    };
+
+    size_t constant_byte_size(const op::Constant& constant)
+    {
+        return (shape_size(constant.get_shape()) * constant.get_element_type().bitwidth() + 7) /
+               8;
+    }
+
+    // Describes everything about a node except its arguments. Returns false if the
+    // attributes of the node could not be read, in which case the signature only covers its
+    // type and outputs.
+    bool get_signature(const Node& node,
+                       const unordered_map<const Node*, size_t>& parameter_index,
+                       bool include_constant_values,
+                       string& signature)
+    {
+        const NodeTypeInfo& type_info = node.get_type_info();
+        append(signature, type_info.name);
+        append(signature, to_string(type_info.version));
+        append(signature, to_string(node.get_input_size()));
+        append(signature, to_string(node.get_control_dependencies().size()));
+        for (size_t i = 0; i < node.get_output_size(); i++)
+        {
+            stringstream shape;
+            shape << node.get_output_partial_shape(i);
+            append(signature, node.get_output_element_type(i).get_type_name());
+            append(signature, shape.str());
+        }
+
+        if (auto constant = as_type<const op::Constant>(&node))
+        {
+            if (include_constant_values)
+            {
+                append(signature,
+                       to_string(hash_bytes(constant->get_data_ptr(),
+                                            constant_byte_size(*constant))));
+            }
+            return true;
+        }
+        if (node.is_parameter())
+        {
+            auto it = parameter_index.find(&node);
+            append(signature, it == parameter_index.end() ? "free" : to_string(it->second));
+            return true;
+        }
+
+        SignatureVisitor visitor;
+        if (const_cast<Node&>(node).visit_attributes(visitor) && visitor.is_complete())
+        {
+            append(signature, visitor.get_signature());
+            return true;
+        }
+        try
+        {
+            append(signature, serialize_node_attributes(node));
+            return true;
+        }
+        catch (const exception&)
+        {
+            // Serializer disabled in this build or op not supported by it
+        }
+        return false;
+    }
+
+    unordered_map<const Node*, size_t> get_parameter_index(const Function& function)
+    {
+        unordered_map<const Node*, size_t> parameter_index;
+        const ParameterVector& parameters = function.get_parameters();
+        for (size_t i = 0; i < parameters.size(); i++)
+        {
+            parameter_index[parameters[i].get()] = i;
+        }
+        return parameter_index;
+    }
+}
+
+StructuralHasher::StructuralHasher(const shared_ptr<Function>& function,
+                                   bool include_constant_values)
+    : m_function(function)
+    , m_include_constant_values(include_constant_values)
+    , m_parameter_index(get_parameter_index(*function))
+{
+}
+
+uint64_t StructuralHasher::get_function_hash()
+{
+    // Parameters may have been added or removed since the last call
+    auto parameter_index = get_parameter_index(*m_function);
+    if (parameter_index != m_parameter_index)
+    {
+        m_parameter_index = move(parameter_index);
+        m_cache.clear();
+    }
+
+    uint64_t hash = combine(m_function->get_parameters().size(), m_function->get_results().size());
+    for (auto& parameter : m_function->get_parameters())
+    {
+        hash = combine(hash, get_node_hash(parameter));
+    }
+    for (auto& result : m_function->get_results())
+    {
+        hash = combine(hash, get_node_hash(result));
+    }
+    return hash;
+}
+
+uint64_t StructuralHasher::get_node_hash(const shared_ptr<Node>& node)
+{
+    auto cached = [this](const shared_ptr<Node>& n) {
+        auto it = m_cache.find(n.get());
+        return it != m_cache.end() && it->second.first.lock() == n;
+    };
+
+    // Post-order walk, so that the hashes of the arguments are known before a node is hashed
+    vector<pair<shared_ptr<Node>, bool>> stack{{node, false}};
+    while (!stack.empty())
+    {
+        shared_ptr<Node> n = stack.back().first;
+        if (cached(n))
+        {
+            stack.pop_back();
+            continue;
+        }
+        if (!stack.back().second)
+        {
+            stack.back().second = true;
+            for (auto& input : n->inputs())
+            {
+                stack.emplace_back(input.get_source_output().get_node_shared_ptr(), false);
+            }
+            for (auto& dependency : n->get_control_dependencies())
+            {
+                stack.emplace_back(dependency, false);
+            }
+            continue;
+        }
+        stack.pop_back();
+
+        string signature;
+        get_signature(*n, m_parameter_index, m_include_constant_values, signature);
+        uint64_t hash = hash_bytes(signature.data(), signature.size());
+        for (auto& input : n->inputs())
+        {
+            auto source = input.get_source_output();
+            hash = combine(hash, combine(m_cache.at(source.get_node()).second, source.get_index()));
+        }
+        for (auto& dependency : n->get_control_dependencies())
+        {
+            hash = combine(hash, m_cache.at(dependency.get()).second);
+        }
+        m_cache[n.get()] = make_pair(weak_ptr<Node>(n), hash);
+    }
+    return m_cache.at(node.get()).second;
+}
+
+void StructuralHasher::invalidate(const shared_ptr<Node>& node)
+{
+    deque<Node*> pending{node.get()};
+    while (!pending.empty())
+    {
+        Node* n = pending.front();
+        pending.pop_front();
+        if (m_cache.erase(n) == 0 && n != node.get())
+        {
+            // Nothing that depends on an uncached node can be cached
+            continue;
+        }
+        for (auto& user : n->get_users())
+        {
+            pending.push_back(user.get());
+        }
+        for (auto dependent : n->get_control_dependents())
+        {
+            pending.push_back(dependent);
+        }
+    }
+}
+
+uint64_t ngraph::hash_function(const shared_ptr<Function>& function, bool include_constant_values)
+{
+    return StructuralHasher(function, include_constant_values).get_function_hash();
+}
+
+bool ngraph::functions_equal(const shared_ptr<Function>& a,
+                             const shared_ptr<Function>& b,
+                             bool compare_constant_values)
+{
+    if (a == b)
+    {
+        return true;
+    }
+    const ParameterVector& a_parameters = a->get_parameters();
+    const ParameterVector& b_parameters = b->get_parameters();
+    const ResultVector& a_results = a->get_results();
+    const ResultVector& b_results = b->get_results();
+    if (a_parameters.size() != b_parameters.size() || a_results.size() != b_results.size())
+    {
+        return false;
+    }
+    // A node shared by both Functions matches itself if it sees the same Parameters
+    bool same_parameters = a_parameters == b_parameters;
+    auto a_parameter_index = get_parameter_index(*a);
+    auto b_parameter_index = get_parameter_index(*b);
+
+    vector<pair<Node*, Node*>> pending;
+    for (size_t i = 0; i < a_parameters.size(); i++)
+    {
+        pending.emplace_back(a_parameters[i].get(), b_parameters[i].get());
+    }
+    for (size_t i = 0; i < a_results.size(); i++)
+    {
+        pending.emplace_back(a_results[i].get(), b_results[i].get());
+    }
+
+    set<pair<Node*, Node*>> matched;
+    while (!pending.empty())
+    {
+        Node* x = pending.back().first;
+        Node* y = pending.back().second;
+        pending.pop_back();
+        if ((x == y && same_parameters) || !matched.insert(make_pair(x, y)).second)
+        {
+            continue;
+        }
+
+        string x_signature;
+        string y_signature;
+        if (!get_signature(*x, a_parameter_index, false, x_signature) ||
+            !get_signature(*y, b_parameter_index, false, y_signature) ||
+            x_signature != y_signature)
+        {
+            return false;
+        }
+        if (compare_constant_values)
+        {
+            auto x_constant = as_type<op::Constant>(x);
+            auto y_constant = as_type<op::Constant>(y);
+            if (x_constant && y_constant &&
+                memcmp(x_constant->get_data_ptr(),
+                       y_constant->get_data_ptr(),
+                       constant_byte_size(*x_constant)) != 0)
+            {
+                return false;
+            }
+        }
+
+        // Signatures include the number of inputs and control dependencies
+        for (size_t i = 0; i < x->get_input_size(); i++)
+        {
+            auto x_source = x->input(i).get_source_output();
+            auto y_source = y->input(i).get_source_output();
+            if (x_source.get_index() != y_source.get_index())
+            {
+                return false;
+            }
+            pending.emplace_back(x_source.get_node(), y_source.get_node());
+        }
+        auto& x_dependencies = x->get_control_dependencies();
+        auto& y_dependencies = y->get_control_dependencies();
+        for (size_t i = 0; i < x_dependencies.size(); i++)
+        {
+            pending.emplace_back(x_dependencies[i].get(), y_dependencies[i].get());
+        }
+    }
+    return true;
+}
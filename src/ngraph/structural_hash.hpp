@@ -0,0 +1,81 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+#include "ngraph/function.hpp"
+#include "ngraph/node.hpp"
+
+namespace ngraph
+{
+    /// \brief Computes structural hashes of the nodes of a Function.
+    ///
+    /// The hash of a node covers its type and version, its attributes, the element types and
+    /// shapes of its outputs, the position of Parameters in the Function, the hashes of its
+    /// arguments and control dependencies and, optionally, the contents of Constants. Names
+    /// are not included, so independently built copies of a graph hash the same.
+    ///
+    /// Node hashes are cached. Hashing again after nodes were added to the Function only
+    /// visits the new nodes; nodes that were modified in place must be passed to invalidate().
+    class NGRAPH_API StructuralHasher
+    {
+    public:
+        /// \param function The Function whose nodes are hashed
+        /// \param include_constant_values If false, Constants of the same type and shape hash
+        ///        the same regardless of their contents
+        StructuralHasher(const std::shared_ptr<Function>& function,
+                         bool include_constant_values = true);
+
+        /// \brief Hash of the Function: its Parameters and Results, in order
+        uint64_t get_function_hash();
+
+        /// \brief Hash of a node and of everything it depends on
+        uint64_t get_node_hash(const std::shared_ptr<Node>& node);
+
+        /// \brief Drops the cached hashes of node and of everything that depends on it
+        void invalidate(const std::shared_ptr<Node>& node);
+
+    private:
+        std::shared_ptr<Function> m_function;
+        bool m_include_constant_values;
+        std::unordered_map<const Node*, size_t> m_parameter_index;
+        std::unordered_map<const Node*, std::pair<std::weak_ptr<Node>, uint64_t>> m_cache;
+    };
+
+    /// \brief Structural hash of a Function, see StructuralHasher
+    NGRAPH_API
+    uint64_t hash_function(const std::shared_ptr<Function>& function,
+                           bool include_constant_values = true);
+
+    /// \brief Checks whether two Functions compute the same results from the same parameters.
+    ///
+    /// The Functions must have matching Parameters and Results, in order, and the graphs
+    /// behind the Results must match node by node in type, attributes, output types and
+    /// shapes and, if compare_constant_values is set, Constant contents. Names are ignored,
+    /// and so is whether equal subexpressions are shared or duplicated.
+    ///
+    /// Unlike comparing hashes this cannot be fooled by a collision. Nodes whose attributes
+    /// can be read neither through visit_attributes nor the serializer only match themselves.
+    NGRAPH_API
+    bool functions_equal(const std::shared_ptr<Function>& a,
+                         const std::shared_ptr<Function>& b,
+                         bool compare_constant_values = true);
+}
@@ -0,0 +1,182 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <atomic>
+#include <exception>
+
+#include "ngraph/thread_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+struct ThreadPool::Loop
+{
+    Loop(size_t n, const function<void(size_t)>& f)
+        : count(n)
+        , func(f)
+        , errors(n)
+    {
+    }
+
+    // Claims and runs iterations until none are left
+    void run()
+    {
+        for (size_t i = next++; i < count; i = next++)
+        {
+            try
+            {
+                func(i);
+            }
+            catch (...)
+            {
+                errors[i] = current_exception();
+            }
+            if (++finished == count)
+            {
+                lock_guard<mutex> lock(done_mutex);
+                done_cv.notify_all();
+            }
+        }
+    }
+
+    size_t count;
+    const function<void(size_t)>& func;
+    vector<exception_ptr> errors;
+    atomic<size_t> next{0};
+    atomic<size_t> finished{0};
+    mutex done_mutex;
+    condition_variable done_cv;
+};
+
+ThreadPool::ThreadPool(size_t num_workers)
+{
+    for (size_t i = 0; i < num_workers; i++)
+    {
+        m_workers.emplace_back(&ThreadPool::worker, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_cv.notify_all();
+    for (auto& t : m_workers)
+    {
+        t.join();
+    }
+}
+
+void ThreadPool::worker()
+{
+    while (true)
+    {
+        shared_ptr<Loop> loop;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_stopping || !m_queue.empty(); });
+            if (m_queue.empty())
+            {
+                return;
+            }
+            loop = m_queue.front();
+            m_queue.pop();
+        }
+        loop->run();
+    }
+}
+
+void ThreadPool::parallel_for(size_t count,
+                              size_t max_threads,
+                              const function<void(size_t)>& func)
+{
+    size_t helpers = min(min(max_threads, count), get_max_threads());
+    helpers = helpers > 0 ? helpers - 1 : 0;
+    if (helpers == 0)
+    {
+        // Same contract as the parallel path: every i runs, then the first error is rethrown
+        exception_ptr first_error;
+        for (size_t i = 0; i < count; i++)
+        {
+            try
+            {
+                func(i);
+            }
+            catch (...)
+            {
+                if (!first_error)
+                {
+                    first_error = current_exception();
+                }
+            }
+        }
+        if (first_error)
+        {
+            rethrow_exception(first_error);
+        }
+        return;
+    }
+
+    // Helpers that are dequeued after the loop has been claimed entirely return at once, so
+    // the loop may finish before all of them have run; they keep it alive until then.
+    auto loop = make_shared<Loop>(count, func);
+    {
+        lock_guard<mutex> lock(m_mutex);
+        for (size_t i = 0; i < helpers; i++)
+        {
+            m_queue.push(loop);
+        }
+    }
+    m_cv.notify_all();
+    loop->run();
+    {
+        unique_lock<mutex> lock(loop->done_mutex);
+        loop->done_cv.wait(lock, [&loop]() { return loop->finished == loop->count; });
+    }
+    for (auto& error : loop->errors)
+    {
+        if (error)
+        {
+            rethrow_exception(error);
+        }
+    }
+}
+
+void ThreadPool::parallel_for(size_t count,
+                              size_t grain,
+                              size_t max_threads,
+                              const function<void(size_t begin, size_t end)>& func)
+{
+    size_t num_chunks = min(max_threads, count / max<size_t>(grain, 1));
+    if (num_chunks <= 1)
+    {
+        func(0, count);
+        return;
+    }
+    size_t chunk = (count + num_chunks - 1) / num_chunks;
+    num_chunks = (count + chunk - 1) / chunk;
+    parallel_for(num_chunks, num_chunks, [&](size_t i) {
+        func(i * chunk, min((i + 1) * chunk, count));
+    });
+}
+
+ThreadPool& ThreadPool::get_shared()
+{
+    static ThreadPool s_pool(max(thread::hardware_concurrency(), 1u) - 1);
+    return s_pool;
+}
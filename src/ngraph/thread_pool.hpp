@@ -0,0 +1,83 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    /// \brief Fixed set of worker threads for compile-time work such as constant folding and
+    ///        model import.
+    ///
+    /// parallel_for may be called from any thread, including from inside a task of another
+    /// parallel_for on the same pool: the calling thread always works on its own loop, and
+    /// workers only help out, so nested loops cannot deadlock.
+    class NGRAPH_API ThreadPool
+    {
+    public:
+        /// \param num_workers Number of threads started in addition to the callers.
+        explicit ThreadPool(size_t num_workers);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /// \brief Number of threads a loop can run on: the workers plus the caller
+        size_t get_max_threads() const { return m_workers.size() + 1; }
+        /// \brief Runs func(i) for every i in [0, count) on up to max_threads threads,
+        ///        the calling thread included, and returns once all of them have finished.
+        ///
+        /// If some calls throw, the exception of the lowest i is rethrown on the calling
+        /// thread after the loop has completed.
+        void parallel_for(size_t count,
+                          size_t max_threads,
+                          const std::function<void(size_t)>& func);
+
+        /// \brief Splits [0, count) into at most max_threads contiguous chunks of at least
+        ///        grain items and runs func(begin, end) on each of them.
+        ///
+        /// Chunk boundaries only depend on the arguments, so a func that computes every item
+        /// independently gives the same results as a serial loop.
+        void parallel_for(size_t count,
+                          size_t grain,
+                          size_t max_threads,
+                          const std::function<void(size_t begin, size_t end)>& func);
+
+        /// \brief Pool shared by the whole process, with one thread per hardware thread
+        static ThreadPool& get_shared();
+
+    private:
+        struct Loop;
+
+        void worker();
+
+        std::vector<std::thread> m_workers;
+        std::queue<std::shared_ptr<Loop>> m_queue;
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        bool m_stopping = false;
+    };
+}
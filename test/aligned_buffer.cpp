@@ -14,9 +14,16 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/hugepage_allocator.hpp"
+#include "ngraph/runtime/pool_allocator.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -48,3 +55,120 @@ TEST(aligned_buffer, move)
         EXPECT_NE(buffer2.get_ptr(), nullptr);
     }
 }
+
+TEST(aligned_buffer, pool_allocator)
+{
+    runtime::PoolAllocator allocator;
+    void* first;
+    {
+        runtime::AlignedBuffer buffer(900, 64, &allocator);
+        EXPECT_EQ(reinterpret_cast<size_t>(buffer.get_ptr()) % 64, 0);
+        first = buffer.get_ptr();
+    }
+    {
+        // Same size class, so the freed block is handed out again
+        runtime::AlignedBuffer buffer(800, 64, &allocator);
+        EXPECT_EQ(buffer.get_ptr(), first);
+        auto stats = allocator.get_stats();
+        EXPECT_EQ(stats.num_allocations, 2);
+        EXPECT_EQ(stats.num_frees, 1);
+        EXPECT_EQ(stats.num_reused, 1);
+        EXPECT_EQ(stats.bytes_in_use, 1024);
+    }
+    auto stats = allocator.get_stats();
+    EXPECT_EQ(stats.bytes_in_use, 0);
+    EXPECT_EQ(stats.peak_bytes_in_use, 1024);
+    EXPECT_EQ(stats.bytes_reserved, 1024);
+    allocator.release_cached();
+    EXPECT_EQ(allocator.get_stats().bytes_reserved, 0);
+}
+
+namespace
+{
+    // Hands out blocks that are 64 byte aligned but never 4096 byte aligned, unless more
+    // than 64 bytes of alignment is requested
+    class OffsetAllocator : public runtime::Allocator
+    {
+    public:
+        void* malloc(size_t size, size_t alignment) override
+        {
+            char* base = static_cast<char*>(std::malloc(size + 8192));
+            size_t page_offset = 4096 - reinterpret_cast<size_t>(base) % 4096;
+            char* ptr = base + page_offset + (alignment > 64 ? 0 : 64);
+            m_bases[ptr] = base;
+            return ptr;
+        }
+        void free(void* ptr) override
+        {
+            std::free(m_bases.at(ptr));
+            m_bases.erase(ptr);
+        }
+
+    private:
+        map<void*, void*> m_bases;
+    };
+}
+
+TEST(aligned_buffer, pool_allocator_alignment)
+{
+    OffsetAllocator upstream;
+    runtime::PoolAllocator allocator(&upstream);
+    void* small_alignment = allocator.malloc(1000, 64);
+    allocator.free(small_alignment);
+
+    // The cached block of the same size class was allocated for a smaller alignment
+    void* large_alignment = allocator.malloc(1000, 4096);
+    EXPECT_NE(large_alignment, small_alignment);
+    EXPECT_EQ(reinterpret_cast<size_t>(large_alignment) % 4096, 0);
+    EXPECT_EQ(allocator.get_stats().num_reused, 0);
+
+    // It still serves requests with its own alignment
+    void* reused = allocator.malloc(1000, 64);
+    EXPECT_EQ(reused, small_alignment);
+    EXPECT_EQ(allocator.get_stats().num_reused, 1);
+    allocator.free(reused);
+    allocator.free(large_alignment);
+}
+
+TEST(aligned_buffer, hugepage_allocator)
+{
+    runtime::HugePageAllocator allocator;
+    {
+        runtime::AlignedBuffer small(100, 64, &allocator);
+        runtime::AlignedBuffer large(3 * 1024 * 1024, 64, &allocator);
+        EXPECT_EQ(reinterpret_cast<size_t>(large.get_ptr()) % 64, 0);
+        memset(large.get_ptr(), 0, large.size());
+        auto stats = allocator.get_stats();
+        EXPECT_EQ(stats.num_allocations, 2);
+        EXPECT_EQ(stats.bytes_in_use, 100 + 64 + 3 * 1024 * 1024 + 64);
+        EXPECT_GE(stats.bytes_reserved, stats.bytes_in_use);
+    }
+    auto stats = allocator.get_stats();
+    EXPECT_EQ(stats.num_frees, 2);
+    EXPECT_EQ(stats.bytes_in_use, 0);
+    EXPECT_EQ(stats.bytes_reserved, 0);
+    EXPECT_EQ(stats.bytes_in_huge_pages, 0);
+}
+
+#if defined(__linux__)
+TEST(aligned_buffer, hugepage_allocator_aligns_mappings)
+{
+    // Transparent huge pages only back 2MB-aligned ranges, so large allocations must start on
+    // a huge page boundary whether or not reserved huge pages are available
+    runtime::HugePageAllocator allocator;
+    std::vector<void*> allocations;
+    for (size_t size : {2 * 1024 * 1024, 3 * 1024 * 1024 + 1, 5 * 1024 * 1024})
+    {
+        void* ptr = allocator.malloc(size, 64);
+        EXPECT_EQ(reinterpret_cast<size_t>(ptr) % runtime::HugePageAllocator::s_huge_page_size,
+                  0);
+        memset(ptr, 0x5a, size);
+        allocations.push_back(ptr);
+    }
+    for (void* ptr : allocations)
+    {
+        allocator.free(ptr);
+    }
+    EXPECT_EQ(allocator.get_stats().bytes_reserved, 0);
+}
+#endif
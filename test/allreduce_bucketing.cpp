@@ -0,0 +1,174 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/distributed/null.hpp"
+#include "ngraph/distributed/shared_memory.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(allreduce_bucketing, fuse_small)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto C = make_shared<op::Parameter>(element::f32, Shape{});
+    auto f = make_shared<Function>(
+        NodeVector{make_shared<op::AllReduce>(A), make_shared<op::AllReduce>(B),
+                   make_shared<op::AllReduce>(C)},
+        ParameterVector{A, B, C});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>(1024);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::AllReduce>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Concat>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Slice>(f), 3);
+    EXPECT_EQ(f->get_output_shape(0), (Shape{2, 3}));
+    EXPECT_EQ(f->get_output_shape(1), (Shape{4}));
+    EXPECT_EQ(f->get_output_shape(2), (Shape{}));
+}
+
+TEST(allreduce_bucketing, bucket_size_cap)
+{
+    // 24 + 16 bytes fit in the first bucket, the next 16 bytes start a second one and the
+    // 400 byte gradient exceeds the cap and is left alone
+    auto A = make_shared<op::Parameter>(element::f32, Shape{6});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto C = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto D = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto E = make_shared<op::Parameter>(element::f32, Shape{100});
+    auto f = make_shared<Function>(
+        NodeVector{make_shared<op::AllReduce>(A),
+                   make_shared<op::AllReduce>(B),
+                   make_shared<op::AllReduce>(C),
+                   make_shared<op::AllReduce>(D),
+                   make_shared<op::AllReduce>(E)},
+        ParameterVector{A, B, C, D, E});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>(40);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::AllReduce>(f), 3);
+    ASSERT_EQ(count_ops_of_type<op::Concat>(f), 2);
+}
+
+TEST(allreduce_bucketing, keep_apart_types_and_dependencies)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto B = make_shared<op::Parameter>(element::f64, Shape{4});
+    auto all_reduce_a = make_shared<op::AllReduce>(A);
+    // Depends on the first AllReduce, so it cannot share its bucket
+    auto all_reduce_a2 = make_shared<op::AllReduce>(all_reduce_a);
+    auto all_reduce_b = make_shared<op::AllReduce>(B);
+    auto all_reduce_max = make_shared<op::AllReduce>(A, reduction::Type::MAX);
+    auto f = make_shared<Function>(NodeVector{all_reduce_a2, all_reduce_b, all_reduce_max},
+                                   ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>(1024);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::AllReduce>(f), 4);
+    ASSERT_EQ(count_ops_of_type<op::Concat>(f), 0);
+}
+
+TEST(allreduce_bucketing, interleaved_keys)
+{
+    auto make_function = []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{4});
+        auto sum_a = make_shared<op::AllReduce>(A);
+        auto max_b = make_shared<op::AllReduce>(B, reduction::Type::MAX);
+        // Each of these depends on the other key's first AllReduce. Fusing both pairs would
+        // make the fused SUM and MAX AllReduces depend on each other.
+        auto max_ab = make_shared<op::AllReduce>(make_shared<op::Add>(sum_a, B),
+                                                 reduction::Type::MAX);
+        auto sum_ba = make_shared<op::AllReduce>(make_shared<op::Add>(max_b, A));
+        return make_shared<Function>(NodeVector{sum_ba, max_ab}, ParameterVector{A, B});
+    };
+    auto f = make_function();
+    auto bucketed_f = make_function();
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>(1024);
+    pass_manager.run_passes(bucketed_f);
+    // Only one of the two pairs can be fused
+    ASSERT_EQ(count_ops_of_type<op::AllReduce>(bucketed_f), 3);
+    ASSERT_EQ(count_ops_of_type<op::Concat>(bucketed_f), 1);
+
+    set_distributed_interface(unique_ptr<DistributedInterface>(
+        new distributed::SharedMemoryDistributedInterface("allreduce_bucketing_keys", 1, 0)));
+    vector<vector<float>> args{{1, 2, 3, 4}, {-1, 0.5f, 2, 8}};
+    auto results = execute(f, args, "INTERPRETER");
+    auto bucketed_results = execute(bucketed_f, args, "INTERPRETER");
+    set_distributed_interface(
+        unique_ptr<DistributedInterface>(new distributed::NullDistributedInterface()));
+    EXPECT_EQ(results, bucketed_results);
+}
+
+TEST(allreduce_bucketing, no_allreduce)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto f = make_shared<Function>(make_shared<op::Negative>(A), ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>(1024);
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::Negative>(f), 1);
+}
+
+TEST(allreduce_bucketing, same_results)
+{
+    auto make_function = []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{4});
+        auto C = make_shared<op::Parameter>(element::f32, Shape{});
+        auto all_reduce_a = make_shared<op::AllReduce>(A);
+        auto all_reduce_b = make_shared<op::AllReduce>(B);
+        auto all_reduce_c = make_shared<op::AllReduce>(C);
+        // Depends on a bucketed AllReduce, so it ends up in a bucket of its own
+        auto all_reduce_ac = make_shared<op::AllReduce>(make_shared<op::Add>(all_reduce_a, A));
+        return make_shared<Function>(
+            NodeVector{all_reduce_ac, make_shared<op::Multiply>(all_reduce_b, B), all_reduce_c},
+            ParameterVector{A, B, C});
+    };
+    auto f = make_function();
+    auto bucketed_f = make_function();
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>(1024);
+    pass_manager.run_passes(bucketed_f);
+    ASSERT_EQ(count_ops_of_type<op::AllReduce>(bucketed_f), 2);
+
+    // A single rank reduces to its own input, which is enough to check the bucket layout
+    set_distributed_interface(unique_ptr<DistributedInterface>(
+        new distributed::SharedMemoryDistributedInterface("allreduce_bucketing", 1, 0)));
+    vector<vector<float>> args{{1, 2, 3, 4, 5, 6}, {-1, 0.5f, 2, 8}, {3}};
+    auto results = execute(f, args, "INTERPRETER");
+    auto bucketed_results = execute(bucketed_f, args, "INTERPRETER");
+    set_distributed_interface(
+        unique_ptr<DistributedInterface>(new distributed::NullDistributedInterface()));
+    EXPECT_EQ(results, bucketed_results);
+}
@@ -717,6 +717,21 @@ TEST(attributes, elu_op)
     EXPECT_EQ(g_elu->get_alpha(), elu->get_alpha());
 }
 
+TEST(attributes, embedding_bag_op)
+{
+    FactoryRegistry<Node>::get().register_factory<op::v0::EmbeddingBag>();
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{10, 4});
+    auto indices = make_shared<op::Parameter>(element::i64, Shape{6});
+    auto offsets = make_shared<op::Parameter>(element::i64, Shape{2});
+
+    auto embedding_bag = make_shared<op::v0::EmbeddingBag>(
+        weights, indices, offsets, op::v0::EmbeddingBag::Reduction::MEAN);
+    NodeBuilder builder(embedding_bag);
+    auto g_embedding_bag = as_type_ptr<op::v0::EmbeddingBag>(builder.create());
+
+    EXPECT_EQ(g_embedding_bag->get_reduction(), embedding_bag->get_reduction());
+}
+
 TEST(attributes, fake_quantize_op)
 {
     FactoryRegistry<Node>::get().register_factory<opset1::FakeQuantize>();
@@ -0,0 +1,188 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/autodiff/adjoints.hpp"
+#include "ngraph/ngraph.hpp"
+#include "util/test_case.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// Row r of the table is {3r, 3r + 1, 3r + 2}. The three bags hold rows {0, 2}, nothing and
+// {4, 1, 3}.
+static const vector<float> s_weights{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14};
+static const vector<int32_t> s_indices{0, 2, 4, 1, 3};
+static const vector<int32_t> s_offsets{0, 2, 2};
+
+static shared_ptr<Function> make_embedding_bag_function(op::EmbeddingBag::Reduction reduction,
+                                                        bool per_sample_weights)
+{
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{5, 3});
+    auto indices = make_shared<op::Parameter>(element::i32, Shape{5});
+    auto offsets = make_shared<op::Parameter>(element::i32, Shape{3});
+    if (per_sample_weights)
+    {
+        auto psw = make_shared<op::Parameter>(element::f32, Shape{5});
+        auto bag = make_shared<op::EmbeddingBag>(weights, indices, offsets, psw, reduction);
+        return make_shared<Function>(bag, ParameterVector{weights, indices, offsets, psw});
+    }
+    auto bag = make_shared<op::EmbeddingBag>(weights, indices, offsets, reduction);
+    return make_shared<Function>(bag, ParameterVector{weights, indices, offsets});
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_bag_sum)
+{
+    auto test_case = test::NgraphTestCase(
+        make_embedding_bag_function(op::EmbeddingBag::Reduction::SUM, false), "${BACKEND_NAME}");
+    test_case.add_input<float>(s_weights);
+    test_case.add_input<int32_t>(s_indices);
+    test_case.add_input<int32_t>(s_offsets);
+    test_case.add_expected_output<float>(Shape{3, 3}, {6, 8, 10, 0, 0, 0, 24, 27, 30});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_bag_mean)
+{
+    auto test_case = test::NgraphTestCase(
+        make_embedding_bag_function(op::EmbeddingBag::Reduction::MEAN, false), "${BACKEND_NAME}");
+    test_case.add_input<float>(s_weights);
+    test_case.add_input<int32_t>(s_indices);
+    test_case.add_input<int32_t>(s_offsets);
+    test_case.add_expected_output<float>(Shape{3, 3}, {3, 4, 5, 0, 0, 0, 8, 9, 10});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_bag_max)
+{
+    auto test_case = test::NgraphTestCase(
+        make_embedding_bag_function(op::EmbeddingBag::Reduction::MAX, false), "${BACKEND_NAME}");
+    test_case.add_input<float>(s_weights);
+    test_case.add_input<int32_t>(s_indices);
+    test_case.add_input<int32_t>(s_offsets);
+    test_case.add_expected_output<float>(Shape{3, 3}, {6, 7, 8, 0, 0, 0, 12, 13, 14});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_bag_sum_per_sample_weights)
+{
+    auto test_case = test::NgraphTestCase(
+        make_embedding_bag_function(op::EmbeddingBag::Reduction::SUM, true), "${BACKEND_NAME}");
+    test_case.add_input<float>(s_weights);
+    test_case.add_input<int32_t>(s_indices);
+    test_case.add_input<int32_t>(s_offsets);
+    test_case.add_input<float>({1, 0.5, 2, 1, -1});
+    test_case.add_expected_output<float>(Shape{3, 3}, {3, 4.5, 6, 0, 0, 0, 18, 20, 22});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_bag_index_out_of_range)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(
+        make_embedding_bag_function(op::EmbeddingBag::Reduction::SUM, false));
+    auto weights = backend->create_tensor(element::f32, Shape{5, 3});
+    auto indices = backend->create_tensor(element::i32, Shape{5});
+    auto offsets = backend->create_tensor(element::i32, Shape{3});
+    auto result = backend->create_tensor(element::f32, Shape{3, 3});
+    copy_data(weights, s_weights);
+    copy_data(offsets, s_offsets);
+
+    copy_data(indices, vector<int32_t>{0, 2, 5, 1, 3});
+    EXPECT_ANY_THROW(handle->call_with_validate({result}, {weights, indices, offsets}));
+    copy_data(indices, vector<int32_t>{0, 2, 4, -1, 3});
+    EXPECT_ANY_THROW(handle->call_with_validate({result}, {weights, indices, offsets}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_bag_decreasing_offsets)
+{
+    auto f = make_embedding_bag_function(op::EmbeddingBag::Reduction::SUM, false);
+    auto delta = make_shared<op::Parameter>(element::f32, Shape{3, 3});
+    autodiff::Adjoints adjoints(OutputVector{f->output(0)}, OutputVector{delta});
+    auto params = f->get_parameters();
+    auto d_weights = adjoints.backprop_output(params.at(0));
+    params.push_back(delta);
+    auto bf = make_shared<Function>(OutputVector{d_weights}, params);
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto weights = backend->create_tensor(element::f32, Shape{5, 3});
+    auto indices = backend->create_tensor(element::i32, Shape{5});
+    auto offsets = backend->create_tensor(element::i32, Shape{3});
+    auto delta_tensor = backend->create_tensor(element::f32, Shape{3, 3});
+    auto result = backend->create_tensor(element::f32, Shape{3, 3});
+    auto d_weights_tensor = backend->create_tensor(element::f32, Shape{5, 3});
+    copy_data(weights, s_weights);
+    copy_data(indices, s_indices);
+    // The last bag would overlap the first one
+    copy_data(offsets, vector<int32_t>{0, 3, 1});
+    copy_data(delta_tensor, vector<float>(9, 1));
+
+    EXPECT_ANY_THROW(
+        backend->compile(f)->call_with_validate({result}, {weights, indices, offsets}));
+    EXPECT_ANY_THROW(backend->compile(bf)->call_with_validate(
+        {d_weights_tensor}, {weights, indices, offsets, delta_tensor}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_bag_sum_backprop)
+{
+    auto f = make_embedding_bag_function(op::EmbeddingBag::Reduction::SUM, true);
+    auto delta = make_shared<op::Parameter>(element::f32, Shape{3, 3});
+    autodiff::Adjoints adjoints(OutputVector{f->output(0)}, OutputVector{delta});
+    auto params = f->get_parameters();
+    auto d_weights = adjoints.backprop_output(params.at(0));
+    auto d_psw = adjoints.backprop_output(params.at(3));
+    params.push_back(delta);
+    auto bf = make_shared<Function>(OutputVector{d_weights, d_psw}, params);
+
+    auto test_case = test::NgraphTestCase(bf, "${BACKEND_NAME}");
+    test_case.add_input<float>(s_weights);
+    test_case.add_input<int32_t>(s_indices);
+    test_case.add_input<int32_t>(s_offsets);
+    test_case.add_input<float>({1, 0.5, 2, 1, -1});
+    test_case.add_input<float>({1, 1, 1, 5, 5, 5, 2, -1, 0});
+    test_case.add_expected_output<float>(Shape{5, 3},
+                                         {1, 1, 1, 2, -1, 0, 0.5, 0.5, 0.5, -2, 1, 0, 4, -2, 0});
+    test_case.add_expected_output<float>(Shape{5}, {3, 21, 11, 2, 8});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_bag_max_backprop)
+{
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{5, 3});
+    auto indices = make_shared<op::Parameter>(element::i64, Shape{5});
+    auto offsets = make_shared<op::Parameter>(element::i64, Shape{2});
+    auto delta = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto bag =
+        make_shared<op::EmbeddingBag>(weights, indices, offsets, op::EmbeddingBag::Reduction::MAX);
+    autodiff::Adjoints adjoints(OutputVector{bag}, OutputVector{delta});
+    auto bf = make_shared<Function>(OutputVector{bag, adjoints.backprop_output(weights)},
+                                    ParameterVector{weights, indices, offsets, delta});
+
+    auto test_case = test::NgraphTestCase(bf, "${BACKEND_NAME}");
+    test_case.add_input<float>({0, 9, 1, 5, 0, 0, 1, 1, 7, 2, 8, 3, 6, 2, 3});
+    test_case.add_input<int64_t>({0, 2, 4, 1, 3});
+    test_case.add_input<int64_t>({0, 2});
+    test_case.add_input<float>({1, 2, 3, 4, 5, 6});
+    test_case.add_expected_output<float>(Shape{2, 3}, {1, 9, 7, 6, 8, 3});
+    // Rows 4 and 3 tie on the last column; the earlier index receives the gradient
+    test_case.add_expected_output<float>(Shape{5, 3},
+                                         {0, 2, 0, 0, 0, 0, 1, 0, 3, 0, 5, 0, 4, 0, 6});
+    test_case.run();
+}
@@ -0,0 +1,149 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <fstream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/chrome_trace.hpp"
+#include "ngraph/file_util.hpp"
+#include "nlohmann/json.hpp"
+
+using namespace std;
+using namespace ngraph;
+using json = nlohmann::json;
+
+namespace
+{
+    // Enables event tracing for the lifetime of the object
+    class ScopedTracing
+    {
+    public:
+        ScopedTracing()
+            : m_was_enabled(runtime::event::Manager::is_event_tracing_enabled())
+            , m_sampling_rate(runtime::event::Manager::get_sampling_rate())
+        {
+            runtime::event::Manager::enable_event_tracing();
+        }
+        ~ScopedTracing()
+        {
+            if (!m_was_enabled)
+            {
+                runtime::event::Manager::disable_event_tracing();
+            }
+            runtime::event::Manager::set_sampling_rate(m_sampling_rate);
+        }
+
+    private:
+        bool m_was_enabled;
+        double m_sampling_rate;
+    };
+
+    json read_json_trace(const string& path)
+    {
+        ifstream in(path);
+        json trace;
+        in >> trace;
+        return trace;
+    }
+}
+
+TEST(chrome_trace, duration_events_from_many_threads)
+{
+    ScopedTracing tracing;
+    string path = file_util::tmp_filename(".json");
+    runtime::event::Manager::open(path, runtime::event::Manager::Format::JSON);
+
+    const size_t num_threads = 4;
+    const size_t events_per_thread = 100;
+    vector<thread> threads;
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        threads.emplace_back([=]() {
+            for (size_t i = 0; i < events_per_thread; i++)
+            {
+                runtime::event::Duration d("op" + to_string(i), "test", R"({"thread":)" +
+                                                                     to_string(t) + "}");
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    runtime::event::Manager::close();
+
+    json trace = read_json_trace(path);
+    file_util::remove_file(path);
+    ASSERT_EQ(trace.size(), num_threads * events_per_thread);
+    set<string> names;
+    for (auto& event : trace)
+    {
+        names.insert(event["name"].get<string>());
+        EXPECT_EQ(event["ph"], "X");
+        EXPECT_EQ(event["cat"], "test");
+        EXPECT_GE(event["dur"].get<size_t>(), 0);
+        EXPECT_LT(event["args"]["thread"].get<size_t>(), num_threads);
+    }
+    // Every thread interned the same names
+    ASSERT_EQ(names.size(), events_per_thread);
+    EXPECT_EQ(*names.begin(), "op0");
+}
+
+TEST(chrome_trace, sampling)
+{
+    ScopedTracing tracing;
+    runtime::event::Manager::set_sampling_rate(0.25);
+    string path = file_util::tmp_filename(".json");
+    runtime::event::Manager::open(path, runtime::event::Manager::Format::JSON);
+
+    // A new thread starts sampling from scratch
+    thread([]() {
+        for (size_t i = 0; i < 100; i++)
+        {
+            runtime::event::Duration d("sampled", "test");
+        }
+    }).join();
+    runtime::event::Manager::close();
+
+    json trace = read_json_trace(path);
+    file_util::remove_file(path);
+    EXPECT_EQ(trace.size(), 25);
+}
+
+TEST(chrome_trace, binary_format)
+{
+    ScopedTracing tracing;
+    string path = file_util::tmp_filename(".trace");
+    runtime::event::Manager::open(path, runtime::event::Manager::Format::BINARY);
+    {
+        runtime::event::Duration d("event", "test");
+    }
+    runtime::event::Manager::close();
+
+    ifstream in(path, ios_base::binary);
+    string contents((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+    file_util::remove_file(path);
+
+    // magic, pid, then one record with the three strings "event", "test" and ""
+    size_t record_size = 1 + 4 + 3 * 8 + (4 + 5) + (4 + 4) + 4;
+    ASSERT_EQ(contents.size(), 8 + 4 + record_size);
+    EXPECT_EQ(contents.substr(0, 8), "NGTRACE1");
+    EXPECT_EQ(contents[12], 'X');
+}
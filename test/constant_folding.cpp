@@ -2376,3 +2376,223 @@ TEST(constant_folding, pass_property)
     ASSERT_FALSE(pass->get_property(pass::PassProperty::REQUIRE_STATIC_SHAPE));
     ASSERT_TRUE(pass->get_property(pass::PassProperty::CHANGE_DYNAMIC_STATE));
 }
+
+TEST(constant_folding, const_dot_generic)
+{
+    auto constant0 =
+        op::Constant::create(element::f32, Shape{2, 3}, vector<float>{1, 2, 3, 4, 5, 6});
+    auto constant1 =
+        op::Constant::create(element::f32, Shape{3, 2}, vector<float>{1, 0, 0, 1, 1, 1});
+    auto dot = make_shared<op::Dot>(constant0, constant1);
+    auto f = make_shared<Function>(dot, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>()->enable_generic_folding();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+
+    auto new_const = as_type_ptr<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    auto values_out = new_const->get_vector<float>();
+
+    vector<float> values_expected{4, 5, 10, 11};
+    ASSERT_TRUE(test::all_close_f(values_out, values_expected, MIN_FLOAT_TOLERANCE_BITS));
+}
+
+TEST(constant_folding, const_topk_generic)
+{
+    auto constant =
+        op::Constant::create(element::i32, Shape{2, 3}, vector<int32_t>{1, 5, 3, 6, 2, 4});
+    auto topk = make_shared<op::TopK>(constant, 1, element::i64, 2);
+    auto indices = make_shared<op::GetOutputElement>(topk, 0);
+    auto values = make_shared<op::GetOutputElement>(topk, 1);
+    auto f = make_shared<Function>(NodeVector{indices, values}, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>(
+        vector<pass::ConstantFolding::CFTransformations>{
+            pass::ConstantFolding::CFTransformations::GENERIC});
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::TopK>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::GetOutputElement>(f), 0);
+
+    auto indices_const = as_type_ptr<op::Constant>(f->get_results().at(0)->get_argument(0));
+    auto values_const = as_type_ptr<op::Constant>(f->get_results().at(1)->get_argument(0));
+    ASSERT_TRUE(indices_const);
+    ASSERT_TRUE(values_const);
+    ASSERT_EQ((vector<int64_t>{1, 2, 0, 2}), indices_const->get_vector<int64_t>());
+    ASSERT_EQ((vector<int32_t>{5, 3, 6, 4}), values_const->get_vector<int32_t>());
+}
+
+TEST(constant_folding, const_generic_memory_budget)
+{
+    auto constant0 = op::Constant::create(element::f32, Shape{2, 2}, vector<float>{1, 2, 3, 4});
+    auto constant1 = op::Constant::create(element::f32, Shape{2, 2}, vector<float>{5, 6, 7, 8});
+    auto dot = make_shared<op::Dot>(constant0, constant1, 0);
+    auto f = make_shared<Function>(dot, ParameterVector{});
+
+    // The outer product creates 64 bytes of constant data, which exceeds the budget.
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>()->enable_generic_folding(16);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 1);
+}
+
+TEST(constant_folding, const_generic_registered_once)
+{
+    auto constant0 = op::Constant::create(element::f32, Shape{2, 2}, vector<float>{1, 2, 3, 4});
+    auto constant1 = op::Constant::create(element::f32, Shape{2, 2}, vector<float>{5, 6, 7, 8});
+    auto dot = make_shared<op::Dot>(constant0, constant1, 0);
+    auto f = make_shared<Function>(dot, ParameterVector{});
+
+    // GENERIC already registered the generic matcher; enable_generic_folding only sets the
+    // budget, which still rejects the 64 byte outer product
+    pass::Manager pass_manager;
+    pass_manager
+        .register_pass<pass::ConstantFolding>(
+            vector<pass::ConstantFolding::CFTransformations>{
+                pass::ConstantFolding::CFTransformations::GENERIC})
+        ->enable_generic_folding(16);
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 1);
+
+    pass::Manager unlimited_manager;
+    unlimited_manager
+        .register_pass<pass::ConstantFolding>(
+            vector<pass::ConstantFolding::CFTransformations>{
+                pass::ConstantFolding::CFTransformations::GENERIC})
+        ->enable_generic_folding();
+    unlimited_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 0);
+    auto result = as_type_ptr<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(result);
+    ASSERT_EQ((vector<float>{5, 6, 7, 8, 10, 12, 14, 16, 15, 18, 21, 24, 20, 24, 28, 32}),
+              result->get_vector<float>());
+}
+
+TEST(constant_folding, const_generic_memory_budget_charges_shrinking_folds)
+{
+    auto constant0 =
+        op::Constant::create(element::f32, Shape{2, 3}, vector<float>{1, 2, 3, 4, 5, 6});
+    auto constant1 =
+        op::Constant::create(element::f32, Shape{3, 2}, vector<float>{1, 0, 0, 1, 1, 1});
+    auto constant2 =
+        op::Constant::create(element::f32, Shape{3, 2}, vector<float>{0, 1, 1, 0, 1, 1});
+    auto dot0 = make_shared<op::Dot>(constant0, constant1);
+    auto dot1 = make_shared<op::Dot>(constant0, constant2);
+    auto f = make_shared<Function>(NodeVector{dot0, dot1}, ParameterVector{});
+
+    // Each fold creates a constant smaller than its inputs, but constant0 stays alive, so
+    // the 16 byte output of the first fold uses up most of the budget.
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>()->enable_generic_folding(20);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 1);
+}
+
+TEST(constant_folding, const_generic_parallel_deterministic)
+{
+    auto make_function = []() {
+        vector<float> values0(128 * 256);
+        vector<float> values1(256 * 64);
+        for (size_t i = 0; i < values0.size(); i++)
+        {
+            values0[i] = static_cast<float>(i % 17) / 17.0f;
+        }
+        for (size_t i = 0; i < values1.size(); i++)
+        {
+            values1[i] = static_cast<float>(i % 13) / 13.0f;
+        }
+        auto constant0 = op::Constant::create(element::f32, Shape{128, 256}, values0);
+        auto constant1 = op::Constant::create(element::f32, Shape{256, 64}, values1);
+        auto exp0 = make_shared<op::Exp>(constant0);
+        auto tanh1 = make_shared<op::Tanh>(constant1);
+        auto dot = make_shared<op::Dot>(exp0, tanh1);
+        return make_shared<Function>(dot, ParameterVector{});
+    };
+
+    auto f_serial = make_function();
+    pass::Manager serial_manager;
+    auto serial_pass = serial_manager.register_pass<pass::ConstantFolding>();
+    serial_pass->enable_generic_folding();
+    serial_pass->set_num_threads(1);
+    serial_manager.run_passes(f_serial);
+
+    auto f_parallel = make_function();
+    pass::Manager parallel_manager;
+    auto parallel_pass = parallel_manager.register_pass<pass::ConstantFolding>();
+    parallel_pass->enable_generic_folding();
+    parallel_pass->set_num_threads(4);
+    parallel_manager.run_passes(f_parallel);
+
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f_parallel), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f_parallel), 1);
+
+    auto serial_const = as_type_ptr<op::Constant>(f_serial->get_results().at(0)->get_argument(0));
+    auto parallel_const =
+        as_type_ptr<op::Constant>(f_parallel->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(serial_const);
+    ASSERT_TRUE(parallel_const);
+    ASSERT_EQ(serial_const->get_vector<float>(), parallel_const->get_vector<float>());
+}
+
+TEST(constant_folding, const_parallel_matcher_folds_deterministic)
+{
+    auto make_function = []() {
+        Shape shape{64, 128, 4};
+        vector<float> values(shape_size(shape));
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            values[i] = static_cast<float>(i % 251) - 125.0f;
+        }
+        auto data = op::Constant::create(element::f32, shape, values);
+        auto reshape = make_shared<op::Reshape>(data, AxisVector{1, 0, 2}, Shape{128, 256});
+        auto perm = op::Constant::create(element::i64, Shape{3}, vector<int64_t>{2, 0, 1});
+        auto transpose = make_shared<op::Transpose>(data, perm);
+
+        vector<float> scales(64);
+        vector<int8_t> offsets(64);
+        for (size_t i = 0; i < scales.size(); i++)
+        {
+            scales[i] = 0.5f + static_cast<float>(i) / 16.0f;
+            offsets[i] = static_cast<int8_t>(i % 5);
+        }
+        auto quantize = make_shared<op::Quantize>(
+            data,
+            op::Constant::create(element::f32, Shape{64}, scales),
+            op::Constant::create(element::i8, Shape{64}, offsets),
+            element::i8,
+            AxisSet{0},
+            op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+        return make_shared<Function>(NodeVector{reshape, transpose, quantize},
+                                     ParameterVector{});
+    };
+
+    auto fold = [&](size_t num_threads) {
+        auto f = make_function();
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::ConstantFolding>()->set_num_threads(num_threads);
+        pass_manager.run_passes(f);
+        EXPECT_EQ(count_ops_of_type<op::Reshape>(f), 0);
+        EXPECT_EQ(count_ops_of_type<op::Transpose>(f), 0);
+        EXPECT_EQ(count_ops_of_type<op::Quantize>(f), 0);
+        return f;
+    };
+
+    auto f_serial = fold(1);
+    auto f_parallel = fold(4);
+    auto result = [](const shared_ptr<Function>& f, size_t i) {
+        return as_type_ptr<op::Constant>(f->get_results().at(i)->get_argument(0));
+    };
+    EXPECT_EQ(result(f_serial, 0)->get_vector<float>(),
+              result(f_parallel, 0)->get_vector<float>());
+    EXPECT_EQ(result(f_serial, 1)->get_vector<float>(),
+              result(f_parallel, 1)->get_vector<float>());
+    EXPECT_EQ(result(f_serial, 2)->get_vector<int8_t>(),
+              result(f_parallel, 2)->get_vector<int8_t>());
+}
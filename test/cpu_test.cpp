@@ -15,15 +15,28 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
 #include <cstdio>
 #include <iostream>
+#include <limits>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <thread>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 #include "gtest/gtest.h"
 #include "misc.hpp"
 #include "ngraph/autodiff/adjoints.hpp"
+#include "ngraph/distributed/null.hpp"
+#include "ngraph/distributed/shared_memory.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
@@ -33,6 +46,9 @@
 #include "ngraph/op/erf.hpp"
 #include "ngraph/op/experimental/tile.hpp"
 #include "ngraph/op/fused/conv_fused.hpp"
+#include "ngraph/op/fused/layer_norm.hpp"
+#include "ngraph/op/fused/mvn.hpp"
+#include "ngraph/op/fused/normalize_l2.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/pass/constant_folding.hpp"
@@ -40,10 +56,17 @@
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_numa_allocator.hpp"
+#include "ngraph/runtime/cpu/cpu_scheduler.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/cpu_threading_runtime.hpp"
+#include "ngraph/runtime/cpu/kernel/sparse_matmul.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/sparse_matmul.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_layout_cost_model.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "util/all_close.hpp"
@@ -108,6 +131,140 @@ TEST(cpu_test, unhandled_op)
     ASSERT_THROW(backend->compile(f), unsupported_op);
 }
 
+TEST(cpu_test, allreduce_bucketing)
+{
+    // The CPU backend buckets these AllReduce ops and runs the Concat and Slice ops in place
+    auto make_function = []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{4});
+        auto C = make_shared<op::Parameter>(element::f32, Shape{3});
+        auto all_reduce_a = make_shared<op::AllReduce>(A);
+        auto all_reduce_b = make_shared<op::AllReduce>(B);
+        auto all_reduce_c = make_shared<op::AllReduce>(make_shared<op::Add>(C, C));
+        return make_shared<Function>(
+            NodeVector{make_shared<op::Multiply>(all_reduce_a, A), all_reduce_b, all_reduce_c},
+            ParameterVector{A, B, C});
+    };
+    // A single rank reduces to its own input
+    set_distributed_interface(unique_ptr<DistributedInterface>(
+        new distributed::SharedMemoryDistributedInterface("cpu_allreduce_bucketing", 1, 0)));
+    auto cpu_f = make_function();
+    compare_backends(cpu_f, make_function(), "CPU", "INTERPRETER");
+    set_distributed_interface(
+        unique_ptr<DistributedInterface>(new distributed::NullDistributedInterface()));
+    EXPECT_EQ(count_ops_of_type<op::AllReduce>(cpu_f), 1);
+}
+
+namespace
+{
+    // Stands in for two ranks holding the same data: every reduction doubles its input, and
+    // is slow enough that an op reading its result too early sees stale memory
+    class SlowDistributedInterface : public DistributedInterface
+    {
+    public:
+        const string& get_name() const override { return m_name; }
+        int get_size() override { return 2; }
+        int get_rank() override { return 0; }
+        void log_print(const string& /* timestamp */, const vector<char>& /* buf */) override {}
+        void all_reduce(void* in,
+                        void* out,
+                        element::Type_t /* element_type */,
+                        reduction::Type /* reduce_type */,
+                        size_t count) override
+        {
+            this_thread::sleep_for(chrono::milliseconds(20));
+            for (size_t i = 0; i < count; i++)
+            {
+                static_cast<float*>(out)[i] = 2 * static_cast<float*>(in)[i];
+            }
+            lock_guard<mutex> lock(m_mutex);
+            m_threads.insert(this_thread::get_id());
+        }
+        void broadcast(void*, element::Type_t, size_t, int) override {}
+        void recv(void*, element::Type_t, size_t, int) override {}
+        void send(const void*, element::Type_t, size_t, int) override {}
+
+        set<thread::id> get_threads()
+        {
+            lock_guard<mutex> lock(m_mutex);
+            return m_threads;
+        }
+
+    private:
+        string m_name{"slow"};
+        mutex m_mutex;
+        set<thread::id> m_threads;
+    };
+}
+
+TEST(cpu_test, async_allreduce)
+{
+    // The second AllReduce reads the first, and the Add reads both, so every consumer only
+    // sees the doubled values if it waits for the collective it depends on
+    auto make_function = []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{8});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{8});
+        auto all_reduce_a = make_shared<op::AllReduce>(A);
+        auto independent = make_shared<op::Multiply>(B, B);
+        auto all_reduce_b = make_shared<op::AllReduce>(make_shared<op::Add>(all_reduce_a, B));
+        return make_shared<Function>(
+            NodeVector{make_shared<op::Add>(all_reduce_b, independent), all_reduce_a},
+            ParameterVector{A, B});
+    };
+
+    auto run = [&](bool async, set<thread::id>& threads) {
+        auto slow = new SlowDistributedInterface();
+        set_distributed_interface(unique_ptr<DistributedInterface>(slow));
+        if (async)
+        {
+            set_environment("NGRAPH_CPU_ASYNC_ALLREDUCE", "1", 1);
+        }
+        auto backend = runtime::Backend::create("CPU");
+        auto handle = backend->compile(make_function());
+        if (async)
+        {
+            unset_environment("NGRAPH_CPU_ASYNC_ALLREDUCE");
+        }
+
+        auto a = backend->create_tensor(element::f32, Shape{8});
+        auto b = backend->create_tensor(element::f32, Shape{8});
+        auto result = backend->create_tensor(element::f32, Shape{8});
+        auto result_a = backend->create_tensor(element::f32, Shape{8});
+        copy_data(a, vector<float>{1, 2, 3, 4, 5, 6, 7, 8});
+        copy_data(b, vector<float>{1, 1, 2, 2, 3, 3, 4, 4});
+        vector<vector<float>> results;
+        for (int i = 0; i < 3; i++)
+        {
+            handle->call_with_validate({result, result_a}, {a, b});
+            results.push_back(read_vector<float>(result));
+            results.push_back(read_vector<float>(result_a));
+        }
+        threads = slow->get_threads();
+        set_distributed_interface(
+            unique_ptr<DistributedInterface>(new distributed::NullDistributedInterface()));
+        return results;
+    };
+
+    set<thread::id> blocking_threads;
+    set<thread::id> async_threads;
+    auto blocking = run(false, blocking_threads);
+    auto async = run(true, async_threads);
+
+    vector<float> expected_a{2, 4, 6, 8, 10, 12, 14, 16};
+    vector<float> expected{7, 11, 20, 24, 35, 39, 52, 56};
+    ASSERT_EQ(blocking.size(), async.size());
+    for (size_t i = 0; i < blocking.size(); i++)
+    {
+        EXPECT_EQ(blocking[i], i % 2 ? expected_a : expected);
+        EXPECT_EQ(async[i], blocking[i]);
+    }
+    // Blocking collectives run on the calling thread, asynchronous ones on the queue of the
+    // executable
+    EXPECT_EQ(blocking_threads, set<thread::id>{this_thread::get_id()});
+    EXPECT_EQ(async_threads.size(), 1);
+    EXPECT_EQ(async_threads.count(this_thread::get_id()), 0);
+}
+
 TEST(cpu_test, trivial_in_place_relu)
 {
     auto A = make_shared<op::Parameter>(element::f32, Shape{16, 1});
@@ -278,6 +435,34 @@ TEST(cpu_test, MLIR_DISABLE_TEST(reshape_layout_optimizations1))
     }
 }
 
+TEST(cpu_test, eltwise_layout_selection)
+{
+    // The first argument of the Multiply is plain and the second blocked. Keeping the plain
+    // layout would need a reorder of the convolution output and another one for the second
+    // convolution, so the blocked layout of the second argument is cheaper.
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 16, 8, 8});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{1, 16, 8, 8});
+        auto W1 = make_shared<op::Parameter>(element::f32, Shape{16, 16, 1, 1});
+        auto W2 = make_shared<op::Parameter>(element::f32, Shape{16, 16, 1, 1});
+        auto conv1 = make_shared<op::Convolution>(A, W1);
+        auto multiply = make_shared<op::Multiply>(B, conv1);
+        auto conv2 = make_shared<op::Convolution>(multiply, W2);
+        return make_shared<Function>(NodeVector{conv2}, ParameterVector{A, B, W1, W2});
+    };
+
+    auto cpu_f = make_function();
+    compare_backends(cpu_f, make_function(), "CPU", "INTERPRETER", 1.0e-4f, 1.0e-4f);
+    for (auto& node : cpu_f->get_ordered_ops())
+    {
+        if (is_type<op::Multiply>(node))
+        {
+            EXPECT_TRUE(runtime::cpu::pass::LayoutCostModel::is_blocked(
+                runtime::cpu::mkldnn_utils::get_output_mkldnn_md(node.get(), 0)));
+        }
+    }
+}
+
 TEST(cpu_test, MLIR_DISABLE_TEST(reshape_layout_optimizations2))
 {
     // ExpandDims - inner most and internal dims
@@ -2310,3 +2495,625 @@ TEST(cpu_test, one_hot_scalar_oob_in_3)
     handle->call_with_validate({result}, {a});
     EXPECT_EQ(r_data[3], 0);
 }
+
+TEST(cpu_test, default_threading_runtime)
+{
+    runtime::cpu::executor::ThreadingOptions options;
+    options.num_threads = 2;
+    runtime::cpu::executor::DefaultThreadingRuntime threading_runtime(options);
+    EXPECT_EQ(threading_runtime.get_num_threads(), 2);
+    EXPECT_EQ(threading_runtime.get_current_thread_id(), -1);
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t done = 0;
+    std::set<int> worker_ids;
+    for (size_t i = 0; i < 16; i++)
+    {
+        threading_runtime.schedule([&]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            worker_ids.insert(threading_runtime.get_current_thread_id());
+            done++;
+            cv.notify_one();
+        });
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&]() { return done == 16; });
+    for (int id : worker_ids)
+    {
+        EXPECT_GE(id, 0);
+        EXPECT_LT(id, 2);
+    }
+}
+
+TEST(cpu_test, pinned_openmp_keeps_caller_affinity)
+{
+    auto caller_cpus = runtime::cpu::executor::get_current_thread_affinity();
+    runtime::cpu::executor::ThreadingOptions options;
+    options.num_threads = 2;
+    options.pin_threads = true;
+    runtime::cpu::executor::DefaultThreadingRuntime threading_runtime(options);
+    threading_runtime.configure_openmp();
+    EXPECT_EQ(runtime::cpu::executor::get_current_thread_affinity(), caller_cpus);
+}
+
+TEST(cpu_test, threading_runtime_openmp_budget)
+{
+    // OpenMP gets the part of the budget the workers leave, and at least one thread
+    runtime::cpu::executor::ThreadingOptions options;
+    options.num_threads = 2;
+    options.thread_budget = 6;
+    runtime::cpu::executor::DefaultThreadingRuntime threading_runtime(options);
+    EXPECT_EQ(threading_runtime.get_num_openmp_threads(), 4);
+
+    options.thread_budget = 2;
+    runtime::cpu::executor::DefaultThreadingRuntime saturated_runtime(options);
+    EXPECT_EQ(saturated_runtime.get_num_openmp_threads(), 1);
+
+    auto& cpu_executor = runtime::cpu::executor::GetCPUExecutor();
+    EXPECT_EQ(cpu_executor.get_num_openmp_threads(),
+              cpu_executor.get_threading_runtime().get_num_openmp_threads());
+}
+
+#if defined(_OPENMP)
+TEST(cpu_test, threading_runtime_keeps_openmp_team_by_default)
+{
+    // Without a thread budget the OpenMP team keeps the size OMP_NUM_THREADS or the
+    // application gave it
+    int caller_openmp_threads = omp_get_max_threads();
+    runtime::cpu::executor::ThreadingOptions options;
+    options.num_threads = 2;
+    runtime::cpu::executor::DefaultThreadingRuntime threading_runtime(options);
+    threading_runtime.configure_openmp();
+    EXPECT_EQ(omp_get_max_threads(), caller_openmp_threads);
+    EXPECT_EQ(threading_runtime.get_num_openmp_threads(), caller_openmp_threads);
+    runtime::cpu::executor::get_threading_runtime()->configure_openmp();
+    EXPECT_EQ(omp_get_max_threads(), caller_openmp_threads);
+
+    // An explicit budget resizes it
+    options.thread_budget = 3;
+    runtime::cpu::executor::DefaultThreadingRuntime budget_runtime(options);
+    budget_runtime.configure_openmp();
+    EXPECT_EQ(omp_get_max_threads(), 1);
+    omp_set_num_threads(caller_openmp_threads);
+}
+#endif
+
+TEST(cpu_test, numa_executor_affinity)
+{
+    auto numa_nodes = runtime::cpu::executor::get_numa_nodes();
+    if (numa_nodes.empty())
+    {
+        // No NUMA topology to bind to
+        return;
+    }
+    int numa_node = numa_nodes.back();
+    auto node_cpus = runtime::cpu::executor::get_numa_node_cpus(numa_node);
+    runtime::cpu::executor::ThreadingOptions options;
+    options.num_threads = 2;
+    options.numa_node = numa_node;
+    auto threading_runtime =
+        std::make_shared<runtime::cpu::executor::DefaultThreadingRuntime>(options);
+    runtime::cpu::executor::CPUExecutor cpu_executor({threading_runtime}, {numa_node});
+    int arena = cpu_executor.get_numa_arena(numa_node);
+    EXPECT_EQ(cpu_executor.get_arena_cpus(arena), node_cpus);
+
+    // Eigen kernels run on the node's thread pool
+    std::vector<std::vector<int>> worker_cpus(4);
+    Eigen::Barrier barrier(static_cast<unsigned>(worker_cpus.size()));
+    for (auto& cpus : worker_cpus)
+    {
+        cpu_executor.get_device(arena).enqueueNoNotification([&cpus, &barrier]() {
+            cpus = runtime::cpu::executor::get_current_thread_affinity();
+            barrier.Notify();
+        });
+    }
+    barrier.Wait();
+    for (auto& cpus : worker_cpus)
+    {
+        EXPECT_EQ(cpus, node_cpus);
+    }
+
+    // Kernels run on the calling thread are moved to the node for the duration of a call
+    auto caller_cpus = runtime::cpu::executor::get_current_thread_affinity();
+    {
+        runtime::cpu::executor::AffinityScope scope(cpu_executor.get_arena_cpus(arena), 2);
+        EXPECT_EQ(runtime::cpu::executor::get_current_thread_affinity(), node_cpus);
+    }
+    EXPECT_EQ(runtime::cpu::executor::get_current_thread_affinity(), caller_cpus);
+}
+
+TEST(cpu_test, numa_threading_runtimes)
+{
+    auto numa_nodes = runtime::cpu::executor::get_numa_nodes();
+    if (numa_nodes.empty())
+    {
+        // No NUMA topology to bind to
+        return;
+    }
+    int numa_node = numa_nodes.back();
+    auto runtimes = runtime::cpu::executor::get_numa_threading_runtimes({numa_node});
+    ASSERT_EQ(runtimes.size(), 1);
+    auto node_runtime =
+        std::dynamic_pointer_cast<runtime::cpu::executor::DefaultThreadingRuntime>(runtimes[0]);
+    ASSERT_TRUE(node_runtime);
+    EXPECT_EQ(node_runtime->get_cpus(), runtime::cpu::executor::get_numa_node_cpus(numa_node));
+
+    // The NUMA runtimes lock the runtime in like get_threading_runtime does, so a runtime
+    // installed afterwards is rejected rather than silently ignored
+    runtime::cpu::executor::ThreadingOptions options;
+    options.num_threads = 1;
+    EXPECT_THROW(runtime::cpu::executor::set_threading_runtime(
+                     std::make_shared<runtime::cpu::executor::DefaultThreadingRuntime>(options)),
+                 ngraph_error);
+}
+
+TEST(cpu_test, numa_allocator)
+{
+    // Binding fails silently on machines without NUMA support, but the memory must still be
+    // usable and released correctly.
+    auto numa_nodes = runtime::cpu::executor::get_numa_nodes();
+    int numa_node = numa_nodes.empty() ? 0 : numa_nodes.back();
+    runtime::cpu::NumaAllocator allocator(numa_node);
+    EXPECT_EQ(allocator.get_numa_node(), numa_node);
+
+    std::vector<void*> allocations;
+    for (size_t size : {1, 4096, 100000})
+    {
+        void* ptr = allocator.malloc(size, 64);
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0);
+        memset(ptr, 0x5a, size);
+        allocations.push_back(ptr);
+    }
+    for (void* ptr : allocations)
+    {
+        allocator.free(ptr);
+    }
+}
+
+TEST(cpu_test, native_normalization_kernels)
+{
+    auto make_function = [](const element::Type& et) -> std::shared_ptr<Function> {
+        auto data = make_shared<op::Parameter>(et, Shape{4, 6, 40});
+        auto delta = make_shared<op::Parameter>(et, Shape{4, 6, 40});
+        auto scale = make_shared<op::Parameter>(et, Shape{40});
+        auto bias = make_shared<op::Parameter>(et, Shape{40});
+        auto flat_scale = make_shared<op::Parameter>(et, Shape{6 * 40});
+        auto flat_bias = make_shared<op::Parameter>(et, Shape{6 * 40});
+        auto image = make_shared<op::Parameter>(et, Shape{2, 3, 5, 7});
+
+        // Normalized over the last axis and over the last two axes, with and without affine
+        auto layer_norm = make_shared<op::LayerNorm>(data, scale, bias, true, 2, 1e-5);
+        auto layer_norm_flat =
+            make_shared<op::LayerNorm>(data, flat_scale, flat_bias, false, 1, 1e-5);
+        auto layer_norm_no_affine = make_shared<op::LayerNorm>(data, true, 1, 1e-5);
+        auto layer_norm_bprop = make_shared<op::LayerNormBackprop>(data, delta, scale, 2, 1e-5);
+        auto layer_norm_bprop_stats =
+            make_shared<op::LayerNormBackprop>(data,
+                                               delta,
+                                               layer_norm_no_affine->output(1),
+                                               layer_norm_no_affine->output(2),
+                                               1,
+                                               1e-5);
+        auto mvn = make_shared<op::MVN>(image, false, true, 1e-5);
+        auto mvn_across_channels = make_shared<op::MVN>(image, true, false, 1e-5);
+        auto mvn_axes = make_shared<op::MVN>(image, AxisSet{1, 3}, true, 1e-5);
+        auto axes = op::Constant::create(element::i64, Shape{1}, {1});
+        auto normalize = make_shared<op::NormalizeL2>(image, axes, 1e-7, op::EpsMode::ADD);
+        auto inner_axes = op::Constant::create(element::i64, Shape{2}, {2, 3});
+        auto normalize_max =
+            make_shared<op::NormalizeL2>(image, inner_axes, 1e-7, op::EpsMode::MAX);
+
+        OutputVector outputs;
+        for (auto node : NodeVector{layer_norm,
+                                    layer_norm_flat,
+                                    layer_norm_no_affine,
+                                    layer_norm_bprop,
+                                    layer_norm_bprop_stats})
+        {
+            for (auto& output : node->outputs())
+            {
+                outputs.push_back(output);
+            }
+        }
+        outputs.push_back(mvn);
+        outputs.push_back(mvn_across_channels);
+        outputs.push_back(mvn_axes);
+        outputs.push_back(normalize);
+        outputs.push_back(normalize_max);
+        return make_shared<Function>(
+            outputs, ParameterVector{data, delta, scale, bias, flat_scale, flat_bias, image});
+    };
+    // The CPU backend runs these ops natively instead of decomposing them
+    auto expect_native = [](const std::shared_ptr<Function>& f) {
+        EXPECT_EQ(count_ops_of_type<op::LayerNorm>(f), 3);
+        EXPECT_EQ(count_ops_of_type<op::LayerNormBackprop>(f), 2);
+        EXPECT_EQ(count_ops_of_type<op::MVN>(f), 3);
+        EXPECT_EQ(count_ops_of_type<op::NormalizeL2>(f), 2);
+    };
+
+    auto cpu_f = make_function(element::f32);
+    compare_backends(cpu_f, make_function(element::f32), "CPU", "INTERPRETER", 1e-4f, 1e-5f);
+    expect_native(cpu_f);
+
+    auto cpu_f64 = make_function(element::f64);
+    test::Uniform<double> rng(-1.0, 1.0);
+    vector<vector<double>> args;
+    for (auto& param : cpu_f64->get_parameters())
+    {
+        args.emplace_back(shape_size(param->get_shape()));
+        rng.initialize(args.back());
+    }
+    auto cpu_results = execute(cpu_f64, args, "CPU");
+    auto int_results = execute(make_function(element::f64), args, "INTERPRETER");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1e-8, 1e-10));
+    }
+    expect_native(cpu_f64);
+}
+
+TEST(cpu_test, topk_heap_and_partition_selection)
+{
+    // Slices of 500 values select with a heap for k <= 31 and partition them for larger k. The
+    // axis of the 3D input is strided, the one of the 2D input innermost.
+    const size_t n = 500;
+    for (Shape shape : {Shape{3, n, 4}, Shape{6, n}})
+    {
+        const size_t inner = shape_size(shape) / (shape[0] * n);
+        for (size_t k : {3, 31, 32, 100})
+        {
+            for (auto sort : {op::TopK::SortType::SORT_VALUES,
+                              op::TopK::SortType::SORT_INDICES,
+                              op::TopK::SortType::NONE})
+            {
+                SCOPED_TRACE("k = " + to_string(k) + ", inner = " + to_string(inner) +
+                             ", sort = " + to_string(static_cast<int>(sort)));
+                auto make_function = [&]() -> std::shared_ptr<Function> {
+                    auto A = make_shared<op::Parameter>(element::f32, shape);
+                    NodeVector results;
+                    for (bool compute_max : {true, false})
+                    {
+                        auto topk =
+                            make_shared<op::TopK>(A, 1, element::i32, k, compute_max, sort);
+                        results.push_back(make_shared<op::GetOutputElement>(topk, 1));
+                        results.push_back(make_shared<op::Convert>(
+                            make_shared<op::GetOutputElement>(topk, 0), element::f32));
+                    }
+                    return make_shared<Function>(results, ParameterVector{A});
+                };
+                if (sort != op::TopK::SortType::NONE)
+                {
+                    compare_backends(make_function(), make_function(), "CPU", "INTERPRETER");
+                    continue;
+                }
+
+                // Without sorting only the set of (value, index) pairs of a slice is defined
+                test::Uniform<float> rng(-1.0f, 1.0f);
+                vector<vector<float>> args{vector<float>(shape_size(shape))};
+                rng.initialize(args[0]);
+                auto cpu_results = execute(make_function(), args, "CPU");
+                auto int_results = execute(make_function(), args, "INTERPRETER");
+                auto selected = [&](const vector<vector<float>>& results,
+                                    size_t result,
+                                    size_t slice) {
+                    vector<pair<float, float>> pairs;
+                    size_t o = slice / inner;
+                    size_t i = slice % inner;
+                    for (size_t j = 0; j < k; j++)
+                    {
+                        size_t offset = (o * k + j) * inner + i;
+                        pairs.emplace_back(results[result][offset],
+                                           results[result + 1][offset]);
+                    }
+                    std::sort(pairs.begin(), pairs.end());
+                    return pairs;
+                };
+                for (size_t result : {0, 2})
+                {
+                    for (size_t slice = 0; slice < shape[0] * inner; slice++)
+                    {
+                        EXPECT_EQ(selected(cpu_results, result, slice),
+                                  selected(int_results, result, slice));
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(cpu_test, dynamic_quantize_dot)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3, 32});
+        vector<float> weights(32 * 12);
+        for (size_t i = 0; i < weights.size(); i++)
+        {
+            weights[i] = std::sin(static_cast<float>(i));
+        }
+        auto W = make_shared<op::Constant>(element::f32, Shape{32, 12}, weights);
+        return make_shared<Function>(make_shared<op::Dot>(A, W), ParameterVector{A});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto int_backend = runtime::Backend::create("INTERPRETER");
+    auto cpu_f = make_function();
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_enable("CPUDynamicQuantization", true);
+    auto handle = backend->compile(cpu_f, pass_config);
+    auto int_handle = int_backend->compile(make_function());
+    EXPECT_EQ(count_ops_of_type<op::Dot>(cpu_f), 0);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    auto a = backend->create_tensor(element::f32, Shape{2, 3, 32});
+    auto result = backend->create_tensor(element::f32, Shape{2, 3, 12});
+    auto int_a = int_backend->create_tensor(element::f32, Shape{2, 3, 32});
+    auto int_result = int_backend->create_tensor(element::f32, Shape{2, 3, 12});
+    // The activation scale is recomputed on every call, so inputs of different ranges
+    // quantize equally well
+    for (float range : {1.0f, 100.0f})
+    {
+        vector<float> input(2 * 3 * 32);
+        rng.initialize(input);
+        for (float& value : input)
+        {
+            value *= range;
+        }
+        copy_data(a, input);
+        copy_data(int_a, input);
+        handle->call_with_validate({result}, {a});
+        int_handle->call_with_validate({int_result}, {int_a});
+
+        auto expected = read_vector<float>(int_result);
+        auto actual = read_vector<float>(result);
+        float output_max = 0;
+        for (float value : expected)
+        {
+            output_max = std::max(output_max, std::fabs(value));
+        }
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+            // Activations only keep 7 bits
+            EXPECT_NEAR(expected[i], actual[i], 0.04f * output_max) << "at " << i;
+        }
+    }
+}
+
+TEST(cpu_test, dynamic_quantize_dot_extreme_values)
+{
+    // Every product is the largest one possible. With 8-bit activations pairs of them would
+    // saturate the int16 sums of the kernels used without VNNI.
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{4, 64});
+        auto W = make_shared<op::Constant>(element::f32, Shape{64, 8}, vector<float>(64 * 8, 1));
+        return make_shared<Function>(make_shared<op::Dot>(A, W), ParameterVector{A});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_f = make_function();
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_enable("CPUDynamicQuantization", true);
+    auto handle = backend->compile(cpu_f, pass_config);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(cpu_f), 0);
+
+    auto a = backend->create_tensor(element::f32, Shape{4, 64});
+    auto result = backend->create_tensor(element::f32, Shape{4, 8});
+    copy_data(a, vector<float>(4 * 64, 1));
+    handle->call_with_validate({result}, {a});
+    for (float value : read_vector<float>(result))
+    {
+        EXPECT_NEAR(value, 64.0f, 1e-3f);
+    }
+}
+
+TEST(cpu_test, sparsify_dot_and_pointwise_convolution)
+{
+    // Weights with about 80% zeros
+    auto make_sparse = [](size_t count) {
+        vector<float> values(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            values[i] = i % 5 == 2 ? std::cos(static_cast<float>(i)) : 0;
+        }
+        return values;
+    };
+    auto make_function = [&]() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3, 40});
+        auto W = make_shared<op::Constant>(element::f32, Shape{40, 24}, make_sparse(40 * 24));
+        auto dot = make_shared<op::Dot>(A, W);
+        auto B = make_shared<op::Parameter>(element::f32, Shape{5, 40});
+        auto W2 = make_shared<op::Constant>(element::f32, Shape{16, 40}, make_sparse(16 * 40));
+        auto matmul = make_shared<op::MatMul>(B, W2, false, true);
+        auto C = make_shared<op::Parameter>(element::f32, Shape{2, 32, 6, 7});
+        auto F = make_shared<op::Constant>(
+            element::f32, Shape{12, 32, 1, 1}, make_sparse(12 * 32));
+        auto conv = make_shared<op::Convolution>(C, F);
+        // Not pointwise, stays dense
+        auto F2 = make_shared<op::Constant>(
+            element::f32, Shape{4, 32, 3, 3}, make_sparse(4 * 32 * 9));
+        auto conv2 = make_shared<op::Convolution>(C, F2);
+        return make_shared<Function>(NodeVector{dot, matmul, conv, conv2},
+                                     ParameterVector{A, B, C});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto int_backend = runtime::Backend::create("INTERPRETER");
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_enable("CPUSparsify", true);
+    auto handle = backend->compile(cpu_f, pass_config);
+    auto int_handle = int_backend->compile(int_f);
+    EXPECT_EQ(count_ops_of_type<op::SparseDot>(cpu_f), 2);
+    EXPECT_EQ(count_ops_of_type<op::SparseConvolution>(cpu_f), 1);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<shared_ptr<runtime::Tensor>> args;
+    vector<shared_ptr<runtime::Tensor>> int_args;
+    for (auto& param : int_f->get_parameters())
+    {
+        vector<float> input(shape_size(param->get_shape()));
+        rng.initialize(input);
+        args.push_back(backend->create_tensor(element::f32, param->get_shape()));
+        int_args.push_back(int_backend->create_tensor(element::f32, param->get_shape()));
+        copy_data(args.back(), input);
+        copy_data(int_args.back(), input);
+    }
+    vector<shared_ptr<runtime::Tensor>> results;
+    vector<shared_ptr<runtime::Tensor>> int_results;
+    for (auto& result : int_f->get_results())
+    {
+        results.push_back(backend->create_tensor(element::f32, result->get_shape()));
+        int_results.push_back(int_backend->create_tensor(element::f32, result->get_shape()));
+    }
+    handle->call_with_validate(results, args);
+    int_handle->call_with_validate(int_results, int_args);
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close_f(
+            read_vector<float>(int_results[i]), read_vector<float>(results[i]), 20, 1e-5f));
+    }
+}
+
+TEST(cpu_test, sparse_matmul_skips_zeros)
+{
+    // sparse [2, 2] = {{inf, 0}, {0, 1}}. CSR does not keep IEEE special-value propagation:
+    // a zero activation times the stored inf and a NaN activation times the pruned zeros are
+    // skipped, where a dense Dot would give NaN
+    vector<float> values{std::numeric_limits<float>::infinity(), 1};
+    vector<int32_t> column_indices{0, 1};
+    vector<int32_t> row_offsets{0, 1, 2};
+    vector<float> dense{0, 2, std::numeric_limits<float>::quiet_NaN(), 0};
+    vector<float> out(4);
+    runtime::cpu::kernel::dense_sparse_matmul(dense.data(),
+                                              values.data(),
+                                              column_indices.data(),
+                                              row_offsets.data(),
+                                              out.data(),
+                                              2,
+                                              2,
+                                              2);
+    EXPECT_EQ(out[0], 0);
+    EXPECT_EQ(out[1], 2);
+    EXPECT_TRUE(std::isnan(out[2]));
+    EXPECT_EQ(out[3], 0);
+}
+
+TEST(cpu_test, scheduler_runs_many_models)
+{
+    auto backend = runtime::Backend::create("CPU");
+    Shape shape{32, 32};
+    auto compile = [&](float weight) {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto W =
+            op::Constant::create(element::f32, shape, vector<float>(shape_size(shape), weight));
+        auto dot = make_shared<op::Dot>(A, W);
+        return backend->compile(make_shared<Function>(dot, ParameterVector{A}));
+    };
+
+    runtime::cpu::SchedulerOptions options;
+    options.num_cores = 4;
+    runtime::cpu::CPUScheduler scheduler(options);
+    runtime::cpu::ModelOptions limited;
+    limited.priority = 1;
+    limited.max_queued = 2;
+    auto model = scheduler.add_model(compile(1));
+    auto limited_model = scheduler.add_model(compile(2), limited);
+
+    auto input = backend->create_tensor(element::f32, shape);
+    copy_data(input, vector<float>(shape_size(shape), 1));
+    vector<shared_ptr<runtime::Tensor>> outputs;
+    vector<std::future<void>> results;
+    // Nothing starts while paused, so the queue limit is hit deterministically
+    scheduler.pause();
+    size_t rejected = 0;
+    for (size_t i = 0; i < 4; i++)
+    {
+        for (auto id : {model, limited_model})
+        {
+            auto output = backend->create_tensor(element::f32, shape);
+            try
+            {
+                results.push_back(scheduler.submit(id, {output}, {input}));
+                outputs.push_back(output);
+            }
+            catch (const runtime::cpu::SchedulerRejected&)
+            {
+                rejected++;
+            }
+        }
+    }
+    EXPECT_EQ(rejected, 2);
+    EXPECT_EQ(scheduler.get_queued(), 6);
+    scheduler.resume();
+    for (auto& result : results)
+    {
+        result.get();
+    }
+
+    EXPECT_EQ(scheduler.get_queued(), 0);
+    EXPECT_EQ(scheduler.get_statistics(model).completed, 4);
+    EXPECT_EQ(scheduler.get_statistics(limited_model).completed, 2);
+    EXPECT_EQ(scheduler.get_statistics(limited_model).rejected, 2);
+    EXPECT_GT(scheduler.get_statistics(model).core_seconds, 0);
+    // Outputs alternate between the two models while both still had room in their queues
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        float expected = (i < 4 && i % 2 == 1) ? 64 : 32;
+        EXPECT_EQ(read_vector<float>(outputs[i]), vector<float>(shape_size(shape), expected));
+    }
+}
+
+TEST(cpu_test, scheduler_partition_bounds_concurrency)
+{
+    // Tasks of a partition occupy at most its width of the shared workers
+    runtime::cpu::executor::ThreadingOptions options;
+    options.num_threads = 4;
+    auto threading_runtime =
+        std::make_shared<runtime::cpu::executor::DefaultThreadingRuntime>(options);
+    std::atomic<int> running{0};
+    std::atomic<int> peak{0};
+    const int num_tasks = 32;
+    Eigen::Barrier barrier(num_tasks);
+    {
+        runtime::cpu::executor::PartitionThreadPool pool(threading_runtime, 2);
+        for (int i = 0; i < num_tasks; i++)
+        {
+            pool.Schedule([&]() {
+                int now = ++running;
+                int seen = peak.load();
+                while (now > seen && !peak.compare_exchange_weak(seen, now))
+                {
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                running--;
+                barrier.Notify();
+            });
+        }
+        barrier.Wait();
+    }
+    EXPECT_LE(peak.load(), 2);
+    EXPECT_GE(peak.load(), 1);
+
+    // A partition of width 1 has no shared workers, its tasks run on the calling thread
+    {
+        runtime::cpu::executor::PartitionThreadPool pool(threading_runtime, 0);
+        std::thread::id task_thread;
+        pool.Schedule([&]() { task_thread = std::this_thread::get_id(); });
+        EXPECT_EQ(task_thread, std::this_thread::get_id());
+    }
+
+    // Within a partition Eigen kernels get a device of its width, and OpenMP regions too
+    auto& cpu_executor = runtime::cpu::executor::GetCPUExecutor();
+    Eigen::ThreadPoolDevice* shared_device = &cpu_executor.get_device(0);
+    {
+        runtime::cpu::executor::PartitionScope partition(2);
+        EXPECT_NE(&cpu_executor.get_device(0), shared_device);
+        EXPECT_EQ(cpu_executor.get_device(0).numThreads(), 2);
+#if defined(_OPENMP)
+        EXPECT_EQ(omp_get_max_threads(), 2);
+#endif
+    }
+    EXPECT_EQ(&cpu_executor.get_device(0), shared_device);
+}
@@ -0,0 +1,157 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/distributed/shared_memory.hpp"
+#include "ngraph/thread_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using SharedMemoryInterface = distributed::SharedMemoryDistributedInterface;
+
+// Runs func on size ranks, each in its own thread with its own interface instance
+static void run_ranks(const string& name,
+                      int size,
+                      size_t slot_bytes,
+                      function<void(SharedMemoryInterface&)> func)
+{
+    vector<thread> threads;
+    for (int rank = 0; rank < size; rank++)
+    {
+        threads.emplace_back([&, rank]() {
+            SharedMemoryInterface distributed_interface(name, size, rank, slot_bytes);
+            func(distributed_interface);
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+}
+
+static void test_all_reduce(SharedMemoryInterface::AllReduceAlgorithm algorithm,
+                            const string& name)
+{
+    const int size = 3;
+    // 100 floats with 64 byte slots exercises chunking and uneven partitions
+    const size_t count = 100;
+    run_ranks(name, size, 64, [&](SharedMemoryInterface& distributed_interface) {
+        distributed_interface.set_all_reduce_algorithm(algorithm);
+        int rank = distributed_interface.get_rank();
+        vector<float> in(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            in[i] = static_cast<float>(rank * 1000 + i);
+        }
+
+        vector<float> out(count);
+        distributed_interface.all_reduce(
+            in.data(), out.data(), element::Type_t::f32, reduction::Type::SUM, count);
+        for (size_t i = 0; i < count; i++)
+        {
+            EXPECT_EQ(out[i], 3000.0f + 3 * i);
+        }
+
+        distributed_interface.all_reduce(
+            in.data(), out.data(), element::Type_t::f32, reduction::Type::MAX, count);
+        for (size_t i = 0; i < count; i++)
+        {
+            EXPECT_EQ(out[i], 2000.0f + i);
+        }
+
+        vector<int64_t> int_data(count, rank + 2);
+        distributed_interface.all_reduce(int_data.data(),
+                                         int_data.data(),
+                                         element::Type_t::i64,
+                                         reduction::Type::PROD,
+                                         count);
+        for (size_t i = 0; i < count; i++)
+        {
+            EXPECT_EQ(int_data[i], 2 * 3 * 4);
+        }
+    });
+}
+
+TEST(distributed, shared_memory_all_reduce_reduce_scatter)
+{
+    test_all_reduce(SharedMemoryInterface::AllReduceAlgorithm::REDUCE_SCATTER,
+                    "test_reduce_scatter");
+}
+
+TEST(distributed, shared_memory_all_reduce_tree)
+{
+    test_all_reduce(SharedMemoryInterface::AllReduceAlgorithm::TREE, "test_tree");
+}
+
+TEST(distributed, shared_memory_broadcast_send_recv)
+{
+    const size_t count = 50;
+    run_ranks("test_p2p", 2, 64, [&](SharedMemoryInterface& distributed_interface) {
+        int rank = distributed_interface.get_rank();
+        vector<int32_t> data(count, rank == 1 ? 7 : 0);
+        distributed_interface.broadcast(data.data(), element::Type_t::i32, count, 1);
+        EXPECT_EQ(data, vector<int32_t>(count, 7));
+
+        if (rank == 0)
+        {
+            vector<int32_t> message(count);
+            for (size_t i = 0; i < count; i++)
+            {
+                message[i] = static_cast<int32_t>(i);
+            }
+            distributed_interface.send(message.data(), element::Type_t::i32, count, 1);
+        }
+        else
+        {
+            vector<int32_t> message(count);
+            distributed_interface.recv(message.data(), element::Type_t::i32, count, 0);
+            for (size_t i = 0; i < count; i++)
+            {
+                EXPECT_EQ(message[i], i);
+            }
+        }
+    });
+}
+
+TEST(distributed, shared_memory_create_from_env)
+{
+    setenv("NGRAPH_DISTRIBUTED_SHM_SIZE", "1", 1);
+    setenv("NGRAPH_DISTRIBUTED_SHM_NAME", "test_create_from_env", 1);
+    setenv("NGRAPH_DISTRIBUTED_SHM_REDUCE_THREADS", "3", 1);
+    {
+        auto created = SharedMemoryInterface::create_from_env();
+        auto shm = dynamic_cast<SharedMemoryInterface*>(created.get());
+        ASSERT_NE(shm, nullptr);
+        EXPECT_EQ(shm->get_num_reduce_threads(), 3);
+    }
+    // By default a single rank gets the whole shared pool
+    unsetenv("NGRAPH_DISTRIBUTED_SHM_REDUCE_THREADS");
+    {
+        auto created = SharedMemoryInterface::create_from_env();
+        auto shm = dynamic_cast<SharedMemoryInterface*>(created.get());
+        ASSERT_NE(shm, nullptr);
+        EXPECT_EQ(shm->get_num_reduce_threads(), ThreadPool::get_shared().get_max_threads());
+    }
+    unsetenv("NGRAPH_DISTRIBUTED_SHM_SIZE");
+    unsetenv("NGRAPH_DISTRIBUTED_SHM_NAME");
+}
@@ -0,0 +1,217 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <chrono>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/dynamic_batcher.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#ifdef NGRAPH_INTERPRETER_ENABLE
+// x * W + b on [?, 4] inputs
+static shared_ptr<Function> make_dense_function()
+{
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 4});
+    auto W = op::Constant::create(
+        element::f32, Shape{4, 3}, {1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 1});
+    auto B = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto dot = make_shared<op::Dot>(A, W);
+    return make_shared<Function>(make_shared<op::Add>(dot, B), ParameterVector{A, B});
+}
+
+TEST(dynamic_batcher, default_buckets)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BatcherOptions options;
+    options.max_batch_size = 12;
+    runtime::DynamicBatcher batcher(make_dense_function(), backend, options);
+    EXPECT_EQ(batcher.get_buckets(), (vector<size_t>{1, 2, 4, 8, 12}));
+
+    options.buckets = {3, 6, 20};
+    runtime::DynamicBatcher custom(make_dense_function(), backend, options);
+    EXPECT_EQ(custom.get_buckets(), (vector<size_t>{3, 6, 12}));
+}
+
+TEST(dynamic_batcher, coalesces_requests)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BatcherOptions options;
+    options.max_batch_size = 8;
+    // Long enough that the batch only runs once it is full
+    options.max_latency = chrono::seconds(10);
+    runtime::DynamicBatcher batcher(make_dense_function(), backend, options);
+
+    vector<shared_ptr<runtime::Tensor>> outputs;
+    vector<future<void>> results;
+    for (size_t i = 0; i < 8; i++)
+    {
+        float x = static_cast<float>(i);
+        auto a = backend->create_tensor(element::f32, Shape{1, 4});
+        copy_data(a, vector<float>{x, 2 * x, 3 * x, 1});
+        auto b = backend->create_tensor(element::f32, Shape{1, 3});
+        copy_data(b, vector<float>{0, 0, x});
+        outputs.push_back(backend->create_tensor(element::f32, Shape{1, 3}));
+        results.push_back(batcher.submit({outputs.back()}, {a, b}));
+    }
+    for (auto& result : results)
+    {
+        result.get();
+    }
+    EXPECT_EQ(batcher.get_batch_count(), 1);
+    for (size_t i = 0; i < 8; i++)
+    {
+        float x = static_cast<float>(i);
+        EXPECT_EQ(read_vector<float>(outputs[i]), (vector<float>{x + 1, 2 * x + 1, 4 * x + 1}));
+    }
+}
+
+TEST(dynamic_batcher, runs_partial_batch_at_deadline)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BatcherOptions options;
+    options.max_batch_size = 8;
+    options.max_latency = chrono::milliseconds(1);
+    runtime::DynamicBatcher batcher(make_dense_function(), backend, options);
+
+    // One request of two samples, padded to the bucket of 2 or 4
+    auto a = backend->create_tensor(element::f32, Shape{2, 4});
+    copy_data(a, vector<float>{1, 2, 3, 4, 0, 0, 0, -1});
+    auto b = backend->create_tensor(element::f32, Shape{2, 3});
+    copy_data(b, vector<float>{1, 1, 1, 0, 0, 0});
+    auto output = backend->create_tensor(element::f32, Shape{2, 3});
+    batcher.submit({output}, {a, b}).get();
+    EXPECT_EQ(read_vector<float>(output), (vector<float>{6, 7, 8, -1, -1, -1}));
+    EXPECT_EQ(batcher.get_batch_count(), 1);
+}
+
+TEST(dynamic_batcher, pads_partial_batch)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BatcherOptions options;
+    options.max_batch_size = 4;
+    options.buckets = {4};
+    options.max_latency = chrono::milliseconds(1);
+    runtime::DynamicBatcher batcher(make_dense_function(), backend, options);
+
+    // A full batch leaves its samples in the staging buffers
+    auto a = backend->create_tensor(element::f32, Shape{4, 4});
+    copy_data(a, vector<float>(16, 100));
+    auto b = backend->create_tensor(element::f32, Shape{4, 3});
+    copy_data(b, vector<float>(12, 100));
+    auto output = backend->create_tensor(element::f32, Shape{4, 3});
+    batcher.submit({output}, {a, b}).get();
+
+    // Three samples run in the bucket of 4
+    auto partial_a = backend->create_tensor(element::f32, Shape{3, 4});
+    copy_data(partial_a, vector<float>{1, 2, 3, 4, 0, 0, 0, -1, 1, 0, 0, 0});
+    auto partial_b = backend->create_tensor(element::f32, Shape{3, 3});
+    copy_data(partial_b, vector<float>{1, 1, 1, 0, 0, 0, 0, 0, 2});
+    auto partial_output = backend->create_tensor(element::f32, Shape{3, 3});
+    batcher.submit({partial_output}, {partial_a, partial_b}).get();
+    EXPECT_EQ(read_vector<float>(partial_output),
+              (vector<float>{6, 7, 8, -1, -1, -1, 1, 0, 2}));
+    EXPECT_EQ(batcher.get_batch_count(), 2);
+
+    // Softmax over the batch axis sees the padding sample, which must be zero rather than
+    // what the previous batch left
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 2});
+    auto softmax =
+        make_shared<Function>(make_shared<op::Softmax>(A, AxisSet{0}), ParameterVector{A});
+    runtime::DynamicBatcher softmax_batcher(softmax, backend, options);
+    auto full = backend->create_tensor(element::f32, Shape{4, 2});
+    copy_data(full, vector<float>(8, 5));
+    auto full_output = backend->create_tensor(element::f32, Shape{4, 2});
+    softmax_batcher.submit({full_output}, {full}).get();
+    auto zeros = backend->create_tensor(element::f32, Shape{3, 2});
+    copy_data(zeros, vector<float>(6, 0));
+    auto zeros_output = backend->create_tensor(element::f32, Shape{3, 2});
+    softmax_batcher.submit({zeros_output}, {zeros}).get();
+    EXPECT_EQ(read_vector<float>(zeros_output), vector<float>(6, 0.25f));
+}
+
+TEST(dynamic_batcher, rejects_invalid_requests)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BatcherOptions options;
+    options.max_batch_size = 2;
+    runtime::DynamicBatcher batcher(make_dense_function(), backend, options);
+
+    auto output = backend->create_tensor(element::f32, Shape{3, 3});
+    EXPECT_THROW(batcher.submit({output},
+                                {backend->create_tensor(element::f32, Shape{3, 4}),
+                                 backend->create_tensor(element::f32, Shape{3, 3})}),
+                 CheckFailure);
+    EXPECT_THROW(batcher.submit({output},
+                                {backend->create_tensor(element::f32, Shape{1, 5}),
+                                 backend->create_tensor(element::f32, Shape{1, 3})}),
+                 CheckFailure);
+    // The output must hold as many samples as the inputs
+    EXPECT_THROW(batcher.submit({output},
+                                {backend->create_tensor(element::f32, Shape{2, 4}),
+                                 backend->create_tensor(element::f32, Shape{2, 3})}),
+                 CheckFailure);
+    // One input and one output per parameter and result
+    EXPECT_THROW(batcher.submit({output}, {backend->create_tensor(element::f32, Shape{1, 4})}),
+                 CheckFailure);
+    EXPECT_THROW(batcher.submit({},
+                                {backend->create_tensor(element::f32, Shape{1, 4}),
+                                 backend->create_tensor(element::f32, Shape{1, 3})}),
+                 CheckFailure);
+    EXPECT_THROW(batcher.submit({backend->create_tensor(element::f64, Shape{1, 3})},
+                                {backend->create_tensor(element::f32, Shape{1, 4}),
+                                 backend->create_tensor(element::f32, Shape{1, 3})}),
+                 CheckFailure);
+}
+
+TEST(dynamic_batcher, rejects_static_batch_axis)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto f = make_shared<Function>(make_shared<op::Negative>(A), ParameterVector{A});
+    EXPECT_THROW(runtime::DynamicBatcher(f, backend, runtime::BatcherOptions()), CheckFailure);
+
+    // Without a parameter there is no batch size to take from a request
+    auto constant = make_shared<Function>(
+        op::Constant::create(element::f32, Shape{2}, {1, 2}), ParameterVector{});
+    EXPECT_THROW(runtime::DynamicBatcher(constant, backend, runtime::BatcherOptions()),
+                 CheckFailure);
+}
+
+TEST(dynamic_batcher, flushes_queue_on_destruction)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BatcherOptions options;
+    options.max_latency = chrono::seconds(10);
+    auto a = backend->create_tensor(element::f32, Shape{1, 4});
+    copy_data(a, vector<float>{1, 1, 1, 1});
+    auto b = backend->create_tensor(element::f32, Shape{1, 3});
+    copy_data(b, vector<float>{0, 0, 0});
+    auto output = backend->create_tensor(element::f32, Shape{1, 3});
+    future<void> result;
+    {
+        runtime::DynamicBatcher batcher(make_dense_function(), backend, options);
+        result = batcher.submit({output}, {a, b});
+    }
+    ASSERT_EQ(result.wait_for(chrono::seconds(0)), future_status::ready);
+    result.get();
+    EXPECT_EQ(read_vector<float>(output), (vector<float>{2, 2, 2}));
+}
+#endif
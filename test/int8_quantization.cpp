@@ -0,0 +1,279 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cmath>
+#include <random>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/int8_quantization.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/calibrator.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static shared_ptr<Function> make_relu_dot_function(const Shape& data_shape,
+                                                   const vector<float>& weights,
+                                                   const Shape& weights_shape)
+{
+    auto A = make_shared<op::Parameter>(element::f32, data_shape);
+    auto relu = make_shared<op::Relu>(A);
+    auto W = make_shared<op::Constant>(element::f32, weights_shape, weights);
+    auto dot = make_shared<op::Dot>(relu, W);
+    return make_shared<Function>(dot, ParameterVector{A});
+}
+
+TEST(int8_quantization, skips_signed_activations)
+{
+    auto f = make_relu_dot_function(Shape{2, 2}, {1, -1, 0.5, 2}, Shape{2, 2});
+    auto relu = f->get_results()[0]->get_argument(0)->get_argument(0);
+    auto dot = f->get_results()[0]->get_argument(0);
+
+    runtime::CalibrationTable table;
+    table[runtime::calibration_key(relu->output(0))] = runtime::TensorRange{{-1}, {1}};
+    table[runtime::calibration_key(dot->output(0))] = runtime::TensorRange{{-3}, {3}};
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Int8Quantization>(table);
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedDot>(f), 0);
+
+    table[runtime::calibration_key(relu->output(0))] = runtime::TensorRange{{0}, {1}};
+    pass::Manager quantize_manager;
+    quantize_manager.register_pass<pass::Int8Quantization>(table);
+    quantize_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedDot>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::Quantize>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::Dequantize>(f), 1);
+}
+
+#ifdef NGRAPH_INTERPRETER_ENABLE
+TEST(int8_quantization, skips_dots_that_are_not_matrix_products)
+{
+    // A vector-matrix product and a Dot that reduces two axes stay in float
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto relu = make_shared<op::Relu>(A);
+    auto W = make_shared<op::Constant>(element::f32, Shape{4, 2}, vector<float>(8, 0.5f));
+    auto vector_dot = make_shared<op::Dot>(relu, W);
+    auto B = make_shared<op::Parameter>(element::f32, Shape{3, 2, 2});
+    auto relu_b = make_shared<op::Relu>(B);
+    auto W2 = make_shared<op::Constant>(element::f32, Shape{2, 2, 5}, vector<float>(20, 0.5f));
+    auto tensor_dot = make_shared<op::Dot>(relu_b, W2, 2);
+    auto f = make_shared<Function>(NodeVector{vector_dot, tensor_dot}, ParameterVector{A, B});
+
+    runtime::CalibrationTable table;
+    table[runtime::calibration_key(relu->output(0))] = runtime::TensorRange{{0}, {1}};
+    table[runtime::calibration_key(vector_dot->output(0))] = runtime::TensorRange{{0}, {2}};
+    table[runtime::calibration_key(relu_b->output(0))] = runtime::TensorRange{{0}, {1}};
+    table[runtime::calibration_key(tensor_dot->output(0))] = runtime::TensorRange{{0}, {2}};
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Int8Quantization>(table);
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(f), 2);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedDot>(f), 0);
+}
+
+TEST(int8_quantization, calibrator_min_max)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto relu = make_shared<op::Relu>(A);
+    auto neg = make_shared<op::Negative>(relu);
+    auto f = make_shared<Function>(neg, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::Calibrator calibrator(f, backend);
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{-1, 2, 3, 0.5f, -4, 1});
+    calibrator.run({a});
+    copy_data(a, vector<float>{-2, 0, 5, 0, 1, 1});
+    calibrator.run({a});
+    EXPECT_EQ(calibrator.get_batch_count(), 2);
+
+    auto table = calibrator.get_table();
+    ASSERT_EQ(table.size(), 2);
+    auto relu_range = table.at(runtime::calibration_key(relu->output(0)));
+    EXPECT_FALSE(relu_range.is_per_channel());
+    EXPECT_EQ(relu_range.get_min(), 0);
+    EXPECT_EQ(relu_range.get_max(), 5);
+    auto neg_range = table.at(runtime::calibration_key(neg->output(0)));
+    EXPECT_EQ(neg_range.get_min(), -5);
+    EXPECT_EQ(neg_range.get_max(), 0);
+    // The calibrated function is not modified
+    EXPECT_EQ(f->get_results().size(), 1);
+}
+
+TEST(int8_quantization, calibrator_per_channel)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto relu = make_shared<op::Relu>(A);
+    auto f = make_shared<Function>(relu, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::CalibrationOptions options;
+    options.per_channel = true;
+    runtime::Calibrator calibrator(f, backend, options);
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4, 0, 6});
+    calibrator.run({a});
+
+    auto range = calibrator.get_table().at(runtime::calibration_key(relu->output(0)));
+    ASSERT_TRUE(range.is_per_channel());
+    EXPECT_EQ(range.min, (vector<float>{1, 0, 3}));
+    EXPECT_EQ(range.max, (vector<float>{4, 2, 6}));
+}
+
+TEST(int8_quantization, calibrator_clips_outliers)
+{
+    Shape shape{1000};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto relu = make_shared<op::Relu>(A);
+    auto f = make_shared<Function>(relu, ParameterVector{A});
+    auto backend = runtime::Backend::create("INTERPRETER");
+
+    // Mostly values in [0, 1) with a single large outlier
+    mt19937 engine(0);
+    uniform_real_distribution<float> distribution(0, 1);
+    vector<vector<float>> batches(8, vector<float>(shape_size(shape)));
+    for (auto& batch : batches)
+    {
+        for (float& value : batch)
+        {
+            value = distribution(engine);
+        }
+    }
+    batches[3][17] = 1000;
+
+    auto calibrate = [&](runtime::CalibrationMethod method) {
+        runtime::CalibrationOptions options;
+        options.method = method;
+        options.percentile = 99.9;
+        runtime::Calibrator calibrator(f, backend, options);
+        auto a = backend->create_tensor(element::f32, shape);
+        for (auto& batch : batches)
+        {
+            copy_data(a, batch);
+            calibrator.run({a});
+        }
+        return calibrator.get_table().at(runtime::calibration_key(relu->output(0)));
+    };
+
+    EXPECT_EQ(calibrate(runtime::CalibrationMethod::MIN_MAX).get_max(), 1000);
+    auto percentile = calibrate(runtime::CalibrationMethod::PERCENTILE);
+    EXPECT_GE(percentile.get_max(), 0.9f);
+    EXPECT_LT(percentile.get_max(), 2.0f);
+    auto kl = calibrate(runtime::CalibrationMethod::KL_DIVERGENCE);
+    EXPECT_GE(kl.get_max(), 0.9f);
+    EXPECT_LT(kl.get_max(), 1000.0f);
+    EXPECT_EQ(kl.get_min(), percentile.get_min());
+}
+
+static void test_quantized_function(const shared_ptr<Function>& f,
+                                    const Shape& data_shape,
+                                    size_t expected_quantized_ops)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    mt19937 engine(0);
+    uniform_real_distribution<float> distribution(-1, 1);
+    auto random_batch = [&]() {
+        vector<float> batch(shape_size(data_shape));
+        for (float& value : batch)
+        {
+            value = distribution(engine);
+        }
+        return batch;
+    };
+
+    auto a = backend->create_tensor(element::f32, data_shape);
+    runtime::Calibrator calibrator(f, backend);
+    for (size_t i = 0; i < 4; i++)
+    {
+        copy_data(a, random_batch());
+        calibrator.run({a});
+    }
+    auto table = calibrator.get_table();
+
+    // The table refers to the nodes of f, so f is quantized in place and a copy is kept as
+    // the f32 reference
+    auto f_handle = backend->compile(clone_function(*f));
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Int8Quantization>(table);
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedConvolution>(f) +
+                  count_ops_of_type<op::QuantizedDot>(f),
+              expected_quantized_ops);
+    auto q_handle = backend->compile(f);
+    Shape output_shape = f->get_output_shape(0);
+    auto f_result = backend->create_tensor(element::f32, output_shape);
+    auto q_result = backend->create_tensor(element::f32, output_shape);
+    copy_data(a, random_batch());
+    f_handle->call_with_validate({f_result}, {a});
+    q_handle->call_with_validate({q_result}, {a});
+
+    auto expected = read_vector<float>(f_result);
+    auto actual = read_vector<float>(q_result);
+    float output_max = 0;
+    for (float value : expected)
+    {
+        output_max = max(output_max, fabs(value));
+    }
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_NEAR(expected[i], actual[i], 0.05f * output_max) << "at " << i;
+    }
+}
+
+TEST(int8_quantization, quantize_dot)
+{
+    Shape data_shape{4, 16};
+    Shape weights_shape{16, 8};
+    vector<float> weights(shape_size(weights_shape));
+    for (size_t i = 0; i < weights.size(); i++)
+    {
+        weights[i] = sin(static_cast<float>(i));
+    }
+    test_quantized_function(make_relu_dot_function(data_shape, weights, weights_shape),
+                            data_shape,
+                            1);
+}
+
+TEST(int8_quantization, quantize_convolution)
+{
+    Shape data_shape{1, 3, 6, 6};
+    Shape filters_shape{4, 3, 3, 3};
+    vector<float> filters(shape_size(filters_shape));
+    for (size_t i = 0; i < filters.size(); i++)
+    {
+        filters[i] = cos(static_cast<float>(i));
+    }
+    auto A = make_shared<op::Parameter>(element::f32, data_shape);
+    auto relu = make_shared<op::Relu>(A);
+    auto W = make_shared<op::Constant>(element::f32, filters_shape, filters);
+    auto conv = make_shared<op::Convolution>(relu, W);
+    auto relu2 = make_shared<op::Relu>(conv);
+    vector<float> filters2{0.5f, -1, 0.25f, 1, -0.5f, 0.75f, 1, -0.25f};
+    auto W2 = make_shared<op::Constant>(element::f32, Shape{2, 4, 1, 1}, filters2);
+    auto conv2 = make_shared<op::Convolution>(relu2, W2);
+    auto f = make_shared<Function>(conv2, ParameterVector{A});
+
+    test_quantized_function(f, data_shape, 2);
+}
+#endif
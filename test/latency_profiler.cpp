@@ -0,0 +1,140 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/latency_profiler.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(latency_profiler, histogram_percentiles)
+{
+    runtime::LatencyHistogram histogram;
+    for (uint64_t ticks = 1; ticks <= 1000; ticks++)
+    {
+        histogram.record(ticks);
+    }
+    EXPECT_EQ(histogram.count(), 1000);
+    EXPECT_EQ(histogram.sum(), 500500);
+    EXPECT_EQ(histogram.max(), 1000);
+    // Buckets are at most 1/8 of their lower bound wide
+    EXPECT_NEAR(histogram.percentile(0.5), 500, 500 / 8);
+    EXPECT_NEAR(histogram.percentile(0.99), 990, 990 / 8);
+    EXPECT_EQ(histogram.percentile(1.0), 1000);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.count(), 0);
+    EXPECT_EQ(histogram.percentile(0.5), 0);
+}
+
+TEST(latency_profiler, histogram_small_and_large_values)
+{
+    runtime::LatencyHistogram histogram;
+    histogram.record(0);
+    histogram.record(3);
+    histogram.record(uint64_t(1) << 60);
+    EXPECT_EQ(histogram.percentile(0.3), 0);
+    EXPECT_EQ(histogram.percentile(0.6), 3);
+    EXPECT_EQ(histogram.percentile(1.0), uint64_t(1) << 60);
+}
+
+TEST(latency_profiler, statistics_while_reconfiguring)
+{
+    vector<shared_ptr<const Node>> ops;
+    for (size_t i = 0; i < 64; i++)
+    {
+        ops.push_back(make_shared<op::Parameter>(element::f32, Shape{}));
+    }
+    runtime::LatencyProfiler profiler;
+    profiler.set_ops(ops);
+    profiler.set_enabled(true);
+    profiler.record_op(0, 100);
+
+    // set_ops replaces the histograms that readers walk
+    thread reconfigure([&]() {
+        for (size_t i = 0; i < 1000; i++)
+        {
+            profiler.set_ops(ops);
+            profiler.set_enabled(true);
+        }
+    });
+    for (size_t i = 0; i < 1000; i++)
+    {
+        EXPECT_LE(profiler.get_op_statistics().size(), 1);
+        profiler.reset();
+    }
+    reconfigure.join();
+}
+
+#ifdef NGRAPH_INTERPRETER_ENABLE
+TEST(latency_profiler, interpreter_executable)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    auto handle = backend->compile(f);
+
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(handle->get_call_latency_statistics().count, 0);
+
+    handle->set_latency_profiling_enabled(true);
+    for (size_t i = 0; i < 10; i++)
+    {
+        handle->call_with_validate({result}, {a, b});
+    }
+    handle->set_latency_profiling_enabled(false);
+    handle->call_with_validate({result}, {a, b});
+
+    auto call = handle->get_call_latency_statistics();
+    EXPECT_EQ(call.count, 10);
+    EXPECT_LE(call.p50_us, call.max_us);
+
+    bool found_add = false;
+    for (auto& op : handle->get_op_latency_statistics())
+    {
+        EXPECT_EQ(op.count, 10);
+        found_add = found_add || op.node->description() == "Add";
+    }
+    EXPECT_TRUE(found_add);
+
+    stringstream metrics;
+    metrics.precision(3);
+    auto flags = metrics.flags();
+    handle->write_latency_metrics(metrics, "add");
+    // The stream's format is left as it was
+    EXPECT_EQ(metrics.precision(), 3);
+    EXPECT_EQ(metrics.flags(), flags);
+    EXPECT_NE(metrics.str().find("# TYPE ngraph_call_latency_seconds summary"), string::npos);
+    EXPECT_NE(metrics.str().find(R"(ngraph_call_latency_seconds_count{executable="add"} 10)"),
+              string::npos);
+    EXPECT_NE(metrics.str().find(R"(type="Add",quantile="0.99"})"), string::npos);
+
+    handle->reset_latency_statistics();
+    EXPECT_EQ(handle->get_call_latency_statistics().count, 0);
+}
+#endif
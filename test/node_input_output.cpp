@@ -111,3 +111,27 @@ TEST(node_input_output, output_create_const)
 
     EXPECT_THROW(add->output(1), std::out_of_range);
 }
+
+TEST(node_input_output, connections_survive_growth)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{1, 2, 3, 4});
+    auto y = make_shared<op::Parameter>(element::f32, Shape{1, 2, 3, 4});
+    auto add = make_shared<op::Add>(x, y);
+    auto mul = make_shared<op::Multiply>(x, add);
+
+    // Growing the outputs of x moves them; their users must follow
+    x->set_output_size(16);
+    EXPECT_EQ(add->input(0).get_source_output(), x->output(0));
+    EXPECT_EQ(mul->input(0).get_source_output(), x->output(0));
+    EXPECT_EQ(add->get_input_shape(0), (Shape{1, 2, 3, 4}));
+    EXPECT_EQ(x->output(0).get_target_inputs(),
+              (set<Input<Node>>{add->input(0), mul->input(0)}));
+
+    // Growing the inputs of add moves them; the outputs they use must follow
+    add->set_argument(15, y);
+    EXPECT_EQ(add->get_input_size(), 16);
+    EXPECT_EQ(add->input(0).get_source_output(), x->output(0));
+    EXPECT_EQ(y->output(0).get_target_inputs(),
+              (set<Input<Node>>{add->input(1), add->input(15)}));
+    EXPECT_EQ(add->get_input_shape(1), (Shape{1, 2, 3, 4}));
+}
@@ -131,6 +131,94 @@ NGRAPH_TEST(onnx_${BACKEND_NAME}, model_binary_add_abc)
     test_case.run();
 }
 
+NGRAPH_TEST(onnx_${BACKEND_NAME}, model_streaming_import_matches_import)
+{
+    // add_abc_initializers, bool_init_raw, reshape_negative_dim and top_k_opset_10_const_k also
+    // list their initializers as graph inputs
+    const std::vector<std::string> models{"onnx/add_abc.onnx",
+                                          "onnx/add_abc_initializers.onnx",
+                                          "onnx/bool_init_raw.onnx",
+                                          "onnx/initializer_wo_input.onnx",
+                                          "onnx/initializers_raw_data.onnx",
+                                          "onnx/reshape_negative_dim.onnx",
+                                          "onnx/top_k_opset_10_const_k.onnx"};
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    for (const auto& model : models)
+    {
+        SCOPED_TRACE(model);
+        const auto path = file_util::path_join(SERIALIZED_ZOO, model);
+        const auto function = onnx_import::import_onnx_model(path);
+        const auto streamed = onnx_import::import_onnx_model_streaming(path);
+
+        const auto& parameters = function->get_parameters();
+        ASSERT_EQ(streamed->get_parameters().size(), parameters.size());
+        ASSERT_EQ(streamed->get_output_size(), function->get_output_size());
+        EXPECT_EQ(count_ops_of_type<op::Constant>(streamed),
+                  count_ops_of_type<op::Constant>(function));
+
+        std::vector<std::shared_ptr<runtime::Tensor>> inputs;
+        for (std::size_t i = 0; i < parameters.size(); i++)
+        {
+            const auto& parameter = streamed->get_parameters().at(i);
+            EXPECT_EQ(parameter->get_element_type(), parameters[i]->get_element_type());
+            EXPECT_EQ(parameter->get_shape(), parameters[i]->get_shape());
+            ASSERT_EQ(parameters[i]->get_element_type(), element::f32);
+            std::vector<float> values(shape_size(parameters[i]->get_shape()));
+            std::iota(values.begin(), values.end(), 1.f);
+            inputs.push_back(backend->create_tensor(element::f32, parameters[i]->get_shape()));
+            copy_data(inputs.back(), values);
+        }
+
+        auto run = [&](const std::shared_ptr<Function>& f) {
+            std::vector<std::shared_ptr<runtime::Tensor>> outputs;
+            for (std::size_t i = 0; i < f->get_output_size(); i++)
+            {
+                outputs.push_back(
+                    backend->create_tensor(f->get_output_element_type(i), f->get_output_shape(i)));
+            }
+            backend->compile(f)->call_with_validate(outputs, inputs);
+            std::vector<std::vector<char>> results;
+            for (const auto& output : outputs)
+            {
+                std::vector<char> bytes(output->get_size_in_bytes());
+                output->read(bytes.data(), bytes.size());
+                results.push_back(bytes);
+            }
+            return results;
+        };
+        for (std::size_t i = 0; i < function->get_output_size(); i++)
+        {
+            EXPECT_EQ(streamed->get_output_element_type(i), function->get_output_element_type(i));
+            EXPECT_EQ(streamed->get_output_shape(i), function->get_output_shape(i));
+        }
+        EXPECT_EQ(run(streamed), run(function));
+    }
+}
+
+NGRAPH_TEST(onnx_${BACKEND_NAME}, model_streaming_import_truncated)
+{
+    std::ifstream file{file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc_initializers.onnx"),
+                      std::ios::in | std::ios::binary};
+    const std::string model{std::istreambuf_iterator<char>{file}, {}};
+    ASSERT_FALSE(model.empty());
+
+    // Cut inside the graph, and inside the last field of the model
+    for (auto size : {model.size() / 2, model.size() - 1})
+    {
+        std::istringstream stream{model.substr(0, size)};
+        try
+        {
+            onnx_import::import_onnx_model_streaming(stream);
+            FAIL() << "Expected a model truncated to " << size << " bytes to be rejected";
+        }
+        catch (const ngraph_error& error)
+        {
+            EXPECT_HAS_SUBSTRING(error.what(),
+                                 "Failure parsing data from the provided input stream");
+        }
+    }
+}
+
 NGRAPH_TEST(onnx_${BACKEND_NAME}, bool_const_op)
 {
     auto function = onnx_import::import_onnx_model(
@@ -173,6 +261,40 @@ NGRAPH_TEST(onnx_${BACKEND_NAME}, bool_init_raw)
     test_case.run();
 }
 
+NGRAPH_TEST(onnx_${BACKEND_NAME}, model_initializers_raw_data)
+{
+    // A and I are copied straight from raw_data; the single value of S does not match its
+    // shape and is broadcast by the generic path
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/initializers_raw_data.prototxt"));
+
+    auto test_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({1, 1, 1, 1});
+    test_case.add_expected_output<float>(Shape{2, 2}, {1, 1.5, 2, 2.5});
+    test_case.add_expected_output<int64_t>(Shape{3}, {1, 2, -1});
+    test_case.run();
+}
+
+NGRAPH_TEST(onnx_${BACKEND_NAME}, model_initializer_errors_in_graph_order)
+{
+    // Initializers are converted in parallel, but the error reported is always the one of the
+    // first failing initializer in the graph
+    auto expect_error = [](const std::string& model, const std::string& message) {
+        try
+        {
+            onnx_import::import_onnx_model(file_util::path_join(SERIALIZED_ZOO, model));
+            FAIL() << "Expected import of " << model << " to fail";
+        }
+        catch (const ngraph_error& error)
+        {
+            EXPECT_HAS_SUBSTRING(error.what(), message);
+        }
+    };
+    expect_error("onnx/initializer_errors_count_first.prototxt",
+                 "Did not get the expected number of literals");
+    expect_error("onnx/initializer_errors_type_first.prototxt", "unsupported data type: STRING");
+}
+
 NGRAPH_TEST(onnx_${BACKEND_NAME}, model_add_abc_initializers)
 {
     auto function = onnx_import::import_onnx_model(
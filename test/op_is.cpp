@@ -465,6 +465,24 @@ namespace
         EXPECT_FALSE(node.is_binary_elementwise_logical());
     }
 
+    void op_is_EmbeddingBag()
+    {
+        op::EmbeddingBag node;
+        EXPECT_FALSE(node.is_unary_elementwise_arithmetic());
+        EXPECT_FALSE(node.is_binary_elementwise_arithmetic());
+        EXPECT_FALSE(node.is_binary_elementwise_comparison());
+        EXPECT_FALSE(node.is_binary_elementwise_logical());
+    }
+
+    void op_is_EmbeddingBagBackprop()
+    {
+        op::EmbeddingBagBackprop node;
+        EXPECT_FALSE(node.is_unary_elementwise_arithmetic());
+        EXPECT_FALSE(node.is_binary_elementwise_arithmetic());
+        EXPECT_FALSE(node.is_binary_elementwise_comparison());
+        EXPECT_FALSE(node.is_binary_elementwise_logical());
+    }
+
     void op_is_EmbeddingLookup()
     {
         op::EmbeddingLookup node;
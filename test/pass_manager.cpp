@@ -67,3 +67,93 @@ TEST(pass_manager, serialize_with_revalidate_does_not_crash)
     auto graph = make_test_graph();
     pass_manager.run_passes(graph);
 }
+
+TEST(pass_manager, revalidate_only_dirty_nodes)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto add = make_shared<op::Add>(A, B);
+    auto neg = make_shared<op::Negative>(add);
+    auto f = make_shared<Function>(neg, ParameterVector{A, B});
+    for (auto& node : f->get_ordered_ops())
+    {
+        EXPECT_FALSE(node->is_validation_dirty());
+    }
+
+    // Changing a parameter marks it dirty; the new shape then propagates to its users
+    A->set_partial_shape(PartialShape{4, 3});
+    B->set_partial_shape(PartialShape{4, 3});
+    EXPECT_TRUE(A->is_validation_dirty());
+    EXPECT_FALSE(add->is_validation_dirty());
+
+    f->validate_dirty_nodes_and_infer_types();
+    EXPECT_EQ(neg->get_shape(), (Shape{4, 3}));
+    for (auto& node : f->get_ordered_ops())
+    {
+        EXPECT_FALSE(node->is_validation_dirty());
+    }
+}
+
+TEST(pass_manager, replace_input_marks_node_dirty)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto C = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto add = make_shared<op::Add>(A, B);
+    auto neg = make_shared<op::Negative>(add);
+    EXPECT_FALSE(add->is_validation_dirty());
+
+    add->input(1).replace_source_output(C);
+    EXPECT_TRUE(add->is_validation_dirty());
+    // The output type of add is unchanged, so its users stay clean
+    EXPECT_TRUE(add->revalidate_and_infer_types_if_dirty());
+    EXPECT_FALSE(add->is_validation_dirty());
+    EXPECT_FALSE(neg->is_validation_dirty());
+    EXPECT_FALSE(add->revalidate_and_infer_types_if_dirty());
+
+    // replace_node rewires the users of the replaced node
+    auto sub = make_shared<op::Subtract>(A, C);
+    replace_node(add, sub);
+    EXPECT_TRUE(neg->is_validation_dirty());
+}
+
+TEST(pass_manager, attribute_setters_mark_node_dirty)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto k = op::Constant::create(element::i64, Shape{}, {2});
+    auto topk = make_shared<op::v1::TopK>(A, k, 1, "max", "value");
+    auto convert = make_shared<op::Convert>(A, element::f32);
+    auto concat = make_shared<op::Concat>(NodeVector{A, A}, 0);
+    EXPECT_FALSE(topk->is_validation_dirty());
+    EXPECT_FALSE(convert->is_validation_dirty());
+    EXPECT_FALSE(concat->is_validation_dirty());
+
+    topk->set_index_element_type(element::i64);
+    convert->set_destination_type(element::i32);
+    concat->set_concatenation_axis(1);
+    EXPECT_TRUE(topk->is_validation_dirty());
+    EXPECT_TRUE(convert->is_validation_dirty());
+    EXPECT_TRUE(concat->is_validation_dirty());
+}
+
+TEST(pass_manager, validate_picks_up_changed_attributes)
+{
+    // Attribute setters mark their node dirty, so pass::Validate picks up the changes
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto convert = make_shared<op::Convert>(A, element::f32);
+    auto broadcast = make_shared<op::Broadcast>(A, Shape{2, 3}, AxisSet{});
+    auto concat = make_shared<op::Concat>(NodeVector{A, A}, 0);
+    auto f = make_shared<Function>(NodeVector{convert, broadcast, concat}, ParameterVector{A});
+
+    convert->set_destination_type(element::i32);
+    broadcast->set_broadcast_shape(Shape{4, 2, 3});
+    broadcast->set_broadcast_axes(AxisSet{0});
+    concat->set_concatenation_axis(1);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Validate>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(convert->get_element_type(), element::i32);
+    EXPECT_EQ(broadcast->get_shape(), (Shape{4, 2, 3}));
+    EXPECT_EQ(concat->get_shape(), (Shape{2, 6}));
+}
@@ -0,0 +1,135 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/structural_hash.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static shared_ptr<Function> make_mlp(const vector<float>& weights)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{4, 2});
+    auto w = op::Constant::create(element::f32, Shape{2, 2}, weights);
+    auto b = make_shared<op::Parameter>(element::f32, Shape{4, 2});
+    auto dot = make_shared<op::Dot>(x, w);
+    auto relu = make_shared<op::Relu>(make_shared<op::Add>(dot, b));
+    return make_shared<Function>(relu, ParameterVector{x, b});
+}
+
+TEST(structural_hash, identical_functions)
+{
+    auto f = make_mlp({1, 2, 3, 4});
+    auto g = make_mlp({1, 2, 3, 4});
+    EXPECT_EQ(hash_function(f), hash_function(g));
+    EXPECT_TRUE(functions_equal(f, g));
+    EXPECT_TRUE(functions_equal(f, f));
+}
+
+TEST(structural_hash, constant_values)
+{
+    auto f = make_mlp({1, 2, 3, 4});
+    auto g = make_mlp({1, 2, 3, 5});
+    EXPECT_NE(hash_function(f), hash_function(g));
+    EXPECT_FALSE(functions_equal(f, g));
+
+    // Same architecture, different weights
+    EXPECT_EQ(hash_function(f, false), hash_function(g, false));
+    EXPECT_TRUE(functions_equal(f, g, false));
+}
+
+TEST(structural_hash, parameter_order)
+{
+    auto make_subtract = [](bool swap) {
+        auto a = make_shared<op::Parameter>(element::f32, Shape{2});
+        auto b = make_shared<op::Parameter>(element::f32, Shape{2});
+        auto sub = swap ? make_shared<op::Subtract>(b, a) : make_shared<op::Subtract>(a, b);
+        return make_shared<Function>(sub, ParameterVector{a, b});
+    };
+    auto f = make_subtract(false);
+    auto g = make_subtract(true);
+    EXPECT_NE(hash_function(f), hash_function(g));
+    EXPECT_FALSE(functions_equal(f, g));
+}
+
+TEST(structural_hash, attributes)
+{
+    auto make_sum = [](const AxisSet& axes) {
+        auto a = make_shared<op::Parameter>(element::f32, Shape{3, 3});
+        return make_shared<Function>(make_shared<op::Sum>(a, axes), ParameterVector{a});
+    };
+    // Both reductions produce a Shape{3} result
+    EXPECT_NE(hash_function(make_sum(AxisSet{0})), hash_function(make_sum(AxisSet{1})));
+    EXPECT_FALSE(functions_equal(make_sum(AxisSet{0}), make_sum(AxisSet{1})));
+    EXPECT_TRUE(functions_equal(make_sum(AxisSet{1}), make_sum(AxisSet{1})));
+
+    auto make_transpose = [](const AxisVector& order) {
+        auto a = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+        auto reshape = make_shared<op::Reshape>(a, order, Shape{2, 2});
+        return make_shared<Function>(reshape, ParameterVector{a});
+    };
+    EXPECT_FALSE(functions_equal(make_transpose(AxisVector{0, 1}),
+                                 make_transpose(AxisVector{1, 0})));
+}
+
+TEST(structural_hash, element_types_and_shapes)
+{
+    auto make_relu = [](const element::Type& type, const Shape& shape) {
+        auto a = make_shared<op::Parameter>(type, shape);
+        return make_shared<Function>(make_shared<op::Relu>(a), ParameterVector{a});
+    };
+    auto f = make_relu(element::f32, Shape{2, 3});
+    EXPECT_NE(hash_function(f), hash_function(make_relu(element::f64, Shape{2, 3})));
+    EXPECT_NE(hash_function(f), hash_function(make_relu(element::f32, Shape{3, 2})));
+    EXPECT_FALSE(functions_equal(f, make_relu(element::f32, Shape{3, 2})));
+}
+
+TEST(structural_hash, shared_and_duplicated_subexpressions)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto neg = make_shared<op::Negative>(a);
+    auto f = make_shared<Function>(make_shared<op::Add>(neg, neg), ParameterVector{a});
+
+    auto b = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto g = make_shared<Function>(
+        make_shared<op::Add>(make_shared<op::Negative>(b), make_shared<op::Negative>(b)),
+        ParameterVector{b});
+
+    EXPECT_EQ(hash_function(f), hash_function(g));
+    EXPECT_TRUE(functions_equal(f, g));
+}
+
+TEST(structural_hash, invalidate)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto neg = make_shared<op::Negative>(a);
+    auto abs = make_shared<op::Abs>(neg);
+    auto f = make_shared<Function>(abs, ParameterVector{a});
+
+    StructuralHasher hasher(f);
+    uint64_t before = hasher.get_function_hash();
+    EXPECT_EQ(before, hasher.get_function_hash());
+
+    replace_node(neg, make_shared<op::Relu>(a));
+    // The old hash of abs is still cached until it is invalidated
+    EXPECT_EQ(before, hasher.get_function_hash());
+    hasher.invalidate(abs);
+    uint64_t after = hasher.get_function_hash();
+    EXPECT_NE(before, after);
+    EXPECT_EQ(after, hash_function(f));
+}
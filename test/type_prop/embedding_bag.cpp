@@ -0,0 +1,111 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/type_prop.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(type_prop, embedding_bag_static_shapes)
+{
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{100, 16});
+    auto indices = make_shared<op::Parameter>(element::i64, Shape{40});
+    auto offsets = make_shared<op::Parameter>(element::i64, Shape{8});
+    auto bag = make_shared<op::EmbeddingBag>(weights, indices, offsets);
+    ASSERT_EQ(bag->get_element_type(), element::f32);
+    ASSERT_EQ(bag->get_shape(), (Shape{8, 16}));
+
+    auto delta = make_shared<op::Parameter>(element::f32, Shape{8, 16});
+    auto bprop = make_shared<op::EmbeddingBagBackprop>(
+        weights, indices, offsets, delta, op::EmbeddingBag::Reduction::SUM);
+    ASSERT_EQ(bprop->get_output_size(), 1);
+    ASSERT_EQ(bprop->get_output_shape(0), (Shape{40, 16}));
+}
+
+TEST(type_prop, embedding_bag_dynamic_offsets)
+{
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{100, 16});
+    auto indices = make_shared<op::Parameter>(element::i32, PartialShape{Dimension::dynamic()});
+    auto offsets = make_shared<op::Parameter>(element::i32, PartialShape::dynamic());
+    auto bag = make_shared<op::EmbeddingBag>(weights, indices, offsets);
+    ASSERT_TRUE(bag->get_output_partial_shape(0).same_scheme(
+        PartialShape{Dimension::dynamic(), 16}));
+}
+
+TEST(type_prop, embedding_bag_offsets_type_mismatch)
+{
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{100, 16});
+    auto indices = make_shared<op::Parameter>(element::i32, Shape{40});
+    auto offsets = make_shared<op::Parameter>(element::i64, Shape{8});
+    try
+    {
+        auto bag = make_shared<op::EmbeddingBag>(weights, indices, offsets);
+        FAIL() << "Mismatched index types not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(),
+                             std::string("offsets must have the element type of indices"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, embedding_bag_per_sample_weights_requires_sum)
+{
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{100, 16});
+    auto indices = make_shared<op::Parameter>(element::i32, Shape{40});
+    auto offsets = make_shared<op::Parameter>(element::i32, Shape{8});
+    auto psw = make_shared<op::Parameter>(element::f32, Shape{40});
+    try
+    {
+        auto bag = make_shared<op::EmbeddingBag>(
+            weights, indices, offsets, psw, op::EmbeddingBag::Reduction::MEAN);
+        FAIL() << "Per-sample weights with MEAN not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), std::string("only supported with the SUM reduction"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, embedding_bag_decreasing_constant_offsets)
+{
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{100, 16});
+    auto indices = make_shared<op::Parameter>(element::i32, Shape{40});
+    auto offsets = op::Constant::create(element::i32, Shape{3}, {0, 20, 10});
+    try
+    {
+        auto bag = make_shared<op::EmbeddingBag>(weights, indices, offsets);
+        FAIL() << "Decreasing offsets not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), std::string("offsets must be non-decreasing"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
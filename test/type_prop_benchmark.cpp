@@ -73,3 +73,37 @@ TEST(type_prop, DISABLED_benchmark_type_prop_convolution)
     std::cout << "Constructed " << std::fixed << num_iterations << " Convolution ops in "
               << std::fixed << total_nanosec << " ns" << std::endl;
 }
+
+TEST(type_prop, DISABLED_benchmark_revalidate_dirty_nodes)
+{
+    auto p = make_shared<op::Parameter>(element::f32, Shape{1, 2, 3, 4});
+    shared_ptr<Node> x = p;
+    for (size_t i = 0; i < 1000; i++)
+    {
+        x = make_shared<op::Add>(x, p);
+    }
+    auto f = make_shared<Function>(x, ParameterVector{p});
+
+    constexpr size_t num_iterations = 100;
+    stopwatch full_sw;
+    stopwatch dirty_sw;
+
+    for (size_t i = 0; i < num_iterations; i++)
+    {
+        full_sw.start();
+        f->validate_nodes_and_infer_types();
+        full_sw.stop();
+
+        // Only the parameter is dirty, and as its type does not change no other node is
+        // revalidated
+        p->set_partial_shape(PartialShape{1, 2, 3, 4});
+        dirty_sw.start();
+        f->validate_dirty_nodes_and_infer_types();
+        dirty_sw.stop();
+    }
+
+    std::cout.imbue(std::locale(""));
+    std::cout << "Revalidated " << std::fixed << num_iterations << " functions in " << std::fixed
+              << full_sw.get_total_nanoseconds() << " ns (all nodes), "
+              << dirty_sw.get_total_nanoseconds() << " ns (dirty nodes)" << std::endl;
+}
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <sstream>
 #include <string>
@@ -29,6 +31,8 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/serializer.hpp"
+#include "ngraph/thread_pool.hpp"
+#include "ngraph/variant.hpp"
 #include "util/all_close.hpp"
 #include "util/autodiff/backprop_function.hpp"
 #include "util/ndarray.hpp"
@@ -692,6 +696,100 @@ TEST(util, clone_function_op_annotations)
     EXPECT_TRUE(found_B);
 }
 
+TEST(util, clone_function_rt_info)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto variant = make_shared<VariantWrapper<std::string>>("layout");
+    A->get_rt_info()["layout"] = variant;
+
+    auto g = clone_function(*f);
+    shared_ptr<const Node> cloned_A = g->get_parameters()[0];
+    shared_ptr<const Node> const_A = A;
+    // The map is shared until it is written to
+    EXPECT_EQ(&cloned_A->get_rt_info(), &const_A->get_rt_info());
+    ASSERT_EQ(cloned_A->get_rt_info().count("layout"), 1);
+    EXPECT_EQ(cloned_A->get_rt_info().at("layout"), variant);
+    // Nodes without rt_info do not allocate it when cloned
+    shared_ptr<const Node> cloned_B = g->get_parameters()[1];
+    EXPECT_TRUE(cloned_B->get_rt_info().empty());
+
+    // A write to the clone copies the map, so the original does not see it
+    g->get_parameters()[0]->get_rt_info()["other"] = variant;
+    EXPECT_NE(&cloned_A->get_rt_info(), &const_A->get_rt_info());
+    EXPECT_EQ(const_A->get_rt_info().count("other"), 0);
+    EXPECT_EQ(cloned_A->get_rt_info().at("layout"), variant);
+
+    // And a write to the original does not reach a clone
+    auto h = clone_function(*f);
+    A->get_rt_info().erase("layout");
+    EXPECT_EQ(h->get_parameters()[0]->get_rt_info().count("layout"), 1);
+}
+
+TEST(util, clone_function_types)
+{
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape{2, Dimension::dynamic()});
+    auto B = make_shared<op::Parameter>(element::i32, Shape{3});
+    auto C = make_shared<op::Convert>(B, element::f32);
+    auto f = make_shared<Function>(NodeVector{make_shared<op::Add>(A, A), C},
+                                   ParameterVector{A, B});
+
+    auto g = clone_function(*f);
+    ASSERT_EQ(g->get_output_size(), 2);
+    EXPECT_EQ(g->get_output_element_type(0), element::f32);
+    EXPECT_TRUE(g->get_output_partial_shape(0).same_scheme(PartialShape{2, Dimension::dynamic()}));
+    EXPECT_EQ(g->get_output_element_type(1), element::f32);
+    EXPECT_EQ(g->get_output_shape(1), Shape{3});
+    EXPECT_EQ(g->get_ops().size(), f->get_ops().size());
+
+    // A pre-mapped parameter with a different shape is propagated to its users
+    NodeMap node_map;
+    auto D = make_shared<op::Parameter>(element::f32, Shape{2, 5});
+    node_map[A.get()] = D;
+    auto h = clone_function(*f, node_map);
+    EXPECT_EQ(h->get_output_shape(0), (Shape{2, 5}));
+    EXPECT_EQ(h->get_parameters()[0], D);
+}
+
+TEST(util, clone_function_revalidates)
+{
+    // v1::TopK takes its index type after construction when it is copied
+    auto data = make_shared<op::Parameter>(element::f32, Shape{2, 5});
+    auto k = op::Constant::create(element::i64, Shape{}, {3});
+    auto topk = make_shared<op::v1::TopK>(data, k, 1, "max", "value", element::i64);
+    auto f = make_shared<Function>(topk->outputs(), ParameterVector{data});
+
+    auto g = clone_function(*f);
+    EXPECT_EQ(g->get_output_element_type(0), element::f32);
+    EXPECT_EQ(g->get_output_element_type(1), element::i64);
+    EXPECT_EQ(g->get_output_shape(1), (Shape{2, 3}));
+
+    // TensorIterator gets its body and descriptions after construction
+    auto X = make_shared<op::Parameter>(element::f32, Shape{32, 40, 10});
+    auto M = make_shared<op::Parameter>(element::f32, Shape{32, 2, 10});
+    auto Xi = make_shared<op::Parameter>(element::f32, Shape{32, 2, 10});
+    auto M_body = make_shared<op::Parameter>(element::f32, Shape{32, 2, 10});
+    auto Zo = Xi * M_body;
+    auto body =
+        make_shared<op::TensorIterator::BodyLambda>(OutputVector{Zo}, ParameterVector{Xi, M_body});
+    auto tensor_iterator = make_shared<op::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(Xi, X, 0, 2, 2, -1, 1);
+    tensor_iterator->set_invariant_input(M_body, M);
+    auto out0 = tensor_iterator->get_iter_value(Zo, -1);
+    auto out1 = tensor_iterator->get_concatenated_slices(Zo, 0, 2, 2, -1, 1);
+    auto ti_f = make_shared<Function>(OutputVector{out0, out1}, ParameterVector{X, M});
+
+    auto ti_g = clone_function(*ti_f);
+    EXPECT_EQ(ti_g->get_output_element_type(0), element::f32);
+    EXPECT_EQ(ti_g->get_output_shape(0), (Shape{32, 2, 10}));
+    EXPECT_EQ(ti_g->get_output_element_type(1), element::f32);
+    EXPECT_EQ(ti_g->get_output_shape(1), (Shape{32, 40, 10}));
+}
+
 TEST(util, topological_sort_replace)
 {
     Shape shape{2, 2};
@@ -712,3 +810,57 @@ TEST(util, topological_sort_replace)
 
     EXPECT_TRUE(custom_sorter_used);
 }
+
+TEST(util, thread_pool_parallel_for)
+{
+    ThreadPool pool(3);
+    EXPECT_EQ(pool.get_max_threads(), 4);
+    vector<int> hits(1000, 0);
+    pool.parallel_for(hits.size(), 4, [&](size_t i) {
+        // Nested loops on the same pool run on the calling thread if no worker is free
+        pool.parallel_for(2, 4, [&](size_t j) {
+            if (j == 0)
+            {
+                hits[i]++;
+            }
+        });
+    });
+    EXPECT_EQ(count(hits.begin(), hits.end(), 1), 1000);
+
+    vector<size_t> chunks(100, 0);
+    pool.parallel_for(chunks.size(), 10, 4, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            chunks[i] = end - begin;
+        }
+    });
+    EXPECT_EQ(count(chunks.begin(), chunks.end(), 25), 100);
+}
+
+TEST(util, thread_pool_rethrows_first_error)
+{
+    ThreadPool pool(3);
+    // A single thread takes the serial path, which must follow the same rule
+    for (size_t max_threads : {1, 4})
+    {
+        SCOPED_TRACE(max_threads);
+        atomic<size_t> calls{0};
+        try
+        {
+            pool.parallel_for(64, max_threads, [&](size_t i) {
+                calls++;
+                if (i % 10 == 7)
+                {
+                    throw runtime_error(to_string(i));
+                }
+            });
+            FAIL() << "parallel_for did not rethrow";
+        }
+        catch (const runtime_error& e)
+        {
+            EXPECT_EQ(string(e.what()), "7");
+        }
+        // Every iteration runs even after one has failed
+        EXPECT_EQ(calls, 64);
+    }
+}